@@ -0,0 +1,109 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Test case description: compare the throughput of the software checksum, the single stream
+ * hardware checksum and the checksum WiredTiger selects at run time, across buffer sizes from small
+ * cells to large compressed pages and log buffers. The -o option sets the megabytes checksummed
+ * with each function at each buffer size.
+ */
+
+#define DEFAULT_MB 256
+#define MAX_BUFFER (4 * WT_MEGABYTE)
+
+static const size_t buffer_sizes[] = {64, 512, 4 * WT_KILOBYTE, 16 * WT_KILOBYTE,
+  64 * WT_KILOBYTE, 256 * WT_KILOBYTE, WT_MEGABYTE, MAX_BUFFER};
+
+/*
+ * run --
+ *     Checksum a buffer repeatedly, returning the throughput in megabytes per second and the
+ *     checksum.
+ */
+static double
+run(uint32_t (*checksum_fn)(const void *, size_t), const uint8_t *data, size_t len, uint64_t mb,
+  uint32_t *checksump)
+{
+    struct timespec start, stop;
+    uint64_t i, iterations, ms;
+    uint32_t checksum;
+
+    iterations = WT_MAX(1, mb * WT_MEGABYTE / len);
+    checksum = 0;
+    __wt_epoch(NULL, &start);
+    for (i = 0; i < iterations; ++i)
+        checksum ^= checksum_fn(data, len);
+    __wt_epoch(NULL, &stop);
+
+    /* Identical checksums cancel out in the loop, record a single run. */
+    *checksump = checksum_fn(data, len);
+    ms = WT_MAX(1, WT_TIMEDIFF_MS(stop, start));
+    return (((double)iterations * len / WT_MEGABYTE) / ((double)ms / WT_THOUSAND));
+}
+
+/*
+ * main --
+ *     Benchmark the checksum functions.
+ */
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+    WT_RAND_STATE rnd;
+    size_t i, len;
+    uint32_t (*checksum_fn)(const void *, size_t);
+    uint32_t hw, serial, sw;
+    uint8_t *data;
+    double hw_mbps, serial_mbps, sw_mbps;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    opts->nops = DEFAULT_MB;
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+
+    __wt_random_init_seed(NULL, &rnd);
+    data = dcalloc(MAX_BUFFER, sizeof(uint8_t));
+    for (i = 0; i < MAX_BUFFER; ++i)
+        data[i] = (uint8_t)__wt_random(&rnd);
+    checksum_fn = wiredtiger_crc32c_func();
+
+    printf("%10s %14s %14s %14s\n", "bytes", "software MB/s", "serial MB/s", "selected MB/s");
+    for (i = 0; i < WT_ELEMENTS(buffer_sizes); ++i) {
+        len = buffer_sizes[i];
+        sw_mbps = run(__wt_checksum_sw, data, len, opts->nops, &sw);
+        serial_mbps = run(__wt_checksum_hw_serial, data, len, opts->nops, &serial);
+        hw_mbps = run(checksum_fn, data, len, opts->nops, &hw);
+        testutil_assertfmt(sw == serial && sw == hw,
+          "checksum mismatch of %" WT_SIZET_FMT " bytes: %#08x, %#08x, %#08x", len, sw, serial, hw);
+        printf("%10" WT_SIZET_FMT " %14.0f %14.0f %14.0f\n", len, sw_mbps, serial_mbps, hw_mbps);
+    }
+
+    free(data);
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
@@ -112,6 +112,12 @@ config_include(
     FILE "x86intrin.h"
 )
 
+config_include(
+    HAVE_LINUX_IO_URING_H
+    "Include header linux/io_uring.h exists."
+    FILE "linux/io_uring.h"
+)
+
 config_include(
     HAVE_DLFCN_H
     "Include header dlfcn.h exists."
@@ -232,6 +232,16 @@ file_runtime_config = common_runtime_config + [
         should specify \c sequential and other workloads should specify \c none. The option leads
         to an appropriate operating system advisory call where available''',
         choices=['none', 'random', 'sequential']),
+    Config('cache_max', '0', r'''
+        maximum cache usage for the object, in bytes. If non-zero, eviction targets the object's
+        pages ahead of other objects' pages whenever the object is using more than this much of
+        the cache, even if the cache as a whole is within its targets''',
+        min=0),
+    Config('cache_reserve', '0', r'''
+        cache reservation for the object, in bytes. If non-zero, eviction skips the object's pages
+        while the object is using less than this much of the cache, unless the cache is under
+        aggressive eviction pressure''',
+        min=0),
     Config('cache_resident', 'false', r'''
         do not ever evict the object's pages from cache. Not compatible with LSM tables; see
         @ref tuning_cache_resident for more information''',
@@ -254,15 +264,22 @@ file_runtime_config = common_runtime_config + [
         dirty blocks belonging to this object in the system buffer cache after that many bytes
         from this object are written into the buffer cache''',
         min=0),
+    Config('write_combine_max', '0', r'''
+        maximum size of a combined checkpoint write, in bytes. If non-zero, blocks written by
+        checkpoint at adjacent file offsets are gathered in memory and written to the file with a
+        single system call of up to that many bytes''',
+        min=0, max='128MB'),
 ]
 
 # Per-file configuration
 file_config = format_meta + file_runtime_config + tiered_config + [
     Config('block_allocation', 'best', r'''
-        configure block allocation. Permitted values are \c "best" or \c "first"; the \c "best"
-        configuration uses a best-fit algorithm, the \c "first" configuration uses a
-        first-available algorithm during block allocation''',
-        choices=['best', 'first',]),
+        configure block allocation. Permitted values are \c "best", \c "first" or
+        \c "segregated"; the \c "best" configuration uses a best-fit algorithm, the \c "first"
+        configuration uses a first-available algorithm during block allocation, the
+        \c "segregated" configuration uses a best-fit algorithm that extends the file rather than
+        split available space intended for blocks of a different size class''',
+        choices=['best', 'first', 'segregated',]),
     Config('allocation_size', '4KB', r'''
         the file unit allocation size, in bytes, must be a power of two; smaller values decrease
         the file space required by overflow items, and the default value of 4KB is a good choice
@@ -516,6 +533,16 @@ connection_runtime_config = [
             min='0', max='1024GB'),
         Config('type', '', r'''
             cache location: DRAM or NVRAM'''),
+        Config('victim_cache', 'false', r'''
+            use the block cache as a second tier for clean pages evicted from the cache: blocks
+            are retained in least recently evicted order, and blocks of pages still in the cache
+            are the first to be evicted from the block cache''',
+            type='boolean'),
+        Config('warm_restart', 'false', r'''
+            write a manifest of the most referenced blocks in the cache at each checkpoint and
+            on shutdown, and on startup, read those blocks back into the cache in the background,
+            subject to the read I/O capacity''',
+            type='boolean'),
         ]),
     Config('cache_size', '100MB', r'''
         maximum heap memory to allocate for the cache. A database should configure either
@@ -537,6 +564,23 @@ connection_runtime_config = [
         heap allocation sizes and patterns, therefore applications may need to adjust this
         value based on allocator choice and behavior in measured workloads''',
         min='0', max='30'),
+    Config('chain_trim', '', r'''
+        trim obsolete updates from long update chains in the background. Enabling update chain
+        trimming uses a session from the configured \c session_max''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            if true, a background thread removes updates that are no longer needed by any reader
+            from pages with long update chains, without evicting or reconciling the pages. See
+            @ref tuning_cache_chain_trim''',
+            type='boolean'),
+        Config('min_length', '100', r'''
+            the length of an update chain that could not be trimmed when it was last updated,
+            above which its page is trimmed in the background''',
+            min='20', max='100000'),
+        Config('wait_ms', '100', r'''
+            milliseconds to wait between each pass over the pages with long update chains''',
+            min='10', max='100000'),
+        ]),
     Config('checkpoint', '', r'''
         periodically checkpoint the database. Enabling the checkpoint server uses a session
         from the configured \c session_max''',
@@ -641,6 +685,12 @@ connection_runtime_config = [
     Config('eviction', '', r'''
         eviction configuration options''',
         type='category', subconfig=[
+            Config('app_wait_ms', '0', r'''
+                if non-zero, application threads that must help with eviction instead wait for the
+                eviction threads to make progress, for up to this many milliseconds in each
+                operation. Application threads only evict pages themselves once the budget is
+                used up. See @ref cache_eviction''',
+                min=0, max=1000),
             Config('threads_max', '8', r'''
                 maximum number of threads WiredTiger will start to help evict pages from cache. The
                 number of threads started will vary depending on the current eviction load. Each
@@ -655,6 +705,25 @@ connection_runtime_config = [
                 If no in-memory ref is found on the root page, attempt to locate a random 
                 in-memory page by examining all entries on the root page.''',
                 type='boolean'),
+            Config('pacing_horizon_ms', '0', r'''
+                if non-zero, estimate the rates at which the cache content and dirty content are
+                growing, and start eviction before the targets are reached if the content projected
+                this many milliseconds ahead would cross the triggers. See @ref cache_eviction''',
+                min=0, max=60000),
+            Config('policy', 'lru', r'''
+                the page replacement policy used to choose pages for eviction. The \c lru policy
+                approximates least recently used order. The \c frequency policy also counts
+                accesses to each page, and pages accessed since eviction last considered them are
+                skipped until their count decays, so pages read once by scans are evicted before
+                frequently used pages''',
+                choices=['lru', 'frequency']),
+            Config('tree_selection', 'round_robin', r'''
+                how the eviction server chooses the trees it walks for eviction candidates. The
+                \c round_robin setting steps through all open trees in turn. The \c ranked setting
+                periodically ranks the open trees by the cache content eviction is looking for,
+                and walks the trees holding the most of it first, skipping trees with nothing to
+                evict. See @ref cache_eviction''',
+                choices=['round_robin', 'ranked']),
             ]),
     Config('eviction_checkpoint_target', '1', r'''
         perform eviction at the beginning of checkpoints to bring the dirty content in cache
@@ -1110,6 +1179,13 @@ wiredtiger_open_chunk_cache_configuration = [
         Config('flushed_data_cache_insertion', 'true', r'''
             enable caching of freshly-flushed data, before it is removed locally.''',
             type='boolean', undoc=True),
+        Config('policy', 'clock', r'''
+            the replacement policy used to choose the chunks to evict. The \c clock policy evicts
+            chunks that have not been accessed recently. The \c tinylfu policy only admits a
+            recently cached chunk into the main region of the cache if it is estimated to be
+            accessed more often than the chunk it would replace, protecting frequently accessed
+            chunks from scans''',
+            choices=['clock', 'tinylfu']),
         Config('type', 'FILE', r'''
             cache location, defaults to the file system.''',
             choices=['FILE', 'DRAM'], undoc=True),
@@ -1186,6 +1262,19 @@ wiredtiger_open_common =\
         enable caching of cursors for reuse. This is the default value for any sessions created,
         and can be overridden in configuring \c cache_cursors in WT_CONNECTION.open_session.''',
         type='boolean'),
+    Config('cache_slab', '', r'''
+        allocate the images of pages read into the cache from slabs of memory owned by the cache,
+        instead of the heap. Slabs are split into chunks of sizes in multiples of 4KB up to
+        128KB, and the cache accounts for the whole chunk of each page image. See @ref
+        tuning_cache_slab''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            enable the slab allocator for page images''',
+            type='boolean'),
+        Config('hugepages', 'false', r'''
+            advise the operating system to back slabs with huge pages, where supported''',
+            type='boolean'),
+        ]),
     Config('checkpoint_sync', 'true', r'''
         flush files to stable storage when closing or writing checkpoints''',
         type='boolean'),
@@ -1221,6 +1310,18 @@ wiredtiger_open_common =\
             in clear text, so must be given to any subsequent ::wiredtiger_open calls to reopen the
             database. It must also be provided to any "wt" commands used with this database'''),
         ]),
+    Config('eviction_trace', '', r'''
+        record page evictions and application thread stalls on a full cache in a ring buffer,
+        which can be read with an \c eviction_trace: cursor or dumped with
+        WT_CONNECTION::debug_info. See @ref tuning_cache_eviction_trace''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            enable the eviction trace''',
+            type='boolean'),
+        Config('events', '4096', r'''
+            the number of events kept in the ring buffer; older events are overwritten''',
+            min='64', max='1048576'),
+        ]),
     Config('extensions', '', r'''
         list of shared library extensions to load (using dlopen). Any values specified to a
         library extension are passed to WT_CONNECTION::load_extension as the \c config parameter
@@ -1248,6 +1349,26 @@ wiredtiger_open_common =\
     Config('hazard_max', '1000', r'''
         maximum number of simultaneous hazard pointers per session handle''',
         min=15, undoc=True),
+    Config('io_buffer_pool_max', '8MB', r'''
+        maximum memory cached in a connection-wide pool of aligned buffers used to read and
+        write compressed or encrypted blocks. Buffers are kept in power-of-two size classes and
+        shared by all sessions. The pool is only used when \c buffer_alignment is non-zero, for
+        example with \c direct_io configured. A value of zero disables the pool. See @ref
+        tuning_system_buffer_cache_direct_io''',
+        min='0', max='1GB'),
+    Config('io_uring', '', r'''
+        configure batched asynchronous reads using the Linux io_uring interface. When enabled,
+        the pre-fetch server submits groups of queued block reads to the kernel in a single
+        system call, and blocks adjacent in the file are read with a single I/O. Ignored on
+        systems without io_uring support''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            whether batched reads are submitted using io_uring''',
+            type='boolean'),
+        Config('queue_depth', '32', r'''
+            the maximum number of block reads submitted in a single batch''',
+            min='2', max='256'),
+        ]),
     Config('mmap', 'true', r'''
         Use memory mapping when accessing files in a read-only mode''',
         type='boolean'),
@@ -1435,6 +1556,10 @@ methods = {
         maximum amount of time to allow for compact in seconds. The actual amount of time spent
         in compact may exceed the configured value. A value of zero disables the timeout''',
         type='int'),
+    Config('threads', '1', r'''
+        the number of threads the background compaction server uses to compact files in parallel.
+        Only used when background compaction is enabled''',
+        min='1', max='20'),
 ]),
 
 'WT_SESSION.create' : Method(file_config + lsm_config + tiered_config +
@@ -1962,6 +2087,8 @@ methods = {
         print cache information''', type='boolean'),
     Config('cursors', 'false', r'''
         print all open cursor information''', type='boolean'),
+    Config('eviction_trace', 'false', r'''
+        print the events in the eviction trace''', type='boolean'),
     Config('handles', 'false', r'''
         print open handles information''', type='boolean'),
     Config('log', 'false', r'''
@@ -215,6 +215,7 @@ conn_stats = [
     BackgroundCompactStat('background_compact_exclude', 'background compact skipped file as it is part of the exclude list', 'no_scale'),
     BackgroundCompactStat('background_compact_fail', 'background compact failed calls', 'no_scale'),
     BackgroundCompactStat('background_compact_fail_cache_pressure', 'background compact failed calls due to cache pressure', 'no_scale'),
+    BackgroundCompactStat('background_compact_files_active', 'number of files being compacted by background compaction threads', 'no_scale'),
     BackgroundCompactStat('background_compact_files_tracked', 'number of files tracked by background compaction', 'no_scale'),
     BackgroundCompactStat('background_compact_interrupted', 'background compact interrupted', 'no_scale'),
     BackgroundCompactStat('background_compact_running', 'background compact running', 'no_scale'),
@@ -255,12 +256,21 @@ conn_stats = [
     BlockCacheStat('block_cache_eviction_passes', 'number of eviction passes'),
     BlockCacheStat('block_cache_hits', 'number of hits'),
     BlockCacheStat('block_cache_lookups', 'lookups'),
+    BlockCacheStat('block_cache_manifest_blocks', 'number of blocks in the warm restart manifest', 'no_clear,no_scale'),
     BlockCacheStat('block_cache_misses', 'number of misses'),
     BlockCacheStat('block_cache_not_evicted_overhead', 'number of blocks not evicted due to overhead'),
+    BlockCacheStat('block_cache_prewarm_blocks', 'number of blocks loaded on warm restart'),
+    BlockCacheStat('block_cache_prewarm_skipped', 'number of warm restart blocks not loaded'),
+    BlockCacheStat('block_cache_victim_hits', 'number of hits on blocks of pages evicted from the cache'),
+    BlockCacheStat('block_cache_victim_not_cached', 'number of clean pages evicted from the cache without a cached block'),
+    BlockCacheStat('block_cache_victim_retained', 'number of blocks retained for clean pages evicted from the cache'),
 
     ##########################################
     # Block manager statistics
     ##########################################
+    BlockStat('block_buffer_pool_bytes', 'bytes cached in the aligned I/O buffer pool', 'no_clear,no_scale,size'),
+    BlockStat('block_buffer_pool_hit', 'aligned I/O buffers reused from the buffer pool'),
+    BlockStat('block_buffer_pool_miss', 'aligned I/O buffers allocated because the buffer pool was empty'),
     BlockStat('block_byte_map_read', 'mapped bytes read', 'size'),
     BlockStat('block_byte_read', 'bytes read', 'size'),
     BlockStat('block_byte_read_mmap', 'bytes read via memory map API', 'size'),
@@ -270,12 +280,20 @@ conn_stats = [
     BlockStat('block_byte_write_compact', 'bytes written by compaction', 'size'),
     BlockStat('block_byte_write_mmap', 'bytes written via memory map API', 'size'),
     BlockStat('block_byte_write_syscall', 'bytes written via system call API', 'size'),
+    BlockStat('block_extlist_merge_walk', 'extent list merges done by walking both lists in offset order'),
     BlockStat('block_map_read', 'mapped blocks read'),
     BlockStat('block_preload', 'blocks pre-loaded'),
     BlockStat('block_read', 'blocks read'),
+    BlockStat('block_read_batch', 'batched block read requests'),
+    BlockStat('block_read_batch_blocks', 'blocks read by batched block read requests'),
+    BlockStat('block_read_coalesce', 'batched block reads of adjacent blocks coalesced into a single read'),
+    BlockStat('block_read_coalesce_blocks', 'blocks read by coalesced batched block reads'),
+    BlockStat('block_read_io_uring_submit', 'batched block reads submitted via io_uring'),
     BlockStat('block_remap_file_resize', 'number of times the file was remapped because it changed size via fallocate or truncate'),
     BlockStat('block_remap_file_write', 'number of times the region was remapped via write'),
     BlockStat('block_write', 'blocks written'),
+    BlockStat('block_write_combine', 'combined checkpoint writes'),
+    BlockStat('block_write_combine_blocks', 'blocks written by combined checkpoint writes'),
 
     ##########################################
     # Cache and eviction statistics
@@ -287,6 +305,11 @@ conn_stats = [
     CacheStat('cache_bytes_max', 'maximum bytes configured', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_other', 'bytes not belonging to page images in the cache', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_updates', 'bytes allocated for updates', 'no_clear,no_scale,size'),
+    CacheStat('cache_chain_trim_bytes', 'update chain trimming bytes of obsolete updates removed', 'size'),
+    CacheStat('cache_chain_trim_pages', 'update chain trimming pages trimmed'),
+    CacheStat('cache_chain_trim_pages_visited', 'update chain trimming pages visited'),
+    CacheStat('cache_chain_trim_passes', 'update chain trimming passes'),
+    CacheStat('cache_chain_trim_updates', 'update chain trimming obsolete updates removed'),
     CacheStat('cache_eviction_active_workers', 'eviction worker thread active', 'no_clear'),
     CacheStat('cache_eviction_aggressive_set', 'eviction currently operating in aggressive mode', 'no_clear,no_scale'),
     CacheStat('cache_eviction_app_attempt', 'page evict attempts by application threads'),
@@ -296,6 +319,8 @@ conn_stats = [
     CacheStat('cache_eviction_app_dirty_fail', 'modified page evict failures by application threads'),
     # Note cache_eviction_app_dirty_attempt - cache_eviction_app_dirty_fail = modified page evict successes by application threads.
     CacheStat('cache_eviction_app_time', 'application thread time evicting (usecs)'),
+    CacheStat('cache_eviction_app_wait', 'application thread waits for eviction threads to make progress'),
+    CacheStat('cache_eviction_app_wait_exhausted', 'application thread eviction wait budget exhausted'),
     CacheStat('cache_eviction_clear_ordinary', 'pages removed from the ordinary queue to be queued for urgent eviction'),
     CacheStat('cache_eviction_consider_prefetch', 'pages considered for eviction that were brought in by pre-fetch', 'no_clear,no_scale'),
     CacheStat('cache_eviction_empty_score', 'eviction empty score', 'no_clear,no_scale'),
@@ -320,11 +345,17 @@ conn_stats = [
     CacheStat('cache_eviction_get_ref', 'eviction calls to get a page'),
     CacheStat('cache_eviction_get_ref_empty', 'eviction calls to get a page found queue empty'),
     CacheStat('cache_eviction_get_ref_empty2', 'eviction calls to get a page found queue empty after locking'),
+    CacheStat('cache_eviction_get_ref_steal', 'eviction calls to get a page found their queue shard empty and used another shard'),
     CacheStat('cache_eviction_internal_pages_already_queued', 'internal pages seen by eviction walk that are already queued'),
     CacheStat('cache_eviction_internal_pages_queued', 'internal pages queued for eviction'),
     CacheStat('cache_eviction_internal_pages_seen', 'internal pages seen by eviction walk'),
     CacheStat('cache_eviction_maximum_page_size', 'maximum page size seen at eviction', 'no_clear,no_scale,size'),
     CacheStat('cache_eviction_maximum_milliseconds', 'maximum milliseconds spent at a single eviction', 'no_clear,no_scale,size'),
+    CacheStat('cache_eviction_pacing_dirty_predicted', 'eviction pacing predicted dirty bytes at the horizon', 'no_clear,no_scale,size'),
+    CacheStat('cache_eviction_pacing_dirty_rate', 'eviction pacing dirty bytes growth per second', 'no_clear,no_scale'),
+    CacheStat('cache_eviction_pacing_early', 'eviction passes started early by eviction pacing'),
+    CacheStat('cache_eviction_pacing_inuse_predicted', 'eviction pacing predicted bytes in cache at the horizon', 'no_clear,no_scale,size'),
+    CacheStat('cache_eviction_pacing_inuse_rate', 'eviction pacing bytes in cache growth per second', 'no_clear,no_scale'),
     CacheStat('cache_eviction_pages_already_queued', 'pages seen by eviction walk that are already queued'),
     CacheStat('cache_eviction_pages_in_parallel_with_checkpoint', 'pages evicted in parallel with checkpoint'),
     CacheStat('cache_eviction_pages_queued', 'pages queued for eviction'),
@@ -337,6 +368,9 @@ conn_stats = [
     CacheStat('cache_eviction_server_evict_attempt', 'evict page attempts by eviction server'),
     CacheStat('cache_eviction_server_evict_fail', 'evict page failures by eviction server'),
     # Note cache_eviction_server_evict_attempt - cache_eviction_server_evict_fail = evict page successes by eviction server.
+    CacheStat('cache_eviction_server_rank_trees', 'eviction server rankings of trees by eviction candidates'),
+    CacheStat('cache_eviction_server_rank_trees_ranked', 'eviction server trees ranked in the most recent ranking', 'no_clear,no_scale'),
+    CacheStat('cache_eviction_server_rank_trees_skipped', 'eviction server trees left out of rankings with no eviction candidates'),
     CacheStat('cache_eviction_server_skip_checkpointing_trees', 'eviction server skips trees that are being checkpointed'),
     CacheStat('cache_eviction_server_skip_dirty_pages_during_checkpoint', 'eviction server skips dirty pages during a running checkpoint'),
     CacheStat('cache_eviction_server_skip_pages_retry', 'eviction server skips pages that previously failed eviction and likely will again'),
@@ -345,8 +379,11 @@ conn_stats = [
     CacheStat('cache_eviction_server_skip_metatdata_with_history', 'eviction server skips metadata pages with history'),
     CacheStat('cache_eviction_server_skip_trees_eviction_disabled', 'eviction server skips trees that disable eviction'),
     CacheStat('cache_eviction_server_skip_trees_not_useful_before', 'eviction server skips trees that were not useful before'),
+    CacheStat('cache_eviction_server_skip_trees_reserved', 'eviction server skips trees that are using less than their cache reservation'),
     CacheStat('cache_eviction_server_skip_trees_stick_in_cache', 'eviction server skips trees that are configured to stick in cache'),
     CacheStat('cache_eviction_server_skip_trees_too_many_active_walks', 'eviction server skips trees because there are too many active walks'),
+    CacheStat('cache_eviction_server_skip_trees_under_quota', 'eviction server skips trees that are within their cache quota while enforcing quotas'),
+    CacheStat('cache_eviction_server_skip_frequent_pages', 'eviction server skips frequently accessed pages'),
     CacheStat('cache_eviction_server_skip_unwanted_pages', 'eviction server skips pages that we do not want to evict'),
     CacheStat('cache_eviction_server_skip_unwanted_tree', 'eviction server skips tree that we do not want to evict'),
     CacheStat('cache_eviction_server_slept', 'eviction server slept, because we did not make progress with eviction'),
@@ -378,6 +415,11 @@ conn_stats = [
     CacheStat('cache_pages_inuse', 'pages currently held in the cache', 'no_clear,no_scale'),
     CacheStat('cache_read_app_count', 'application threads page read from disk to cache count'),
     CacheStat('cache_read_app_time', 'application threads page read from disk to cache time (usecs)'),
+    CacheStat('cache_slab_allocated', 'slabs allocated for page images'),
+    CacheStat('cache_slab_bytes', 'bytes in slabs allocated for page images', 'no_clear,no_scale,size'),
+    CacheStat('cache_slab_bytes_inuse', 'bytes in slab chunks holding page images', 'no_clear,no_scale,size'),
+    CacheStat('cache_slab_bytes_requested', 'bytes of page images held in slab chunks', 'no_clear,no_scale,size'),
+    CacheStat('cache_slab_freed', 'slabs freed for page images'),
     CacheStat('cache_timed_out_ops', 'operations timed out waiting for space in cache'),
     CacheStat('cache_write_app_count', 'application threads page write from cache to disk count'),
     CacheStat('cache_write_app_time', 'application threads page write from cache to disk time (usecs)'),
@@ -464,6 +506,9 @@ conn_stats = [
     ChunkCacheStat('chunkcache_created_from_metadata', 'total number of chunks inserted on startup from persisted metadata.'),
     ChunkCacheStat('chunkcache_exceeded_bitmap_capacity', 'could not allocate due to exceeding bitmap capacity'),
     ChunkCacheStat('chunkcache_exceeded_capacity', 'could not allocate due to exceeding capacity'),
+    ChunkCacheStat('chunkcache_hits_flushed', 'number of hits on chunks cached from flushed tables'),
+    ChunkCacheStat('chunkcache_hits_metadata', 'number of hits on chunks cached from persisted metadata'),
+    ChunkCacheStat('chunkcache_hits_read', 'number of hits on chunks cached by reads'),
     ChunkCacheStat('chunkcache_io_failed', 'number of times a read from storage failed'),
     ChunkCacheStat('chunkcache_lookups', 'lookups'),
     ChunkCacheStat('chunkcache_metadata_inserted', 'number of metadata entries inserted'),
@@ -475,6 +520,8 @@ conn_stats = [
     ChunkCacheStat('chunkcache_retries', 'retried accessing a chunk while I/O was in progress'),
     ChunkCacheStat('chunkcache_retries_checksum_mismatch', 'retries from a chunk cache checksum mismatch'),
     ChunkCacheStat('chunkcache_spans_chunks_read', 'aggregate number of spanned chunks on read'),
+    ChunkCacheStat('chunkcache_tinylfu_admitted', 'chunks admitted to the main region by the TinyLFU policy'),
+    ChunkCacheStat('chunkcache_tinylfu_rejected', 'chunks rejected from the main region by the TinyLFU policy'),
     ChunkCacheStat('chunkcache_toomany_retries', 'timed out due to too many retries'),
 
     ##########################################
@@ -622,6 +669,13 @@ conn_stats = [
     ##########################################
     # Performance Histogram Stats
     ##########################################
+    PerfHistStat('perf_hist_evictapp_latency_gt10000', 'application thread eviction latency histogram (bucket 6) - 10000us+'),
+    PerfHistStat('perf_hist_evictapp_latency_lt100', 'application thread eviction latency histogram (bucket 1) - 0-100us'),
+    PerfHistStat('perf_hist_evictapp_latency_lt250', 'application thread eviction latency histogram (bucket 2) - 100-249us'),
+    PerfHistStat('perf_hist_evictapp_latency_lt500', 'application thread eviction latency histogram (bucket 3) - 250-499us'),
+    PerfHistStat('perf_hist_evictapp_latency_lt1000', 'application thread eviction latency histogram (bucket 4) - 500-999us'),
+    PerfHistStat('perf_hist_evictapp_latency_lt10000', 'application thread eviction latency histogram (bucket 5) - 1000-9999us'),
+    PerfHistStat('perf_hist_evictapp_latency_total_usecs', 'application thread eviction latency histogram total (usecs)'),
     PerfHistStat('perf_hist_fsread_latency_gt1000', 'file system read latency histogram (bucket 7) - 1000ms+'),
     PerfHistStat('perf_hist_fsread_latency_lt10', 'file system read latency histogram (bucket 1) - 0-10ms'),
     PerfHistStat('perf_hist_fsread_latency_lt50', 'file system read latency histogram (bucket 2) - 10-49ms'),
@@ -661,6 +715,7 @@ conn_stats = [
     PrefetchStat('prefetch_pages_queued', 'pre-fetch pages queued'),
     PrefetchStat('prefetch_failed_start', 'number of times pre-fetch failed to start'),
     PrefetchStat('prefetch_pages_read', 'pre-fetch pages read in background'),
+    PrefetchStat('prefetch_pages_read_batch', 'pre-fetch pages read from a batched block read'),
     PrefetchStat('prefetch_skipped', 'pre-fetch not triggered by page read'),
     PrefetchStat('prefetch_skipped_disk_read_count', 'pre-fetch not triggered due to disk read count'),
     PrefetchStat('prefetch_skipped_error_ok', 'pre-fetch skipped reading in a page due to harmless error'),
@@ -814,6 +869,15 @@ dsrc_stats = [
     ##########################################
     BlockStat('allocation_size', 'file allocation unit size', 'max_aggregate,no_scale,size'),
     BlockStat('block_alloc', 'blocks allocated'),
+    BlockStat('block_alloc_segregated_extend', 'allocations extending the file to keep size classes segregated'),
+    BlockStat('block_avail_1mb', 'available extents larger than 32KB, up to 1MB', 'no_scale'),
+    BlockStat('block_avail_1mb_bytes', 'available bytes in extents larger than 32KB, up to 1MB', 'no_scale,size'),
+    BlockStat('block_avail_32kb', 'available extents larger than 4KB, up to 32KB', 'no_scale'),
+    BlockStat('block_avail_32kb_bytes', 'available bytes in extents larger than 4KB, up to 32KB', 'no_scale,size'),
+    BlockStat('block_avail_4kb', 'available extents of 4KB or less', 'no_scale'),
+    BlockStat('block_avail_4kb_bytes', 'available bytes in extents of 4KB or less', 'no_scale,size'),
+    BlockStat('block_avail_large', 'available extents larger than 1MB', 'no_scale'),
+    BlockStat('block_avail_large_bytes', 'available bytes in extents larger than 1MB', 'no_scale,size'),
     BlockStat('block_checkpoint_size', 'checkpoint size', 'no_scale,size'),
     BlockStat('block_extension', 'allocations requiring file extension'),
     BlockStat('block_free', 'blocks freed'),
@@ -835,6 +899,7 @@ dsrc_stats = [
     BtreeStat('btree_column_rle', 'column-store variable-size RLE encoded values', 'no_scale,tree_walk'),
     BtreeStat('btree_column_tws', 'column-store fixed-size time windows', 'no_scale,tree_walk'),
     BtreeStat('btree_column_variable', 'column-store variable-size leaf pages', 'no_scale,tree_walk'),
+    BtreeStat('btree_compact_bytes_rewritten', 'btree compact bytes rewritten', 'no_clear,no_scale'),
     BtreeStat('btree_compact_bytes_rewritten_expected', 'btree expected number of compact bytes rewritten', 'no_clear,no_scale'),
     BtreeStat('btree_compact_pages_reviewed', 'btree compact pages reviewed', 'no_clear,no_scale'),
     BtreeStat('btree_compact_pages_rewritten', 'btree compact pages rewritten', 'no_clear,no_scale'),
@@ -856,6 +921,8 @@ dsrc_stats = [
     ##########################################
     # Cache and eviction statistics
     ##########################################
+    CacheStat('cache_bytes_quota', 'cache quota configured for the object', 'no_clear,no_scale,size'),
+    CacheStat('cache_bytes_reserve', 'cache reservation configured for the object', 'no_clear,no_scale,size'),
     CacheStat('cache_eviction_fail', 'data source pages selected for eviction unable to be evicted'),
     CacheStat('cache_eviction_walk_passes', 'eviction walk passes of a file'),
 
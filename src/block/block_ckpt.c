@@ -303,6 +303,9 @@ __wt_block_checkpoint(
     /* Process the checkpoint list, deleting and updating as required. */
     ret = __ckpt_process(session, block, ckptbase);
 
+    /* Write any pending combined checkpoint write, the upper layers will sync the file. */
+    WT_TRET(__wt_block_write_combine_flush(session, block));
+
     /* Discard any excessive memory we've allocated. */
     WT_TRET(__wti_block_ext_discard(session, 250));
 
@@ -40,7 +40,7 @@ __wt_block_compact_start(WT_SESSION_IMPL *session, WT_BLOCK *block)
     block->compact_prev_size = 0;
     block->compact_session_id = session->id;
 
-    if (session == S2C(session)->background_compact.session)
+    if (F_ISSET(session, WT_SESSION_BACKGROUND_COMPACT))
         WT_RET(__wt_background_compact_start(session));
 
     return (0);
@@ -67,7 +67,7 @@ __wt_block_compact_end(WT_SESSION_IMPL *session, WT_BLOCK *block)
         __wt_spin_unlock(session, &block->live_lock);
     }
 
-    if (session == S2C(session)->background_compact.session)
+    if (F_ISSET(session, WT_SESSION_BACKGROUND_COMPACT))
         WT_RET(__wt_background_compact_end(session));
 
     return (0);
@@ -87,6 +87,7 @@ __wt_block_compact_get_progress_stats(
     block = bm->block;
     *pages_reviewedp = block->compact_pages_reviewed;
 
+    WT_STAT_DSRC_SET(session, btree_compact_bytes_rewritten, block->compact_bytes_rewritten);
     WT_STAT_DSRC_SET(
       session, btree_compact_bytes_rewritten_expected, block->compact_bytes_rewritten_expected);
     WT_STAT_DSRC_SET(session, btree_compact_pages_reviewed, block->compact_pages_reviewed);
@@ -127,6 +127,35 @@ __block_size_srch(WT_SIZE **head, wt_off_t size, WT_SIZE ***stack)
             stack[i--] = szp--;
 }
 
+/*
+ * __block_segregated_srch --
+ *     Search the by-size skiplist for an extent in the same size class as the request, falling back
+ *     to the smallest extent in the largest size class.
+ */
+static WT_INLINE WT_SIZE *
+__block_segregated_srch(WT_SIZE **head, wt_off_t size, bool *skippedp)
+{
+    WT_SIZE **sstack[WT_SKIP_MAXDEPTH], *szp;
+
+    *skippedp = false;
+
+    /* Best-fit, as long as the extent is in the request's size class. */
+    __block_size_srch(head, size, sstack);
+    if ((szp = *sstack[0]) == NULL ||
+      __wt_block_size_class(szp->size) == __wt_block_size_class(size))
+        return (szp);
+
+    /*
+     * Extents in the largest class are large runs of free space, splitting them doesn't prevent
+     * reuse by requests of any size. Extents in the classes between are left for requests of their
+     * own size.
+     */
+    __block_size_srch(head, WT_MEGABYTE + 1, sstack);
+    if ((szp = *sstack[0]) == NULL)
+        *skippedp = true;
+    return (szp);
+}
+
 /*
  * __block_off_srch_pair --
  *     Search a by-offset skiplist for before/after records of the specified offset.
@@ -199,6 +228,10 @@ __block_ext_insert(WT_SESSION_IMPL *session, WT_EXTLIST *el, WT_EXT *ext)
             ext->next[i + ext->depth] = *astack[i];
             *astack[i] = ext;
         }
+
+        i = __wt_block_size_class(ext->size);
+        ++el->class_entries[i];
+        el->class_bytes[i] += (uint64_t)ext->size;
     }
 #ifdef HAVE_DIAGNOSTIC
     if (!el->track_size)
@@ -364,6 +397,10 @@ __block_off_remove(
                 *sstack[i] = szp->next[i];
             __wti_block_size_free(session, szp);
         }
+
+        i = __wt_block_size_class(ext->size);
+        --el->class_entries[i];
+        el->class_bytes[i] -= (uint64_t)ext->size;
     }
 #ifdef HAVE_DIAGNOSTIC
     if (!el->track_size) {
@@ -530,6 +567,7 @@ __wti_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_
     WT_EXT **estack[WT_SKIP_MAXDEPTH], *ext;
     WT_EXTLIST *el;
     WT_SIZE **sstack[WT_SKIP_MAXDEPTH], *szp;
+    bool skipped;
 
     /* The live lock must be locked. */
     WT_ASSERT_SPINLOCK_OWNED(session, &block->live_lock);
@@ -555,6 +593,9 @@ __wti_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_
      * on the by-size offset list. This means we prefer best-fit over lower offset, but within a
      * size we'll prefer an offset appearing earlier in the file.
      *
+     * If it's segregated by size class, it's best-fit, but we extend the file rather than split an
+     * extent from a larger size class, so blocks of similar sizes are placed together.
+     *
      * If we don't have anything big enough, extend the file.
      */
     if (block->live.avail.bytes < (uint64_t)size)
@@ -564,8 +605,15 @@ __wti_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_
             goto append;
         ext = *estack[0];
     } else {
-        __block_size_srch(block->live.avail.sz, size, sstack);
-        if ((szp = *sstack[0]) == NULL) {
+        if (block->allocsegregated) {
+            szp = __block_segregated_srch(block->live.avail.sz, size, &skipped);
+            if (skipped)
+                WT_STAT_DSRC_INCR(session, block_alloc_segregated_extend);
+        } else {
+            __block_size_srch(block->live.avail.sz, size, sstack);
+            szp = *sstack[0];
+        }
+        if (szp == NULL) {
 append:
             el = &block->live.alloc;
             WT_RET(__block_extend(session, block, el, offp, size));
@@ -933,6 +981,184 @@ __block_ext_overlap(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *ael,
     return (0);
 }
 
+/*
+ * WT_EXTLIST_MERGE_WALK_MIN --
+ *	Merging an extent list into another normally searches the target list for each extent being
+ * merged. Once the list being merged is a reasonable fraction of the target list's size, it's
+ * cheaper to walk both lists in offset order and rebuild the target list. Rebuilding a by-size
+ * skiplist isn't free, lists tracking sizes require a larger fraction.
+ */
+#define WT_EXTLIST_MERGE_WALK_MIN 32
+#define WT_EXTLIST_MERGE_WALK(a, b)               \
+    ((a)->entries >= WT_EXTLIST_MERGE_WALK_MIN && \
+      (a)->entries >= (b)->entries / ((b)->track_size ? 2 : 8))
+
+/*
+ * __block_size_rebuild --
+ *     Rebuild an extent list's by-size skiplist from its by-offset skiplist.
+ */
+static int
+__block_size_rebuild(WT_SESSION_IMPL *session, WT_EXTLIST *el)
+{
+    WT_DECL_RET;
+    WT_EXT **astack[WT_SKIP_MAXDEPTH], *ext, *next, **pred[WT_SKIP_MAXDEPTH];
+    WT_SIZE **sstack[WT_SKIP_MAXDEPTH], *szp;
+    u_int i;
+
+    for (i = 0; i < WT_SKIP_MAXDEPTH; ++i)
+        pred[i] = &el->off[i];
+    WT_CLEAR(el->class_entries);
+    WT_CLEAR(el->class_bytes);
+
+    for (ext = el->off[0]; ext != NULL; ext = next) {
+        next = ext->next[0];
+
+        __block_size_srch(el->sz, ext->size, sstack);
+        szp = *sstack[0];
+        if (szp == NULL || szp->size != ext->size) {
+            /*
+             * If we can't allocate a size structure, remove the extent from the by-offset list as
+             * well, the lists must match. The space is leaked, the same as a failed insert.
+             */
+            if (ret != 0 || (ret = __wti_block_size_alloc(session, &szp)) != 0) {
+                for (i = 0; i < ext->depth; ++i)
+                    *pred[i] = ext->next[i];
+                --el->entries;
+                el->bytes -= (uint64_t)ext->size;
+                if (el->last == ext)
+                    el->last = NULL;
+                __wti_block_ext_free(session, ext);
+                continue;
+            }
+            szp->size = ext->size;
+            szp->depth = ext->depth;
+            for (i = 0; i < ext->depth; ++i) {
+                szp->next[i] = *sstack[i];
+                *sstack[i] = szp;
+            }
+        }
+
+        /* Insert the extent into the size element's offset skiplist. */
+        __block_off_srch(szp->off, ext->off, astack, true);
+        for (i = 0; i < ext->depth; ++i) {
+            ext->next[i + ext->depth] = *astack[i];
+            *astack[i] = ext;
+        }
+
+        i = __wt_block_size_class(ext->size);
+        ++el->class_entries[i];
+        el->class_bytes[i] += (uint64_t)ext->size;
+
+        for (i = 0; i < ext->depth; ++i)
+            pred[i] = &ext->next[i];
+    }
+    return (ret);
+}
+
+/*
+ * __block_extlist_merge_walk --
+ *     Merge one extent list into another by walking both lists in offset order, coalescing adjacent
+ *     extents and appending them to a rebuilt target list.
+ */
+static int
+__block_extlist_merge_walk(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *a, WT_EXTLIST *b)
+{
+    WT_DECL_RET;
+    WT_EXT *aext, *bext, *ext, *last, **tail[WT_SKIP_MAXDEPTH];
+    WT_SIZE *next, *szp;
+    wt_off_t off, size;
+    u_int i;
+
+    /*
+     * Check for overlapping ranges before changing anything: both lists are sorted by offset, so
+     * it's only necessary to check each extent against the next extent in the other list.
+     */
+    for (aext = a->off[0], bext = b->off[0]; aext != NULL && bext != NULL;)
+        if (aext->off < bext->off) {
+            if (aext->off + aext->size > bext->off)
+                WT_BLOCK_RET(session, block, EINVAL,
+                  "%s: merge range %" PRIdMAX "-%" PRIdMAX " overlaps with existing range %" PRIdMAX
+                  "-%" PRIdMAX,
+                  b->name, (intmax_t)aext->off, (intmax_t)(aext->off + aext->size),
+                  (intmax_t)bext->off, (intmax_t)(bext->off + bext->size));
+            aext = aext->next[0];
+        } else {
+            if (bext->off + bext->size > aext->off)
+                WT_BLOCK_RET(session, block, EINVAL,
+                  "%s: existing range %" PRIdMAX "-%" PRIdMAX " overlaps with merge range %" PRIdMAX
+                  "-%" PRIdMAX,
+                  b->name, (intmax_t)bext->off, (intmax_t)(bext->off + bext->size),
+                  (intmax_t)aext->off, (intmax_t)(aext->off + aext->size));
+            bext = bext->next[0];
+        }
+
+    /*
+     * Extents change size as they're coalesced, discard the by-size skiplist, it's rebuilt once
+     * the by-offset skiplist is complete. Cached size structures must have empty offset lists.
+     */
+    if (b->track_size) {
+        for (szp = b->sz[0]; szp != NULL; szp = next) {
+            next = szp->next[0];
+            memset(szp->off, 0, sizeof(szp->off));
+            __wti_block_size_free(session, szp);
+        }
+        memset(b->sz, 0, sizeof(b->sz));
+    }
+
+    /* Detach the target list's extents, then append the merged extents in offset order. */
+    bext = b->off[0];
+    for (i = 0; i < WT_SKIP_MAXDEPTH; ++i) {
+        b->off[i] = NULL;
+        tail[i] = &b->off[i];
+    }
+    b->bytes = 0;
+    b->entries = 0;
+    for (aext = a->off[0], last = NULL; aext != NULL || bext != NULL;) {
+        if (bext != NULL && (aext == NULL || bext->off < aext->off)) {
+            ext = bext;
+            bext = bext->next[0];
+            b->bytes += (uint64_t)ext->size;
+            if (last != NULL && last->off + last->size == ext->off) {
+                last->size += ext->size;
+                __wti_block_ext_free(session, ext);
+                continue;
+            }
+        } else {
+            off = aext->off;
+            size = aext->size;
+            aext = aext->next[0];
+
+            /* If an allocation failed, finish rebuilding the list without the remaining extents. */
+            if (ret != 0)
+                continue;
+            if (last != NULL && last->off + last->size == off) {
+                last->size += size;
+                b->bytes += (uint64_t)size;
+                continue;
+            }
+            if ((ret = __wti_block_ext_alloc(session, &ext)) != 0)
+                continue;
+            ext->off = off;
+            ext->size = size;
+            b->bytes += (uint64_t)size;
+        }
+
+        for (i = 0; i < ext->depth; ++i) {
+            *tail[i] = ext;
+            tail[i] = &ext->next[i];
+        }
+        ++b->entries;
+        last = ext;
+    }
+    for (i = 0; i < WT_SKIP_MAXDEPTH; ++i)
+        *tail[i] = NULL;
+    b->last = last;
+
+    if (b->track_size)
+        WT_TRET(__block_size_rebuild(session, b));
+    return (ret);
+}
+
 /*
  * __wti_block_extlist_merge --
  *     Merge one extent list into another.
@@ -968,6 +1194,21 @@ __wti_block_extlist_merge(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST
             a->sz[i] = b->sz[i];
             b->sz[i] = tmp.sz[i];
         }
+        for (i = 0; i < WT_BLOCK_SIZE_CLASSES; i++) {
+            a->class_entries[i] = b->class_entries[i];
+            b->class_entries[i] = tmp.class_entries[i];
+            a->class_bytes[i] = b->class_bytes[i];
+            b->class_bytes[i] = tmp.class_bytes[i];
+        }
+    }
+
+    /*
+     * If the list we're merging is a reasonable fraction of the size of the other list, walk the
+     * lists in offset order rather than searching for each extent.
+     */
+    if (WT_EXTLIST_MERGE_WALK(a, b)) {
+        WT_STAT_CONN_INCR(session, block_extlist_merge_walk);
+        return (__block_extlist_merge_walk(session, block, a, b));
     }
 
     WT_EXT_FOREACH (ext, a->off)
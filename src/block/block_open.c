@@ -130,11 +130,17 @@ __wt_block_close(WT_SESSION_IMPL *session, WT_BLOCK *block)
     /* We shouldn't have any read requests in progress. */
     WT_ASSERT(session, block->read_count == 0);
 
+    /* Write any pending combined write, there shouldn't be one outside of a checkpoint. */
+    if (block->fh != NULL)
+        WT_TRET(__wt_block_write_combine_flush(session, block));
+    __wt_buf_free(session, &block->write_combine_buf);
+
     __wt_free(session, block->name);
 
     WT_TRET(__wt_close(session, &block->fh));
 
     __wt_spin_destroy(session, &block->live_lock);
+    __wt_spin_destroy(session, &block->write_combine_lock);
     __wti_block_ckpt_destroy(session, &block->live);
 
     __wt_overwrite_and_free(session, block);
@@ -211,6 +217,7 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename, uint32_t objecti
 
     WT_ERR(__wt_config_gets(session, cfg, "block_allocation", &cval));
     block->allocfirst = WT_CONFIG_LIT_MATCH("first", cval) ? 1 : 0;
+    block->allocsegregated = WT_CONFIG_LIT_MATCH("segregated", cval);
 
     /* Configuration: optional OS buffer cache maximum size. */
     WT_ERR(__wt_config_gets(session, cfg, "os_cache_max", &cval));
@@ -220,6 +227,10 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename, uint32_t objecti
     WT_ERR(__wt_config_gets(session, cfg, "os_cache_dirty_max", &cval));
     block->os_cache_dirty_max = (size_t)cval.val;
 
+    /* Configuration: optional combined checkpoint write size. */
+    WT_ERR(__wt_config_gets(session, cfg, "write_combine_max", &cval));
+    block->write_combine_max = (size_t)cval.val;
+
     /* Set the file extension information. */
     block->extend_len = conn->data_extend_len;
 
@@ -263,6 +274,7 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename, uint32_t objecti
 
     /* Initialize the live checkpoint's lock. */
     WT_ERR(__wt_spin_init(session, &block->live_lock, "block manager"));
+    WT_ERR(__wt_spin_init(session, &block->write_combine_lock, "block write combine"));
 
     /*
      * Read the description information from the first block.
@@ -468,6 +480,18 @@ __wt_block_stat(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_DSRC_STATS *stats)
     WT_STAT_WRITE(session, stats, block_minor, WT_BLOCK_MINOR_VERSION);
     WT_STAT_WRITE(session, stats, block_reuse_bytes, (int64_t)block->live.avail.bytes);
     WT_STAT_WRITE(session, stats, block_size, block->size);
+
+    /* Per-size class counts of the extents available for reuse. */
+    WT_STAT_WRITE(session, stats, block_avail_4kb, block->live.avail.class_entries[0]);
+    WT_STAT_WRITE(session, stats, block_avail_4kb_bytes, (int64_t)block->live.avail.class_bytes[0]);
+    WT_STAT_WRITE(session, stats, block_avail_32kb, block->live.avail.class_entries[1]);
+    WT_STAT_WRITE(
+      session, stats, block_avail_32kb_bytes, (int64_t)block->live.avail.class_bytes[1]);
+    WT_STAT_WRITE(session, stats, block_avail_1mb, block->live.avail.class_entries[2]);
+    WT_STAT_WRITE(session, stats, block_avail_1mb_bytes, (int64_t)block->live.avail.class_bytes[2]);
+    WT_STAT_WRITE(session, stats, block_avail_large, block->live.avail.class_entries[3]);
+    WT_STAT_WRITE(
+      session, stats, block_avail_large_bytes, (int64_t)block->live.avail.class_bytes[3]);
 }
 
 /*
@@ -58,6 +58,173 @@ err:
     return (ret);
 }
 
+/*
+ * __block_read_coalesce --
+ *     Read a batch of blocks, reading blocks adjacent in the file with a single I/O and copying
+ *     them into their buffers.
+ */
+static int
+__block_read_coalesce(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_IO_REQ *ioreqs, u_int nreqs)
+{
+    WT_DECL_RET;
+    WT_IO_REQ *req, *run, *runs;
+    WT_ITEM **runbufs;
+    u_int *first, *order, i, j, nruns, r;
+
+    first = order = NULL;
+    runs = NULL;
+    runbufs = NULL;
+    nruns = 0;
+
+    /* Order the requests by file offset, batches are small so an insertion sort is fine. */
+    WT_ERR(__wt_calloc_def(session, nreqs, &order));
+    for (i = 0; i < nreqs; ++i) {
+        for (j = i; j > 0 && ioreqs[order[j - 1]].offset > ioreqs[i].offset; --j)
+            order[j] = order[j - 1];
+        order[j] = i;
+    }
+
+    /* Group the requests into runs of adjacent blocks. */
+    WT_ERR(__wt_calloc_def(session, nreqs + 1, &first));
+    WT_ERR(__wt_calloc_def(session, nreqs, &runs));
+    WT_ERR(__wt_calloc_def(session, nreqs, &runbufs));
+    for (i = 0; i < nreqs; ++i) {
+        req = &ioreqs[order[i]];
+        run = nruns == 0 ? NULL : &runs[nruns - 1];
+        if (run != NULL && run->offset + (wt_off_t)run->len == req->offset &&
+          run->len + req->len <= WT_BLOCK_READ_COALESCE_MAX)
+            run->len += req->len;
+        else {
+            first[nruns] = i;
+            runs[nruns].offset = req->offset;
+            runs[nruns].len = req->len;
+            runs[nruns].buf = req->buf;
+            ++nruns;
+        }
+    }
+    first[nruns] = nreqs;
+
+    /* Runs of more than one block are read into a separate buffer. */
+    for (r = 0; r < nruns; ++r) {
+        if (first[r + 1] - first[r] == 1)
+            continue;
+        WT_ERR(__wt_bufpool_get(session, runs[r].len, &runbufs[r]));
+        runs[r].buf = runbufs[r]->mem;
+        WT_STAT_CONN_INCR(session, block_read_coalesce);
+        WT_STAT_CONN_INCRV(session, block_read_coalesce_blocks, first[r + 1] - first[r]);
+    }
+
+    WT_ERR(__wt_read_batch(session, block->fh, runs, nruns));
+
+    for (r = 0; r < nruns; ++r)
+        for (i = first[r]; i < first[r + 1]; ++i) {
+            req = &ioreqs[order[i]];
+            req->error = runs[r].error;
+            if (runbufs[r] != NULL && req->error == 0)
+                memcpy(req->buf, (uint8_t *)runs[r].buf + (req->offset - runs[r].offset), req->len);
+        }
+
+err:
+    if (runbufs != NULL)
+        for (r = 0; r < nruns; ++r)
+            __wt_bufpool_put(session, &runbufs[r]);
+    __wt_free(session, runbufs);
+    __wt_free(session, runs);
+    __wt_free(session, first);
+    __wt_free(session, order);
+    return (ret);
+}
+
+/*
+ * __wt_bm_read_batch --
+ *     Read a batch of address cookie referenced blocks into their buffers. Blocks that aren't
+ *     returned (because they couldn't be read or failed checksum verification), are not flagged
+ *     valid: the caller is expected to read them through the normal path, which handles retries
+ *     and error reporting.
+ */
+int
+__wt_bm_read_batch(WT_BM *bm, WT_SESSION_IMPL *session, WT_BLOCK_READ_REQ *reqs, u_int nreqs)
+{
+    WT_BLOCK *block;
+    WT_BLOCK_HEADER *blk, swap;
+    WT_DECL_RET;
+    WT_IO_REQ *ioreqs;
+    WT_ITEM *buf;
+    wt_off_t offset;
+    size_t check_size;
+    uint32_t checksum, objectid, size;
+    u_int i;
+
+    block = bm->block;
+    ioreqs = NULL;
+
+    for (i = 0; i < nreqs; ++i)
+        reqs[i].valid = false;
+
+    /*
+     * Batched reads don't go through the chunk cache, and only handle trees backed by a single
+     * file.
+     */
+    if (nreqs == 0 || bm->is_multi_handle ||
+      F_ISSET(&S2C(session)->chunkcache, WT_CHUNKCACHE_CONFIGURED))
+        return (0);
+
+    WT_RET(__wt_calloc_def(session, nreqs, &ioreqs));
+    for (i = 0; i < nreqs; ++i) {
+        WT_ERR(__wt_block_addr_unpack(
+          session, block, reqs[i].addr, reqs[i].addr_size, &objectid, &offset, &size, &checksum));
+        /* Leave impossible block sizes for the normal read path to report. */
+        if (size < block->allocsize)
+            goto err;
+        WT_ERR(__wti_block_write_combine_overlap(session, block, offset, size));
+
+        /* Buffers must be aligned for reading, see the comment in __wti_block_read_off. */
+        buf = reqs[i].buf;
+        if (!F_ISSET(buf, WT_ITEM_ALIGNED)) {
+            F_SET(buf, WT_ITEM_ALIGNED);
+            WT_ERR(__wt_buf_init(session, buf, WT_MAX(size, buf->memsize + 10)));
+        } else
+            WT_ERR(__wt_buf_init(session, buf, size));
+        buf->size = size;
+
+        ioreqs[i].offset = offset;
+        ioreqs[i].len = size;
+        ioreqs[i].buf = buf->mem;
+        __wt_capacity_throttle(session, size, WT_THROTTLE_READ);
+    }
+
+    WT_STAT_CONN_INCR(session, block_read_batch);
+    WT_STAT_CONN_INCRV(session, block_read_batch_blocks, nreqs);
+    WT_ERR(__block_read_coalesce(session, block, ioreqs, nreqs));
+
+    for (i = 0; i < nreqs; ++i) {
+        if (ioreqs[i].error != 0)
+            continue;
+        WT_ERR(__wt_block_addr_unpack(
+          session, block, reqs[i].addr, reqs[i].addr_size, &objectid, &offset, &size, &checksum));
+
+        buf = reqs[i].buf;
+        blk = WT_BLOCK_HEADER_REF(buf->mem);
+        __wt_block_header_byteswap_copy(blk, &swap);
+        if (swap.checksum != checksum)
+            continue;
+        check_size = F_ISSET(&swap, WT_BLOCK_DATA_CKSUM) ? size : WT_BLOCK_COMPRESS_SKIP;
+        blk->checksum = 0;
+        if (!__wt_checksum_match(buf->mem, check_size, checksum))
+            continue;
+        __wt_page_header_byteswap(buf->mem);
+        reqs[i].valid = true;
+
+        WT_STAT_CONN_INCR(session, block_read);
+        WT_STAT_CONN_INCRV(session, block_byte_read, size);
+        WT_ERR(__wti_block_discard(session, block, (size_t)size));
+    }
+
+err:
+    __wt_free(session, ioreqs);
+    return (ret);
+}
+
 /*
  * __bm_corrupt_dump --
  *     Dump a block into the log in 1KB chunks.
@@ -206,6 +373,9 @@ __wti_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, ui
     WT_RET(__wt_buf_init(session, buf, bufsize));
     buf->size = size;
 
+    /* The block may still be waiting to be written as part of a combined checkpoint write. */
+    WT_RET(__wti_block_write_combine_overlap(session, block, offset, size));
+
     while (failures < max_failures) {
         full_checksum_mismatch = false;
         if (F_ISSET(&S2C(session)->chunkcache, WT_CHUNKCACHE_CONFIGURED)) {
@@ -23,6 +23,9 @@ __wti_block_truncate(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t len)
     __wt_verbose(
       session, WT_VERB_BLOCK, "truncate file %s to %" PRIuMAX, block->name, (uintmax_t)len);
 
+    /* Write any pending combined write before the file changes size. */
+    WT_RET(__wt_block_write_combine_flush(session, block));
+
     /*
      * Truncate requires serialization, we depend on our caller for that.
      *
@@ -208,6 +211,117 @@ __wt_block_write(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, uint8_
     return (0);
 }
 
+/*
+ * __block_write_combine_flush_locked --
+ *     Write out the pending combined write, the combined write lock must be held.
+ */
+static int
+__block_write_combine_flush_locked(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+    WT_ASSERT_SPINLOCK_OWNED(session, &block->write_combine_lock);
+
+    if (block->write_combine_size == 0)
+        return (0);
+
+    /*
+     * If the write fails, leave it pending: the checkpoint will fail, and a subsequent flush
+     * retries the write.
+     */
+    WT_RET(__wt_write(session, block->fh, block->write_combine_offset, block->write_combine_size,
+      block->write_combine_buf.mem));
+
+    WT_STAT_CONN_INCR(session, block_write_combine);
+    WT_STAT_CONN_INCRV(session, block_write_combine_blocks, block->write_combine_blocks);
+
+    __wt_verbose_debug2(session, WT_VERB_WRITE,
+      "combined write off %" PRIuMAX ", size %" PRIuMAX ", blocks %u",
+      (uintmax_t)block->write_combine_offset, (uintmax_t)block->write_combine_size,
+      block->write_combine_blocks);
+
+    __wt_atomic_storesize(&block->write_combine_size, 0);
+    block->write_combine_blocks = 0;
+    return (0);
+}
+
+/*
+ * __wt_block_write_combine_flush --
+ *     Write out any pending combined write.
+ */
+int
+__wt_block_write_combine_flush(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+    WT_DECL_RET;
+
+    if (__wt_atomic_loadsize(&block->write_combine_size) == 0)
+        return (0);
+
+    __wt_spin_lock(session, &block->write_combine_lock);
+    ret = __block_write_combine_flush_locked(session, block);
+    __wt_spin_unlock(session, &block->write_combine_lock);
+    return (ret);
+}
+
+/*
+ * __wti_block_write_combine_overlap --
+ *     Flush the pending combined write if it overlaps a range of the file we're about to read or
+ *     overwrite.
+ */
+int
+__wti_block_write_combine_overlap(
+  WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t offset, uint32_t size)
+{
+    WT_DECL_RET;
+
+    if (__wt_atomic_loadsize(&block->write_combine_size) == 0)
+        return (0);
+
+    __wt_spin_lock(session, &block->write_combine_lock);
+    if (offset < block->write_combine_offset + (wt_off_t)block->write_combine_size &&
+      block->write_combine_offset < offset + (wt_off_t)size)
+        ret = __block_write_combine_flush_locked(session, block);
+    __wt_spin_unlock(session, &block->write_combine_lock);
+    return (ret);
+}
+
+/*
+ * __block_write_combine --
+ *     Add a block to the pending combined write, first flushing the pending write if the block
+ *     doesn't immediately follow it in the file or there's no room for it. Blocks too large to
+ *     combine are left for our caller to write.
+ */
+static int
+__block_write_combine(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t offset,
+  size_t align_size, const void *mem, bool *combinedp)
+{
+    WT_DECL_RET;
+
+    *combinedp = false;
+
+    if (align_size >= block->write_combine_max)
+        return (0);
+
+    __wt_spin_lock(session, &block->write_combine_lock);
+    if (block->write_combine_size != 0 &&
+      (offset != block->write_combine_offset + (wt_off_t)block->write_combine_size ||
+        block->write_combine_size + align_size > block->write_combine_max))
+        WT_ERR(__block_write_combine_flush_locked(session, block));
+
+    if (block->write_combine_buf.memsize < block->write_combine_max) {
+        F_SET(&block->write_combine_buf, WT_ITEM_ALIGNED);
+        WT_ERR(__wt_buf_init(session, &block->write_combine_buf, block->write_combine_max));
+    }
+    if (block->write_combine_size == 0)
+        block->write_combine_offset = offset;
+    memcpy((uint8_t *)block->write_combine_buf.mem + block->write_combine_size, mem, align_size);
+    ++block->write_combine_blocks;
+    __wt_atomic_storesize(&block->write_combine_size, block->write_combine_size + align_size);
+    *combinedp = true;
+
+err:
+    __wt_spin_unlock(session, &block->write_combine_lock);
+    return (ret);
+}
+
 /*
  * __block_write_off --
  *     Write a buffer into a block, returning the block's offset, size and checksum.
@@ -223,7 +337,7 @@ __block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, wt_of
     size_t align_size;
     uint32_t checksum;
     uint8_t *file_sizep;
-    bool local_locked;
+    bool combined, local_locked;
 
     *offsetp = 0;   /* -Werror=maybe-uninitialized */
     *sizep = 0;     /* -Werror=maybe-uninitialized */
@@ -327,8 +441,23 @@ __block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, wt_of
     blk->checksum = __wt_bswap32(blk->checksum);
 #endif
 
-    /* Write the block. */
-    if ((ret = __wt_write(session, fh, offset, align_size, buf->mem)) != 0) {
+    /*
+     * Write the block. Checkpoint writes are optionally gathered with adjacent blocks and written
+     * later, in a single call.
+     */
+    combined = false;
+    if (checkpoint_io && block->write_combine_max != 0)
+        ret = __block_write_combine(session, block, offset, align_size, buf->mem, &combined);
+    if (ret == 0 && !combined) {
+        /*
+         * Blocks freed during a checkpoint can be reallocated before the pending combined write is
+         * flushed, don't let the pending write overwrite the new block.
+         */
+        ret = __wti_block_write_combine_overlap(session, block, offset, (uint32_t)align_size);
+        if (ret == 0)
+            ret = __wt_write(session, fh, offset, align_size, buf->mem);
+    }
+    if (ret != 0) {
         if (!caller_locked)
             __wt_spin_lock(session, &block->live_lock);
         WT_TRET(
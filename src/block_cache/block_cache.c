@@ -178,6 +178,20 @@ __blkcache_should_evict(WT_SESSION_IMPL *session, WT_BLKCACHE_ITEM *blkcache_ite
         return (false);
     }
 
+    /*
+     * A victim cache evicts blocks in least recently evicted order. The blocks of pages still in
+     * the cache become the most recently evicted blocks when their page is evicted, they are only
+     * evicted once all older blocks are gone.
+     */
+    if (blkcache->victim_cache) {
+        if (blkcache_item->evict_gen == 0 ?
+            blkcache->victim_evict_gen >= __wt_atomic_load64(&blkcache->victim_gen) :
+            blkcache_item->evict_gen <= blkcache->victim_evict_gen)
+            return (true);
+        *reason = WT_BLKCACHE_NOT_EVICTION_CANDIDATE;
+        return (false);
+    }
+
     /*
      * Evict if the block has not been accessed for the amount of time corresponding to the evict
      * aggressive setting. Within the category of blocks that fit this criterion, choose those with
@@ -201,7 +215,8 @@ __blkcache_eviction_thread(void *arg)
     WT_BLKCACHE *blkcache;
     WT_BLKCACHE_ITEM *blkcache_item, *blkcache_item_tmp;
     WT_SESSION_IMPL *session;
-    int i, reason;
+    uint64_t excess, victim_bytes[WT_BLKCACHE_VICTIM_BUCKETS], victim_gen, victim_span;
+    int b, i, reason;
     bool no_eviction_candidates;
 
     session = (WT_SESSION_IMPL *)arg;
@@ -238,6 +253,15 @@ __blkcache_eviction_thread(void *arg)
          * evict blocks with the smallest counter before evicting those with a larger one.
          */
         no_eviction_candidates = true;
+
+        /*
+         * In a victim cache, split the eviction generations that remain into ranges and track the
+         * bytes of the blocks in each range, to figure out how far to evict in the next pass.
+         */
+        victim_gen = __wt_atomic_load64(&blkcache->victim_gen);
+        victim_span = (victim_gen - blkcache->victim_evict_gen) / WT_BLKCACHE_VICTIM_BUCKETS + 1;
+        memset(victim_bytes, 0, sizeof(victim_bytes));
+
         for (i = 0; i < (int)blkcache->hash_size; i++) {
             __wt_spin_lock(session, &blkcache->hash_locks[i]);
             TAILQ_FOREACH_SAFE(blkcache_item, &blkcache->hash[i], hashq, blkcache_item_tmp)
@@ -264,6 +288,13 @@ __blkcache_eviction_thread(void *arg)
                     blkcache_item->freq_rec_counter--;
                     if (reason != WT_BLKCACHE_NOT_EVICTION_CANDIDATE)
                         no_eviction_candidates = false;
+                    if (blkcache->victim_cache &&
+                      blkcache_item->evict_gen > blkcache->victim_evict_gen) {
+                        b = (int)WT_MIN(
+                          (blkcache_item->evict_gen - blkcache->victim_evict_gen - 1) / victim_span,
+                          WT_BLKCACHE_VICTIM_BUCKETS - 1);
+                        victim_bytes[b] += blkcache_item->data_size;
+                    }
                 }
             }
             __wt_spin_unlock(session, &blkcache->hash_locks[i]);
@@ -273,6 +304,23 @@ __blkcache_eviction_thread(void *arg)
         if (no_eviction_candidates)
             blkcache->min_num_references += WT_BLKCACHE_MINREF_INCREMENT;
 
+        /*
+         * If a victim cache is still over its target, evict enough of the least recently evicted
+         * blocks in the next pass to get back under it. If that's not enough, the blocks of pages
+         * in the cache are evicted as well.
+         */
+        if (blkcache->victim_cache && blkcache->bytes_used >= blkcache->full_target) {
+            excess = blkcache->bytes_used - blkcache->full_target;
+            for (b = 0; b < WT_BLKCACHE_VICTIM_BUCKETS; ++b) {
+                if (victim_bytes[b] > excess)
+                    break;
+                excess -= victim_bytes[b];
+            }
+            blkcache->victim_evict_gen = b == WT_BLKCACHE_VICTIM_BUCKETS ?
+              victim_gen :
+              WT_MIN(blkcache->victim_evict_gen + (uint64_t)(b + 1) * victim_span, victim_gen);
+        }
+
         WT_STAT_CONN_INCR(session, block_cache_eviction_passes);
     }
     return (WT_THREAD_RET_VALUE);
@@ -326,9 +374,11 @@ __wti_blkcache_get(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_si
     WT_BLKCACHE *blkcache;
     WT_BLKCACHE_ITEM *blkcache_item;
     uint64_t bucket, hash;
+    bool victim_hit;
 
     *foundp = *skip_cache_putp = false;
     *blkcache_retp = NULL;
+    victim_hit = false;
 
     blkcache = &S2C(session)->blkcache;
 
@@ -366,6 +416,12 @@ __wti_blkcache_get(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_si
                 blkcache_item->freq_rec_counter = 0;
             blkcache_item->freq_rec_counter++;
             (void)__wt_atomic_addv32(&blkcache_item->ref_count, 1);
+
+            /* The block's page is being read back into the cache. */
+            if (blkcache_item->evict_gen != 0) {
+                blkcache_item->evict_gen = 0;
+                victim_hit = true;
+            }
             break;
         }
     }
@@ -375,6 +431,8 @@ __wti_blkcache_get(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_si
         *blkcache_retp = blkcache_item;
         *foundp = *skip_cache_putp = true;
         WT_STAT_CONN_INCR(session, block_cache_hits);
+        if (victim_hit)
+            WT_STAT_CONN_INCR(session, block_cache_victim_hits);
         __blkcache_verbose(
           session, WT_VERBOSE_DEBUG_2, "block found in cache", hash, addr, addr_size);
     } else {
@@ -475,6 +533,13 @@ __wti_blkcache_put(
      */
     blkcache_store->freq_rec_counter = 1;
 
+    /*
+     * Blocks loaded on warm restart have no page in the cache, in a victim cache treat them as just
+     * evicted.
+     */
+    if (blkcache->victim_cache && session == blkcache->prewarm_session)
+        blkcache_store->evict_gen = __wt_atomic_add64(&blkcache->victim_gen, 1);
+
     TAILQ_INSERT_HEAD(&blkcache->hash[bucket], blkcache_store, hashq);
 
     (void)__wt_atomic_add64(&blkcache->bytes_used, data->size);
@@ -549,6 +614,518 @@ __wti_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr
     __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
 }
 
+/*
+ * __wt_blkcache_page_evicted --
+ *     A clean page has been evicted from the cache: in a victim cache, make its block the most
+ *     recently evicted.
+ */
+void
+__wt_blkcache_page_evicted(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_ADDR_COPY addr;
+    WT_BLKCACHE *blkcache;
+    WT_BLKCACHE_ITEM *blkcache_item;
+    uint64_t bucket, hash;
+
+    blkcache = &S2C(session)->blkcache;
+    if (blkcache->type == WT_BLKCACHE_UNCONFIGURED || !blkcache->victim_cache)
+        return;
+    if (!__wt_ref_addr_copy(session, ref, &addr))
+        return;
+
+    hash = __wt_hash_city64(addr.addr, addr.size);
+    bucket = hash % blkcache->hash_size;
+    __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
+    TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq)
+        if (blkcache_item->addr_size == addr.size && blkcache_item->fid == S2BT(session)->id &&
+          memcmp(blkcache_item->addr, addr.addr, addr.size) == 0) {
+            blkcache_item->evict_gen = __wt_atomic_add64(&blkcache->victim_gen, 1);
+            break;
+        }
+    __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
+
+    if (blkcache_item != NULL)
+        WT_STAT_CONN_INCR(session, block_cache_victim_retained);
+    else
+        WT_STAT_CONN_INCR(session, block_cache_victim_not_cached);
+}
+
+/*
+ * __blkcache_manifest_cmp_refs --
+ *     Qsort function: sort the manifest entries, most referenced first.
+ */
+static int WT_CDECL
+__blkcache_manifest_cmp_refs(const void *a, const void *b)
+{
+    WT_BLKCACHE_MANIFEST_ENTRY *ae, *be;
+
+    ae = (WT_BLKCACHE_MANIFEST_ENTRY *)a;
+    be = (WT_BLKCACHE_MANIFEST_ENTRY *)b;
+
+    return (ae->refs == be->refs ? 0 : (ae->refs > be->refs ? -1 : 1));
+}
+
+/*
+ * __blkcache_manifest_cmp_offset --
+ *     Qsort function: sort the manifest entries by file ID, then by offset.
+ */
+static int WT_CDECL
+__blkcache_manifest_cmp_offset(const void *a, const void *b)
+{
+    WT_BLKCACHE_MANIFEST_ENTRY *ae, *be;
+
+    ae = (WT_BLKCACHE_MANIFEST_ENTRY *)a;
+    be = (WT_BLKCACHE_MANIFEST_ENTRY *)b;
+
+    if (ae->fid != be->fid)
+        return (ae->fid < be->fid ? -1 : 1);
+    return (ae->offset == be->offset ? 0 : (ae->offset < be->offset ? -1 : 1));
+}
+
+/*
+ * __blkcache_manifest_add --
+ *     Append an entry to a manifest entries array, copying its address cookie into the cookie
+ *     buffer.
+ */
+static int
+__blkcache_manifest_add(WT_SESSION_IMPL *session, WT_BLKCACHE_MANIFEST_ENTRY **entriesp,
+  size_t *allocatedp, size_t *countp, WT_ITEM *cookies, uint32_t fid, uint32_t refs, uint32_t size,
+  const uint8_t *addr, size_t addr_size)
+{
+    WT_BLKCACHE_MANIFEST_ENTRY *entry;
+
+    WT_RET(__wt_realloc_def(session, allocatedp, *countp + 1, entriesp));
+    WT_RET(__wt_buf_grow(session, cookies, cookies->size + addr_size));
+
+    entry = &(*entriesp)[(*countp)++];
+    entry->offset = 0;
+    entry->addr_off = cookies->size;
+    entry->fid = fid;
+    entry->refs = refs;
+    entry->size = size;
+    entry->addr_size = (uint8_t)addr_size;
+
+    memcpy((uint8_t *)cookies->mem + cookies->size, addr, addr_size);
+    cookies->size += addr_size;
+    return (0);
+}
+
+/*
+ * __wt_blkcache_manifest_write --
+ *     Write the warm restart manifest: the most referenced blocks in the cache, up to the cache's
+ *     eviction target, so a restart can read them back into the cache.
+ */
+int
+__wt_blkcache_manifest_write(WT_SESSION_IMPL *session)
+{
+    WT_BLKCACHE *blkcache;
+    WT_BLKCACHE_ITEM *blkcache_item;
+    WT_BLKCACHE_MANIFEST_ENTRY *entries;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(cookies);
+    WT_DECL_ITEM(hex);
+    WT_DECL_RET;
+    WT_FSTREAM *fs;
+    size_t allocated, count, i;
+    uint64_t bucket, bytes;
+
+    conn = S2C(session);
+    blkcache = &conn->blkcache;
+    entries = NULL;
+    fs = NULL;
+    allocated = count = 0;
+
+    if (blkcache->type == WT_BLKCACHE_UNCONFIGURED || !blkcache->warm_restart ||
+      !blkcache->prewarm_done)
+        return (0);
+    if (F_ISSET(conn, WT_CONN_IN_MEMORY | WT_CONN_PANIC | WT_CONN_READONLY))
+        return (0);
+
+    WT_ERR(__wt_scr_alloc(session, 0, &cookies));
+    WT_ERR(__wt_scr_alloc(session, 0, &hex));
+
+    for (bucket = 0; bucket < blkcache->hash_size; bucket++) {
+        __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
+        TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq)
+            if ((ret = __blkcache_manifest_add(session, &entries, &allocated, &count, cookies,
+                   blkcache_item->fid, blkcache_item->num_references, blkcache_item->data_size,
+                   blkcache_item->addr, blkcache_item->addr_size)) != 0)
+                break;
+        __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
+        WT_ERR(ret);
+    }
+
+    /*
+     * Keep the most referenced blocks that fit under the eviction target, loading them on startup
+     * shouldn't immediately trigger eviction.
+     */
+    if (count > 1)
+        __wt_qsort(
+          entries, count, sizeof(WT_BLKCACHE_MANIFEST_ENTRY), __blkcache_manifest_cmp_refs);
+    for (bytes = 0, i = 0; i < count; ++i) {
+        if (bytes + entries[i].size > blkcache->full_target)
+            break;
+        bytes += entries[i].size;
+    }
+    count = i;
+
+    WT_ERR(__wt_remove_if_exists(session, WT_BLKCACHE_MANIFEST_SET, false));
+    WT_ERR(__wt_fopen(session, WT_BLKCACHE_MANIFEST_SET, WT_FS_OPEN_CREATE | WT_FS_OPEN_EXCLUSIVE,
+      WT_STREAM_WRITE, &fs));
+    WT_ERR(__wt_fprintf(session, fs, "%s\n",
+      "# Do not modify this file.\n"
+      "#\n"
+      "# WiredTiger created this file to reload the block cache on startup.\n"
+      "# Each line lists a file ID, a reference count and a block address cookie."));
+    for (i = 0; i < count; ++i) {
+        WT_ERR(__wt_raw_to_hex(
+          session, (uint8_t *)cookies->data + entries[i].addr_off, entries[i].addr_size, hex));
+        WT_ERR(__wt_fprintf(session, fs, "%" PRIu32 " %" PRIu32 " %s\n", entries[i].fid,
+          entries[i].refs, (const char *)hex->data));
+    }
+
+    /* Flush the stream and rename the file into place. */
+    WT_ERR(__wt_sync_and_rename(session, &fs, WT_BLKCACHE_MANIFEST_SET, WT_BLKCACHE_MANIFEST));
+
+    WT_STAT_CONN_SET(session, block_cache_manifest_blocks, count);
+    __wt_verbose(session, WT_VERB_BLKCACHE,
+      "block cache manifest written: %" WT_SIZET_FMT " blocks, %" PRIu64 " bytes", count, bytes);
+
+    if (0) {
+err:
+        WT_TRET(__wt_fclose(session, &fs));
+        WT_TRET(__wt_remove_if_exists(session, WT_BLKCACHE_MANIFEST_SET, false));
+        __wt_err(session, ret, "unable to write the block cache manifest");
+    }
+    __wt_free(session, entries);
+    __wt_scr_free(session, &cookies);
+    __wt_scr_free(session, &hex);
+    return (ret);
+}
+
+/*
+ * __blkcache_prewarm_put --
+ *     Insert a block read from the manifest into the cache: like the read path, encrypted blocks
+ *     are cached decrypted. Blocks that can't be decrypted are skipped.
+ */
+static int
+__blkcache_prewarm_put(
+  WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr, size_t addr_size, bool *loadedp)
+{
+    WT_BTREE *btree;
+    WT_DECL_ITEM(etmp);
+    WT_DECL_RET;
+    WT_ENCRYPTOR *encryptor;
+    WT_ITEM *ip;
+    const WT_PAGE_HEADER *dsk;
+
+    *loadedp = false;
+
+    btree = S2BT(session);
+    encryptor = btree->kencryptor == NULL ? NULL : btree->kencryptor->encryptor;
+    ip = buf;
+
+    dsk = buf->data;
+    if (F_ISSET(dsk, WT_PAGE_ENCRYPTED)) {
+        if (encryptor == NULL || encryptor->decrypt == NULL)
+            return (0);
+        WT_RET(__wt_scr_alloc(session, buf->size, &etmp));
+        if (__wt_decrypt(session, encryptor, WT_BLOCK_ENCRYPT_SKIP, buf, etmp) != 0)
+            goto err;
+        ip = etmp;
+    } else if (encryptor != NULL)
+        return (0);
+
+    WT_ERR(__wti_blkcache_put(session, ip, addr, addr_size, false));
+    *loadedp = true;
+
+err:
+    __wt_scr_free(session, &etmp);
+    return (ret);
+}
+
+/*
+ * __blkcache_prewarm_file --
+ *     Read one file's manifest blocks into the cache, in offset order and in batches so that
+ *     adjacent blocks are read together.
+ */
+static int
+__blkcache_prewarm_file(WT_SESSION_IMPL *session, const char *uri,
+  WT_BLKCACHE_MANIFEST_ENTRY *entries, size_t count, WT_ITEM *cookies)
+{
+    WT_BLKCACHE *blkcache;
+    WT_BLOCK_READ_REQ reqs[WT_BLKCACHE_PREWARM_BATCH];
+    WT_BM *bm;
+    WT_DECL_RET;
+    WT_ITEM *bufs[WT_BLKCACHE_PREWARM_BATCH];
+    size_t i, loaded, next, skipped;
+    uint32_t checksum, objectid, size;
+    u_int j, nreqs;
+    bool put;
+
+    blkcache = &S2C(session)->blkcache;
+    loaded = skipped = 0;
+    memset(bufs, 0, sizeof(bufs));
+
+    /* Files that have been dropped, or can't be opened right now, are skipped. */
+    if (__wt_session_get_dhandle(session, uri, NULL, NULL, 0) != 0) {
+        WT_STAT_CONN_INCRV(session, block_cache_prewarm_skipped, count);
+        return (0);
+    }
+    bm = S2BT(session)->bm;
+
+    /* Batched reads only handle trees backed by a single file. */
+    if (bm->is_multi_handle) {
+        skipped = count;
+        goto err;
+    }
+
+    for (i = 0; i < count; ++i)
+        WT_ERR(__wt_block_addr_unpack(session, bm->block,
+          (uint8_t *)cookies->data + entries[i].addr_off, entries[i].addr_size, &objectid,
+          &entries[i].offset, &size, &checksum));
+    if (count > 1)
+        __wt_qsort(
+          entries, count, sizeof(WT_BLKCACHE_MANIFEST_ENTRY), __blkcache_manifest_cmp_offset);
+
+    for (j = 0; j < WT_BLKCACHE_PREWARM_BATCH; ++j)
+        WT_ERR(__wt_scr_alloc(session, 0, &bufs[j]));
+
+    for (i = 0; i < count; i = next) {
+        /* Stop once the cache reaches its eviction target, or the connection is closing. */
+        if (blkcache->prewarm_exiting || blkcache->bytes_used >= blkcache->full_target) {
+            skipped += count - i;
+            break;
+        }
+
+        for (nreqs = 0, next = i; next < count && nreqs < WT_BLKCACHE_PREWARM_BATCH;
+             ++next, ++nreqs) {
+            reqs[nreqs].addr = (uint8_t *)cookies->data + entries[next].addr_off;
+            reqs[nreqs].addr_size = entries[next].addr_size;
+            reqs[nreqs].buf = bufs[nreqs];
+        }
+
+        /*
+         * The manifest can be out of date: blocks that have since been freed fail checksum
+         * verification and aren't returned, they're skipped rather than treated as corruption.
+         */
+        WT_ERR(bm->read_batch(bm, session, reqs, nreqs));
+        for (j = 0; j < nreqs; ++j) {
+            put = false;
+            if (reqs[j].valid)
+                WT_ERR(__blkcache_prewarm_put(
+                  session, reqs[j].buf, reqs[j].addr, reqs[j].addr_size, &put));
+            if (put)
+                ++loaded;
+            else
+                ++skipped;
+        }
+    }
+
+err:
+    for (j = 0; j < WT_BLKCACHE_PREWARM_BATCH; ++j)
+        __wt_scr_free(session, &bufs[j]);
+    WT_TRET(__wt_session_release_dhandle(session));
+
+    WT_STAT_CONN_INCRV(session, block_cache_prewarm_blocks, loaded);
+    WT_STAT_CONN_INCRV(session, block_cache_prewarm_skipped, skipped);
+    __wt_verbose(session, WT_VERB_BLKCACHE,
+      "%s: warm restart loaded %" WT_SIZET_FMT " blocks, skipped %" WT_SIZET_FMT, uri, loaded,
+      skipped);
+    return (ret);
+}
+
+/*
+ * __blkcache_prewarm --
+ *     Load the warm restart manifest and read the blocks it lists into the cache.
+ */
+static int
+__blkcache_prewarm(WT_SESSION_IMPL *session)
+{
+    WT_BLKCACHE_MANIFEST_ENTRY *entries;
+    WT_CONFIG_ITEM cval;
+    WT_CURSOR *cursor;
+    WT_DECL_ITEM(cookies);
+    WT_DECL_ITEM(line);
+    WT_DECL_ITEM(raw);
+    WT_DECL_RET;
+    WT_FSTREAM *fs;
+    size_t allocated, count, first, i, last;
+    uint32_t fid, refs;
+    char *p, **uris;
+    const char *key, *value;
+    bool exist;
+
+    entries = NULL;
+    cursor = NULL;
+    fs = NULL;
+    uris = NULL;
+    allocated = count = 0;
+
+    WT_RET(__wt_fs_exist(session, WT_BLKCACHE_MANIFEST, &exist));
+    if (!exist)
+        return (0);
+
+    WT_ERR(__wt_scr_alloc(session, 0, &cookies));
+    WT_ERR(__wt_scr_alloc(session, 512, &line));
+    WT_ERR(__wt_scr_alloc(session, WT_BTREE_MAX_ADDR_COOKIE, &raw));
+
+    /* Read the manifest, a line per block. */
+    WT_ERR(__wt_fopen(session, WT_BLKCACHE_MANIFEST, 0, WT_STREAM_READ, &fs));
+    for (;;) {
+        WT_ERR(__wt_getline(session, fs, line));
+        if (line->size == 0)
+            break;
+        p = line->mem;
+        if (p[0] == '#')
+            continue;
+        fid = (uint32_t)strtoul(p, &p, 10);
+        refs = (uint32_t)strtoul(p, &p, 10);
+        if (*p != ' ' || __wt_hex_to_raw(session, p + 1, raw) != 0 || raw->size == 0 ||
+          raw->size > WT_BTREE_MAX_ADDR_COOKIE)
+            WT_ERR_MSG(session, EINVAL, "%s: corrupted block cache manifest line: %s",
+              WT_BLKCACHE_MANIFEST, (const char *)line->data);
+        WT_ERR(__blkcache_manifest_add(
+          session, &entries, &allocated, &count, cookies, fid, refs, 0, raw->data, raw->size));
+    }
+    WT_ERR(__wt_fclose(session, &fs));
+    if (count == 0)
+        goto err;
+
+    /* Map the file IDs in the manifest to the files' URIs. */
+    __wt_qsort(entries, count, sizeof(WT_BLKCACHE_MANIFEST_ENTRY), __blkcache_manifest_cmp_offset);
+    WT_ERR(__wt_calloc_def(session, count, &uris));
+    WT_ERR(__wt_metadata_cursor(session, &cursor));
+    while ((ret = cursor->next(cursor)) == 0) {
+        WT_ERR(cursor->get_key(cursor, &key));
+        if (!WT_PREFIX_MATCH(key, "file:"))
+            continue;
+        WT_ERR(cursor->get_value(cursor, &value));
+        WT_ERR(__wt_config_getones(session, value, "id", &cval));
+        fid = (uint32_t)cval.val;
+
+        /* Binary search for the file's first entry. */
+        for (first = 0, last = count; first < last;) {
+            i = first + (last - first) / 2;
+            if (entries[i].fid < fid)
+                first = i + 1;
+            else
+                last = i;
+        }
+        if (first < count && entries[first].fid == fid)
+            WT_ERR(__wt_strdup(session, key, &uris[first]));
+    }
+    WT_ERR_NOTFOUND_OK(ret, false);
+    WT_ERR(__wt_metadata_cursor_release(session, &cursor));
+
+    /* The entries are sorted by file ID, read each file's blocks in turn. */
+    for (first = 0; first < count && !S2C(session)->blkcache.prewarm_exiting; first = i) {
+        for (i = first + 1; i < count && entries[i].fid == entries[first].fid; ++i)
+            ;
+        if (uris[first] == NULL)
+            WT_STAT_CONN_INCRV(session, block_cache_prewarm_skipped, i - first);
+        else
+            WT_ERR(
+              __blkcache_prewarm_file(session, uris[first], &entries[first], i - first, cookies));
+    }
+
+err:
+    WT_TRET(__wt_metadata_cursor_release(session, &cursor));
+    WT_TRET(__wt_fclose(session, &fs));
+    if (uris != NULL)
+        for (i = 0; i < count; ++i)
+            __wt_free(session, uris[i]);
+    __wt_free(session, uris);
+    __wt_free(session, entries);
+    __wt_scr_free(session, &cookies);
+    __wt_scr_free(session, &line);
+    __wt_scr_free(session, &raw);
+    return (ret);
+}
+
+/*
+ * __blkcache_prewarm_thread --
+ *     Read the blocks listed in the warm restart manifest into the cache.
+ */
+static WT_THREAD_RET
+__blkcache_prewarm_thread(void *arg)
+{
+    WT_BLKCACHE *blkcache;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    session = (WT_SESSION_IMPL *)arg;
+    blkcache = &S2C(session)->blkcache;
+
+    if ((ret = __blkcache_prewarm(session)) != 0)
+        __wt_err(session, ret, "block cache warm restart failed");
+
+    /*
+     * If the connection closed before the manifest was loaded, keep the manifest: it describes the
+     * cache better than the partially loaded cache does.
+     */
+    if (!blkcache->prewarm_exiting)
+        blkcache->prewarm_done = true;
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __wt_blkcache_prewarm_create --
+ *     Start the thread reading the warm restart manifest's blocks into the cache.
+ */
+int
+__wt_blkcache_prewarm_create(WT_SESSION_IMPL *session)
+{
+    WT_BLKCACHE *blkcache;
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+    blkcache = &conn->blkcache;
+
+    if (blkcache->type == WT_BLKCACHE_UNCONFIGURED || !blkcache->warm_restart)
+        return (0);
+
+    /* An in-memory database has nothing to reload. */
+    if (F_ISSET(conn, WT_CONN_IN_MEMORY)) {
+        blkcache->prewarm_done = true;
+        return (0);
+    }
+
+    WT_RET(__wt_open_internal_session(
+      conn, "blkcache-prewarm", true, 0, 0, &blkcache->prewarm_session));
+    WT_RET(__wt_thread_create(session, &blkcache->prewarm_tid, __blkcache_prewarm_thread,
+      blkcache->prewarm_session));
+    blkcache->prewarm_tid_set = true;
+
+    return (0);
+}
+
+/*
+ * __wt_blkcache_prewarm_destroy --
+ *     Stop the warm restart thread.
+ */
+int
+__wt_blkcache_prewarm_destroy(WT_SESSION_IMPL *session)
+{
+    WT_BLKCACHE *blkcache;
+    WT_DECL_RET;
+
+    blkcache = &S2C(session)->blkcache;
+
+    blkcache->prewarm_exiting = true;
+    if (blkcache->prewarm_tid_set) {
+        WT_TRET(__wt_thread_join(session, &blkcache->prewarm_tid));
+        blkcache->prewarm_tid_set = false;
+    }
+
+    if (blkcache->prewarm_session != NULL) {
+        WT_TRET(__wt_session_close_internal(blkcache->prewarm_session));
+        blkcache->prewarm_session = NULL;
+    }
+
+    return (ret);
+}
+
 /*
  * __blkcache_init --
  *     Initialize the block cache.
@@ -556,7 +1133,8 @@ __wti_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr
 static int
 __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_int type,
   char *nvram_device_path, size_t system_ram, u_int percent_file_in_os_cache, bool cache_on_writes,
-  u_int overhead_pct, u_int evict_aggressive, uint64_t full_target, bool cache_on_checkpoint)
+  u_int overhead_pct, u_int evict_aggressive, uint64_t full_target, bool cache_on_checkpoint,
+  bool warm_restart, bool victim_cache)
 {
     WT_BLKCACHE *blkcache;
     WT_DECL_RET;
@@ -565,6 +1143,8 @@ __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_
     blkcache = &S2C(session)->blkcache;
     blkcache->cache_on_checkpoint = cache_on_checkpoint;
     blkcache->cache_on_writes = cache_on_writes;
+    blkcache->warm_restart = warm_restart;
+    blkcache->victim_cache = victim_cache;
     blkcache->hash_size = hash_size;
     blkcache->percent_file_in_os_cache = percent_file_in_os_cache;
     blkcache->full_target = full_target;
@@ -636,6 +1216,9 @@ __wt_blkcache_destroy(WT_SESSION_IMPL *session)
     WT_TRET(__wt_thread_join(session, &blkcache->evict_thread_tid));
     __wt_verbose(session, WT_VERB_BLKCACHE, "%s", "block cache eviction thread exited");
 
+    /* Save the cache's content for the next startup. Failing to do so isn't an error. */
+    WT_IGNORE_RET(__wt_blkcache_manifest_write(session));
+
     for (i = 0; i < blkcache->hash_size; i++) {
         __wt_spin_lock(session, &blkcache->hash_locks[i]);
         while (!TAILQ_EMPTY(&blkcache->hash[i])) {
@@ -691,7 +1274,7 @@ static int
 __blkcache_reconfig(WT_SESSION_IMPL *session, bool reconfig, size_t cache_size, size_t hash_size,
   u_int type, char *nvram_device_path, size_t system_ram, u_int percent_file_in_os_cache,
   bool cache_on_writes, u_int overhead_pct, u_int evict_aggressive, uint64_t full_target,
-  bool cache_on_checkpoint)
+  bool cache_on_checkpoint, bool warm_restart, bool victim_cache)
 {
     WT_BLKCACHE *blkcache;
 
@@ -706,6 +1289,7 @@ __blkcache_reconfig(WT_SESSION_IMPL *session, bool reconfig, size_t cache_size,
       blkcache->full_target != full_target || blkcache->max_bytes != cache_size ||
       blkcache->overhead_pct != overhead_pct || blkcache->system_ram != system_ram ||
       blkcache->evict_aggressive != -((int)evict_aggressive) || blkcache->type != type ||
+      blkcache->warm_restart != warm_restart || blkcache->victim_cache != victim_cache ||
       (nvram_device_path != NULL && blkcache->nvram_device_path == NULL) ||
       (nvram_device_path == NULL && blkcache->nvram_device_path != NULL) ||
       (nvram_device_path != NULL && blkcache->nvram_device_path != NULL &&
@@ -731,7 +1315,7 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     uint64_t cache_size, full_target, system_ram;
     u_int cache_type, evict_aggressive, hash_size, overhead_pct, percent_file_in_os_cache;
     char *nvram_device_path;
-    bool cache_on_checkpoint, cache_on_writes;
+    bool cache_on_checkpoint, cache_on_writes, victim_cache, warm_restart;
 
     blkcache = &S2C(session)->blkcache;
     cache_on_checkpoint = cache_on_writes = true;
@@ -801,11 +1385,17 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     WT_RET(__wt_config_gets(session, cfg, "block_cache.max_percent_overhead", &cval));
     overhead_pct = (u_int)cval.val;
 
+    WT_RET(__wt_config_gets(session, cfg, "block_cache.warm_restart", &cval));
+    warm_restart = cval.val != 0;
+
+    WT_RET(__wt_config_gets(session, cfg, "block_cache.victim_cache", &cval));
+    victim_cache = cval.val != 0;
+
     WT_RET(__blkcache_reconfig(session, reconfig, cache_size, hash_size, cache_type,
       nvram_device_path, system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct,
-      evict_aggressive, full_target, cache_on_checkpoint));
+      evict_aggressive, full_target, cache_on_checkpoint, warm_restart, victim_cache));
 
     return (__blkcache_init(session, cache_size, hash_size, cache_type, nvram_device_path,
       system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct, evict_aggressive,
-      full_target, cache_on_checkpoint));
+      full_target, cache_on_checkpoint, warm_restart, victim_cache));
 }
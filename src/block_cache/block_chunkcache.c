@@ -20,6 +20,17 @@
 #define WT_CHUNK_OFFSET(chunkcache, offset) \
     (wt_off_t)(((size_t)offset / (chunkcache)->chunk_size) * (chunkcache)->chunk_size)
 
+/* Eviction is needed when adding another chunk would take the cache beyond the trigger. */
+#define WT_CHUNKCACHE_EVICTION_NEEDED(chunkcache)                  \
+    ((chunkcache)->bytes_used + (chunkcache)->chunk_size >= \
+      (chunkcache)->evict_trigger * (chunkcache)->capacity / 100)
+
+/* The number of rows in the frequency sketch, each chunk has one counter in each row. */
+#define WT_CHUNKCACHE_SKETCH_ROWS 4
+
+/* Clears the low bit of every 4-bit counter after a shift, halving all counters in a word. */
+#define WT_CHUNKCACHE_SKETCH_RESET_MASK 0x7777777777777777ULL
+
 /*
  * __chunkcache_bitmap_find_free --
  *     Iterate through the bitmap to find a free chunk in the cache.
@@ -375,6 +386,7 @@ __create_and_populate_chunk(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK **newc
 
     (*newchunk)->hash_id.objectid = hash_id->objectid;
     (*newchunk)->hash_id.offset = chunk_offset;
+    (*newchunk)->hash_id.hash = hash_id->hash;
     WT_RET(__wt_strdup(session, hash_id->objectname, &(*newchunk)->hash_id.objectname));
 
     (*newchunk)->bucket_id = bucket;
@@ -447,6 +459,206 @@ __chunkcache_alloc_chunk(WT_SESSION_IMPL *session, wt_off_t offset, wt_off_t siz
     return (0);
 }
 
+/*
+ * __chunkcache_sketch_index --
+ *     Return the index of the word holding a chunk's counter in the given row of the sketch.
+ */
+static WT_INLINE uint64_t
+__chunkcache_sketch_index(WT_CHUNKCACHE_SKETCH *sketch, uint64_t hash, u_int row)
+{
+    static const uint64_t seeds[WT_CHUNKCACHE_SKETCH_ROWS] = {
+      0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+    uint64_t h;
+
+    h = (hash + seeds[row]) * seeds[row];
+    h += h >> 32;
+    return (h & sketch->mask);
+}
+
+/*
+ * __chunkcache_sketch_frequency --
+ *     Estimate how often a chunk has been accessed: the smallest of its counters.
+ */
+static uint32_t
+__chunkcache_sketch_frequency(WT_CHUNKCACHE_SKETCH *sketch, uint64_t hash)
+{
+    uint32_t count, frequency;
+    u_int row, start;
+
+    /* The low bits of the hash choose which group of four counters the chunk uses in each word. */
+    start = (u_int)(hash & 3) << 2;
+    frequency = 0xf;
+    for (row = 0; row < WT_CHUNKCACHE_SKETCH_ROWS; ++row) {
+        count = (uint32_t)(sketch->table[__chunkcache_sketch_index(sketch, hash, row)] >>
+                  ((start + row) << 2)) &
+          0xf;
+        frequency = WT_MIN(frequency, count);
+    }
+    return (frequency);
+}
+
+/*
+ * __chunkcache_sketch_increment --
+ *     Record an access to a chunk in the frequency sketch, halving all the counters once enough
+ *     accesses have been recorded.
+ */
+static void
+__chunkcache_sketch_increment(WT_CHUNKCACHE_SKETCH *sketch, uint64_t hash)
+{
+    uint64_t i, *word;
+    u_int row, shift, start;
+    bool added;
+
+    start = (u_int)(hash & 3) << 2;
+    added = false;
+    for (row = 0; row < WT_CHUNKCACHE_SKETCH_ROWS; ++row) {
+        word = &sketch->table[__chunkcache_sketch_index(sketch, hash, row)];
+        shift = (start + row) << 2;
+        if (((*word >> shift) & 0xf) != 0xf) {
+            *word += (uint64_t)1 << shift;
+            added = true;
+        }
+    }
+
+    if (added && ++sketch->additions >= sketch->sample_size) {
+        for (i = 0; i <= sketch->mask; ++i)
+            sketch->table[i] = (sketch->table[i] >> 1) & WT_CHUNKCACHE_SKETCH_RESET_MASK;
+        sketch->additions /= 2;
+    }
+}
+
+/*
+ * __chunkcache_lru_push --
+ *     Put a chunk at the head of a TinyLFU segment. Called with the policy lock held.
+ */
+static WT_INLINE void
+__chunkcache_lru_push(WT_CHUNKCACHE *chunkcache, WT_CHUNKCACHE_CHUNK *chunk, uint8_t segment)
+{
+    TAILQ_INSERT_HEAD(&chunkcache->lru[segment], chunk, next_lru_item);
+    chunkcache->lru_bytes[segment] += chunk->chunk_size;
+    chunk->segment = segment;
+}
+
+/*
+ * __chunkcache_lru_unlink --
+ *     Take a chunk off its TinyLFU segment. Called with the policy lock held.
+ */
+static WT_INLINE void
+__chunkcache_lru_unlink(WT_CHUNKCACHE *chunkcache, WT_CHUNKCACHE_CHUNK *chunk)
+{
+    TAILQ_REMOVE(&chunkcache->lru[chunk->segment], chunk, next_lru_item);
+    chunkcache->lru_bytes[chunk->segment] -= chunk->chunk_size;
+}
+
+/*
+ * __chunkcache_tinylfu_trim_window --
+ *     Move the least recently used chunks overflowing the window into probation while the cache
+ *     has room for them. Once eviction is needed, the eviction thread decides whether they are
+ *     admitted. Called with the policy lock held.
+ */
+static void
+__chunkcache_tinylfu_trim_window(WT_CHUNKCACHE *chunkcache)
+{
+    WT_CHUNKCACHE_CHUNK *chunk;
+
+    while (chunkcache->lru_bytes[WT_CHUNK_SEGMENT_WINDOW] > chunkcache->window_max &&
+      !WT_CHUNKCACHE_EVICTION_NEEDED(chunkcache) &&
+      (chunk = TAILQ_LAST(&chunkcache->lru[WT_CHUNK_SEGMENT_WINDOW], __wt_chunklru_head)) !=
+        NULL) {
+        __chunkcache_lru_unlink(chunkcache, chunk);
+        __chunkcache_lru_push(chunkcache, chunk, WT_CHUNK_SEGMENT_PROBATION);
+    }
+}
+
+/*
+ * __chunkcache_tinylfu_insert --
+ *     Add a new chunk to a TinyLFU segment. Called with the chunk's bucket lock held.
+ */
+static void
+__chunkcache_tinylfu_insert(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK *chunk, uint8_t segment)
+{
+    WT_CHUNKCACHE *chunkcache;
+
+    chunkcache = &S2C(session)->chunkcache;
+
+    __wt_spin_lock(session, &chunkcache->policy_lock);
+    __chunkcache_lru_push(chunkcache, chunk, segment);
+    F_SET(chunk, WT_CHUNK_ON_LRU);
+    __chunkcache_tinylfu_trim_window(chunkcache);
+    __wt_spin_unlock(session, &chunkcache->policy_lock);
+}
+
+/*
+ * __chunkcache_tinylfu_remove --
+ *     Take a chunk being freed off the TinyLFU segments. Called with the chunk's bucket lock held,
+ *     or once no other thread can find the chunk.
+ */
+static void
+__chunkcache_tinylfu_remove(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK *chunk)
+{
+    WT_CHUNKCACHE *chunkcache;
+
+    chunkcache = &S2C(session)->chunkcache;
+
+    if (!F_ISSET(chunk, WT_CHUNK_ON_LRU))
+        return;
+
+    __wt_spin_lock(session, &chunkcache->policy_lock);
+    __chunkcache_lru_unlink(chunkcache, chunk);
+    F_CLR(chunk, WT_CHUNK_ON_LRU);
+    __wt_spin_unlock(session, &chunkcache->policy_lock);
+}
+
+/*
+ * __chunkcache_tinylfu_record --
+ *     Record an access to a chunk that isn't cached.
+ */
+static void
+__chunkcache_tinylfu_record(WT_SESSION_IMPL *session, uint64_t hash)
+{
+    WT_CHUNKCACHE *chunkcache;
+
+    chunkcache = &S2C(session)->chunkcache;
+
+    __wt_spin_lock(session, &chunkcache->policy_lock);
+    __chunkcache_sketch_increment(&chunkcache->sketch, hash);
+    __wt_spin_unlock(session, &chunkcache->policy_lock);
+}
+
+/*
+ * __chunkcache_tinylfu_access --
+ *     Record an access to a cached chunk. A chunk accessed again while on probation is promoted to
+ *     the protected segment, the least recently used protected chunks are demoted back to
+ *     probation if that makes the protected segment too large. Called with the chunk's bucket lock
+ *     held.
+ */
+static void
+__chunkcache_tinylfu_access(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK *chunk)
+{
+    WT_CHUNKCACHE *chunkcache;
+    WT_CHUNKCACHE_CHUNK *demoted;
+
+    chunkcache = &S2C(session)->chunkcache;
+
+    __wt_spin_lock(session, &chunkcache->policy_lock);
+    __chunkcache_sketch_increment(&chunkcache->sketch, chunk->hash_id.hash);
+    if (F_ISSET(chunk, WT_CHUNK_ON_LRU)) {
+        __chunkcache_lru_unlink(chunkcache, chunk);
+        if (chunk->segment == WT_CHUNK_SEGMENT_WINDOW)
+            __chunkcache_lru_push(chunkcache, chunk, WT_CHUNK_SEGMENT_WINDOW);
+        else {
+            __chunkcache_lru_push(chunkcache, chunk, WT_CHUNK_SEGMENT_PROTECTED);
+            while (chunkcache->lru_bytes[WT_CHUNK_SEGMENT_PROTECTED] > chunkcache->protected_max &&
+              (demoted = TAILQ_LAST(&chunkcache->lru[WT_CHUNK_SEGMENT_PROTECTED],
+                 __wt_chunklru_head)) != chunk) {
+                __chunkcache_lru_unlink(chunkcache, demoted);
+                __chunkcache_lru_push(chunkcache, demoted, WT_CHUNK_SEGMENT_PROBATION);
+            }
+        }
+    }
+    __wt_spin_unlock(session, &chunkcache->policy_lock);
+}
+
 /*
  * __chunkcache_free_chunk --
  *     Free the memory occupied by the chunk and the metadata.
@@ -459,6 +671,9 @@ __chunkcache_free_chunk(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK *chunk)
 
     chunkcache = &S2C(session)->chunkcache;
 
+    if (chunkcache->policy == WT_CHUNKCACHE_POLICY_TINYLFU)
+        __chunkcache_tinylfu_remove(session, chunk);
+
     if (chunkcache->type == WT_CHUNKCACHE_IN_VOLATILE_MEMORY)
         __wt_free(session, chunk->chunk_memory);
     else {
@@ -511,6 +726,7 @@ __chunkcache_tmp_hash(WT_CHUNKCACHE *chunkcache, WT_CHUNKCACHE_HASHID *hash_id,
     hash_id->objectname = object_name;
 
     hash_final = __wt_hash_city64(&intermediate, sizeof(intermediate));
+    hash_id->hash = hash_final;
 
     /* Return the bucket ID. */
     return (hash_final % chunkcache->hashtable_size);
@@ -528,16 +744,11 @@ __hash_id_eq(WT_CHUNKCACHE_HASHID *a, WT_CHUNKCACHE_HASHID *b)
 }
 
 /*
- * __chunkcache_should_evict --
- *     Decide if we can evict this chunk.
- *
- * In the current algorithm we only evict the chunks with a zero access count. We always decrement
- *     the access count on the chunk that is given to us. The thread accessing the chunk increments
- *     the access count. As a result, we will only evict a chunk that has not been accessed for a
- *     time proportional to the number of accesses made to it.
+ * __chunkcache_can_evict --
+ *     Check whether the chunk can be evicted at all.
  */
 static WT_INLINE bool
-__chunkcache_should_evict(WT_CHUNKCACHE_CHUNK *chunk)
+__chunkcache_can_evict(WT_CHUNKCACHE_CHUNK *chunk)
 {
     bool valid;
 
@@ -551,7 +762,22 @@ __chunkcache_should_evict(WT_CHUNKCACHE_CHUNK *chunk)
     if (!valid)
         return (false);
 
-    if (F_ISSET(chunk, WT_CHUNK_PINNED))
+    return (!F_ISSET(chunk, WT_CHUNK_PINNED));
+}
+
+/*
+ * __chunkcache_should_evict --
+ *     Decide if we can evict this chunk.
+ *
+ * In the current algorithm we only evict the chunks with a zero access count. We always decrement
+ *     the access count on the chunk that is given to us. The thread accessing the chunk increments
+ *     the access count. As a result, we will only evict a chunk that has not been accessed for a
+ *     time proportional to the number of accesses made to it.
+ */
+static WT_INLINE bool
+__chunkcache_should_evict(WT_CHUNKCACHE_CHUNK *chunk)
+{
+    if (!__chunkcache_can_evict(chunk))
         return (false);
 
     if (chunk->access_count == 0)
@@ -561,11 +787,138 @@ __chunkcache_should_evict(WT_CHUNKCACHE_CHUNK *chunk)
     return (false);
 }
 
+/*
+ * __chunkcache_evict_chunk --
+ *     Remove a chunk from its bucket and free it. Called with the bucket lock held.
+ */
+static void
+__chunkcache_evict_chunk(WT_SESSION_IMPL *session, uint64_t bucket_id, WT_CHUNKCACHE_CHUNK *chunk)
+{
+    WT_CHUNKCACHE *chunkcache;
+
+    chunkcache = &S2C(session)->chunkcache;
+
+    TAILQ_REMOVE(WT_BUCKET_CHUNKS(chunkcache, bucket_id), chunk, next_chunk);
+    __delete_update_stats(session, chunk);
+    WT_STAT_CONN_INCR(session, chunkcache_chunks_evicted);
+    __wt_verbose(session, WT_VERB_CHUNKCACHE,
+      "evicted chunk: %s(%u), offset=%" PRId64 ", size=%" PRIu64, chunk->hash_id.objectname,
+      chunk->hash_id.objectid, chunk->chunk_offset, (uint64_t)chunk->chunk_size);
+    __chunkcache_free_chunk(session, chunk);
+}
+
+/*
+ * __chunkcache_tinylfu_evictable --
+ *     Return the least recently used chunk of a TinyLFU segment that can be evicted. Called with
+ *     the policy lock held.
+ */
+static WT_CHUNKCACHE_CHUNK *
+__chunkcache_tinylfu_evictable(WT_CHUNKCACHE *chunkcache, uint8_t segment)
+{
+    WT_CHUNKCACHE_CHUNK *chunk;
+
+    TAILQ_FOREACH_REVERSE(chunk, &chunkcache->lru[segment], __wt_chunklru_head, next_lru_item)
+    {
+        if (__chunkcache_can_evict(chunk))
+            return (chunk);
+    }
+    return (NULL);
+}
+
+/*
+ * __chunkcache_tinylfu_select --
+ *     Choose the chunk to evict. When the window is over its size, its least recently used chunk
+ *     is a candidate for the main region and competes with the chunk the main region would evict
+ *     next: the one the frequency sketch estimates is accessed less often is evicted. A one-off
+ *     scan therefore only churns the window, leaving the frequently accessed chunks cached. Called
+ *     with the policy lock held.
+ */
+static WT_CHUNKCACHE_CHUNK *
+__chunkcache_tinylfu_select(WT_SESSION_IMPL *session)
+{
+    WT_CHUNKCACHE *chunkcache;
+    WT_CHUNKCACHE_CHUNK *candidate, *victim;
+
+    chunkcache = &S2C(session)->chunkcache;
+    candidate = NULL;
+
+    if (chunkcache->lru_bytes[WT_CHUNK_SEGMENT_WINDOW] > chunkcache->window_max)
+        candidate = __chunkcache_tinylfu_evictable(chunkcache, WT_CHUNK_SEGMENT_WINDOW);
+    if ((victim = __chunkcache_tinylfu_evictable(chunkcache, WT_CHUNK_SEGMENT_PROBATION)) == NULL)
+        victim = __chunkcache_tinylfu_evictable(chunkcache, WT_CHUNK_SEGMENT_PROTECTED);
+
+    /* Without a chunk in the main region to compete against, evict from the window. */
+    if (victim == NULL)
+        return (candidate != NULL ?
+            candidate :
+            __chunkcache_tinylfu_evictable(chunkcache, WT_CHUNK_SEGMENT_WINDOW));
+    if (candidate == NULL)
+        return (victim);
+
+    if (__chunkcache_sketch_frequency(&chunkcache->sketch, candidate->hash_id.hash) >
+      __chunkcache_sketch_frequency(&chunkcache->sketch, victim->hash_id.hash)) {
+        __chunkcache_lru_unlink(chunkcache, candidate);
+        __chunkcache_lru_push(chunkcache, candidate, WT_CHUNK_SEGMENT_PROBATION);
+        WT_STAT_CONN_INCR(session, chunkcache_tinylfu_admitted);
+        return (victim);
+    }
+    WT_STAT_CONN_INCR(session, chunkcache_tinylfu_rejected);
+    return (candidate);
+}
+
+/*
+ * __chunkcache_tinylfu_evict --
+ *     Evict the chunks chosen by the TinyLFU policy until the cache is below the eviction trigger.
+ *     Return if a chunk was evicted.
+ */
+static bool
+__chunkcache_tinylfu_evict(WT_SESSION_IMPL *session)
+{
+    WT_CHUNKCACHE *chunkcache;
+    WT_CHUNKCACHE_CHUNK *chunk, *victim;
+    uint64_t bucket_id;
+    bool evicted;
+
+    chunkcache = &S2C(session)->chunkcache;
+    bucket_id = 0;
+    evicted = false;
+
+    while (WT_CHUNKCACHE_EVICTION_NEEDED(chunkcache) &&
+      !F_ISSET(chunkcache, WT_CHUNK_CACHE_EXITING)) {
+        __wt_spin_lock(session, &chunkcache->policy_lock);
+        if ((victim = __chunkcache_tinylfu_select(session)) != NULL)
+            bucket_id = victim->bucket_id;
+        __wt_spin_unlock(session, &chunkcache->policy_lock);
+        if (victim == NULL)
+            break;
+
+        /*
+         * The policy lock is acquired after bucket locks, so the victim was chosen without holding
+         * its bucket lock and may have been freed since. Only evict it if it's still in the bucket.
+         */
+        __wt_spin_lock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
+        TAILQ_FOREACH (chunk, WT_BUCKET_CHUNKS(chunkcache, bucket_id), next_chunk)
+            if (chunk == victim)
+                break;
+        if (chunk != NULL && __chunkcache_can_evict(chunk)) {
+            __chunkcache_evict_chunk(session, bucket_id, chunk);
+            evicted = true;
+        }
+        __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
+
+        if (chunk == NULL)
+            break;
+    }
+    return (evicted);
+}
+
 /*
  * __chunkcache_eviction_thread --
- *     Periodically sweep the cache and evict chunks with a zero access count.
+ *     Periodically evict chunks when the cache is nearly full.
  *
- * This strategy is a clock eviction algorithm, which is an approximation of LRU.
+ * With the clock policy, sweep the cache and evict chunks with a zero access count. This strategy
+ *     is a clock eviction algorithm, which is an approximation of LRU. With the TinyLFU policy,
+ *     evict the chunks the policy chooses.
  */
 static WT_THREAD_RET
 __chunkcache_eviction_thread(void *arg)
@@ -580,25 +933,22 @@ __chunkcache_eviction_thread(void *arg)
 
     while (!F_ISSET(chunkcache, WT_CHUNK_CACHE_EXITING)) {
         /* Do not evict if we are not close to exceeding capacity. */
-        if ((chunkcache->bytes_used + chunkcache->chunk_size) <
-          chunkcache->evict_trigger * chunkcache->capacity / 100) {
+        if (!WT_CHUNKCACHE_EVICTION_NEEDED(chunkcache)) {
             __wt_sleep(1, 0);
             continue;
         }
+        if (chunkcache->policy == WT_CHUNKCACHE_POLICY_TINYLFU) {
+            /* Back off if everything left is pinned or being read. */
+            if (!__chunkcache_tinylfu_evict(session))
+                __wt_sleep(0, 10 * WT_THOUSAND);
+            continue;
+        }
         for (i = 0; i < (int)chunkcache->hashtable_size; i++) {
             __wt_spin_lock(session, &chunkcache->hashtable[i].bucket_lock);
             TAILQ_FOREACH_SAFE(chunk, WT_BUCKET_CHUNKS(chunkcache, i), next_chunk, chunk_tmp)
             {
-                if (__chunkcache_should_evict(chunk)) {
-                    TAILQ_REMOVE(WT_BUCKET_CHUNKS(chunkcache, i), chunk, next_chunk);
-                    __delete_update_stats(session, chunk);
-                    __chunkcache_free_chunk(session, chunk);
-                    WT_STAT_CONN_INCR(session, chunkcache_chunks_evicted);
-                    __wt_verbose(session, WT_VERB_CHUNKCACHE,
-                      "evicted chunk: %s(%u), offset=%" PRId64 ", size=%" PRIu64,
-                      chunk->hash_id.objectname, chunk->hash_id.objectid, chunk->chunk_offset,
-                      (uint64_t)chunk->chunk_size);
-                }
+                if (__chunkcache_should_evict(chunk))
+                    __chunkcache_evict_chunk(session, (uint64_t)i, chunk);
             }
             __wt_spin_unlock(session, &chunkcache->hashtable[i].bucket_lock);
             if (F_ISSET(chunkcache, WT_CHUNK_CACHE_EXITING))
@@ -697,7 +1047,8 @@ err:
  */
 static int
 __chunkcache_insert(WT_SESSION_IMPL *session, wt_off_t offset, wt_off_t size,
-  WT_CHUNKCACHE_HASHID *hash_id, uint64_t bucket_id, WT_CHUNKCACHE_CHUNK **new_chunk)
+  WT_CHUNKCACHE_HASHID *hash_id, uint64_t bucket_id, uint8_t origin,
+  WT_CHUNKCACHE_CHUNK **new_chunk)
 {
     WT_CHUNKCACHE *chunkcache;
 
@@ -708,6 +1059,7 @@ __chunkcache_insert(WT_SESSION_IMPL *session, wt_off_t offset, wt_off_t size,
      * Caller function should take a bucket lock before inserting the chunk.
      */
     WT_RET(__chunkcache_alloc_chunk(session, offset, size, hash_id, new_chunk));
+    (*new_chunk)->origin = origin;
 
     /*
      * Insert the invalid chunk into the bucket before releasing the lock and doing I/O. This way we
@@ -715,6 +1067,10 @@ __chunkcache_insert(WT_SESSION_IMPL *session, wt_off_t offset, wt_off_t size,
      */
     TAILQ_INSERT_HEAD(WT_BUCKET_CHUNKS(chunkcache, bucket_id), *new_chunk, next_chunk);
 
+    /* New chunks enter the TinyLFU window, eviction skips them until they're valid. */
+    if (chunkcache->policy == WT_CHUNKCACHE_POLICY_TINYLFU)
+        __chunkcache_tinylfu_insert(session, *new_chunk, WT_CHUNK_SEGMENT_WINDOW);
+
     return (0);
 }
 
@@ -833,10 +1189,11 @@ __wt_chunkcache_get(WT_SESSION_IMPL *session, WT_BLOCK *block, uint32_t objectid
     size_t already_read, readable_in_chunk, remains_to_read, size_copied;
     uint64_t bucket_id, retries, sleep_usec;
     const char *object_name;
-    bool chunk_cached, valid;
+    bool chunk_cached, chunk_inserted, valid;
 
     chunkcache = &S2C(session)->chunkcache;
     already_read = 0;
+    chunk_inserted = false;
     remains_to_read = size;
     retries = 0;
     sleep_usec = WT_THOUSAND;
@@ -910,6 +1267,28 @@ retry:
                 if (chunk->access_count < WT_CHUNK_ACCESS_CAP_LIMIT)
                     chunk->access_count++;
 
+                /*
+                 * The access that just cached the chunk was counted as a miss, otherwise count a
+                 * hit by where the chunk came from and let the replacement policy know.
+                 */
+                if (chunk_inserted)
+                    chunk_inserted = false;
+                else {
+                    switch (chunk->origin) {
+                    case WT_CHUNK_ORIGIN_FLUSHED:
+                        WT_STAT_CONN_INCR(session, chunkcache_hits_flushed);
+                        break;
+                    case WT_CHUNK_ORIGIN_METADATA:
+                        WT_STAT_CONN_INCR(session, chunkcache_hits_metadata);
+                        break;
+                    case WT_CHUNK_ORIGIN_READ:
+                        WT_STAT_CONN_INCR(session, chunkcache_hits_read);
+                        break;
+                    }
+                    if (chunkcache->policy == WT_CHUNKCACHE_POLICY_TINYLFU)
+                        __chunkcache_tinylfu_access(session, chunk);
+                }
+
                 __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
 
                 if (already_read > 0)
@@ -923,12 +1302,15 @@ retry:
         /* The chunk is not cached. Allocate space for it. Prepare for reading it from storage. */
         if (!chunk_cached) {
             WT_STAT_CONN_INCR(session, chunkcache_misses);
-            ret = __chunkcache_insert(
-              session, offset + (wt_off_t)already_read, block->size, &hash_id, bucket_id, &chunk);
+            if (chunkcache->policy == WT_CHUNKCACHE_POLICY_TINYLFU)
+                __chunkcache_tinylfu_record(session, hash_id.hash);
+            ret = __chunkcache_insert(session, offset + (wt_off_t)already_read, block->size,
+              &hash_id, bucket_id, WT_CHUNK_ORIGIN_READ, &chunk);
             __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
             WT_RET(ret);
 
             WT_RET(__chunkcache_read_into_chunk(session, bucket_id, block->fh, chunk));
+            chunk_inserted = true;
 
             __wt_verbose(session, WT_VERB_CHUNKCACHE,
               "insert: %s(%u), offset=%" PRId64 ", size=%lu", (char *)block->name, objectid,
@@ -1035,7 +1417,8 @@ __wt_chunkcache_ingest(
           __chunkcache_tmp_hash(chunkcache, &hash_id, sp_obj_name, objectid, already_read);
 
         __wt_spin_lock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
-        ret = __chunkcache_insert(session, already_read, size, &hash_id, bucket_id, &chunk);
+        ret = __chunkcache_insert(
+          session, already_read, size, &hash_id, bucket_id, WT_CHUNK_ORIGIN_FLUSHED, &chunk);
         __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
         WT_ERR(ret);
 
@@ -1156,6 +1539,7 @@ __wt_chunkcache_create_from_metadata(WT_SESSION_IMPL *session, const char *name,
     WT_ERR(__create_and_populate_chunk(
       session, &newchunk, file_offset, chunk_size, &hash_id, bucket_id));
     F_SET(newchunk, WT_CHUNK_FROM_METADATA);
+    newchunk->origin = WT_CHUNK_ORIGIN_METADATA;
 
     /* Get the position of a specific bit index and link the chunk and its memory cached on disk. */
     bit_index = cache_offset / chunkcache->chunk_size;
@@ -1167,6 +1551,10 @@ __wt_chunkcache_create_from_metadata(WT_SESSION_IMPL *session, const char *name,
     TAILQ_INSERT_HEAD(WT_BUCKET_CHUNKS(chunkcache, bucket_id), newchunk, next_chunk);
     WT_RELEASE_WRITE_WITH_BARRIER(newchunk->valid, true);
 
+    /* Chunks that were cached before the restart skip the TinyLFU window. */
+    if (chunkcache->policy == WT_CHUNKCACHE_POLICY_TINYLFU)
+        __chunkcache_tinylfu_insert(session, newchunk, WT_CHUNK_SEGMENT_PROBATION);
+
     __wt_verbose_debug2(session, WT_VERB_CHUNKCACHE,
       "new chunk instantiated from metadata during startup: %s(%u), offset=%" PRId64 ", size=%lu",
       (char *)name, id, newchunk->chunk_offset, newchunk->chunk_size);
@@ -1182,6 +1570,45 @@ err:
     return (ret);
 }
 
+/*
+ * __chunkcache_tinylfu_setup --
+ *     Size the TinyLFU segments and allocate the frequency sketch.
+ */
+static int
+__chunkcache_tinylfu_setup(WT_SESSION_IMPL *session)
+{
+    WT_CHUNKCACHE *chunkcache;
+    uint64_t evict_size, main_size, nchunks, words;
+    u_int i;
+
+    chunkcache = &S2C(session)->chunkcache;
+
+    for (i = 0; i < WT_CHUNK_SEGMENT_COUNT; ++i)
+        TAILQ_INIT(&chunkcache->lru[i]);
+
+    /*
+     * The window holds 1% of the chunks the cache keeps, and the protected segment 80% of the
+     * remainder, the proportions the TinyLFU authors found to suit most workloads.
+     */
+    evict_size = chunkcache->evict_trigger * chunkcache->capacity / 100;
+    chunkcache->window_max = WT_MAX(chunkcache->chunk_size, evict_size / 100);
+    main_size = evict_size > chunkcache->window_max ? evict_size - chunkcache->window_max : 0;
+    chunkcache->protected_max = main_size / 100 * 80;
+
+    /*
+     * Give the sketch a word, sixteen counters, for every chunk the cache can hold, and age it
+     * after ten accesses per chunk so it follows changes in the workload.
+     */
+    nchunks = chunkcache->capacity / chunkcache->chunk_size;
+    for (words = 64; words < nchunks; words <<= 1)
+        ;
+    chunkcache->sketch.mask = words - 1;
+    chunkcache->sketch.sample_size = WT_MAX(nchunks, 64) * 10;
+    WT_RET(__wt_calloc_def(session, words, &chunkcache->sketch.table));
+
+    return (__wt_spin_init(session, &chunkcache->policy_lock, "chunk cache policy"));
+}
+
 /*
  * __wt_chunkcache_setup --
  *     Set up the chunk cache.
@@ -1267,6 +1694,13 @@ __wt_chunkcache_setup(WT_SESSION_IMPL *session, const char *cfg[])
     if (cval.val != 0)
         F_SET(chunkcache, WT_CHUNK_CACHE_FLUSHED_DATA_INSERTION);
 
+    WT_RET(__wt_config_gets(session, cfg, "chunk_cache.policy", &cval));
+    if (WT_CONFIG_LIT_MATCH("tinylfu", cval)) {
+        chunkcache->policy = WT_CHUNKCACHE_POLICY_TINYLFU;
+        WT_RET(__chunkcache_tinylfu_setup(session));
+    } else
+        chunkcache->policy = WT_CHUNKCACHE_POLICY_CLOCK;
+
     WT_ERR(__wt_rwlock_init(session, &chunkcache->pinned_objects.array_lock));
     WT_ERR(__config_get_sorted_pinned_objects(session, cfg, &pinned_objects, &cnt));
     chunkcache->pinned_objects.array = pinned_objects;
@@ -1315,6 +1749,11 @@ __wt_chunkcache_teardown(WT_SESSION_IMPL *session)
     __chunkcache_arr_free(session, &chunkcache->pinned_objects.array);
     __wt_rwlock_destroy(session, &chunkcache->pinned_objects.array_lock);
 
+    if (chunkcache->policy == WT_CHUNKCACHE_POLICY_TINYLFU) {
+        __wt_free(session, chunkcache->sketch.table);
+        __wt_spin_destroy(session, &chunkcache->policy_lock);
+    }
+
     if (chunkcache->type != WT_CHUNKCACHE_IN_VOLATILE_MEMORY) {
         WT_TRET(__wt_close(session, &chunkcache->fh));
         __wt_free(session, chunkcache->storage_path);
@@ -74,13 +74,14 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr,
 
     WT_ASSERT_ALWAYS(session, session->dhandle != NULL, "The block cache requires a dhandle");
     /*
-     * If anticipating a compressed or encrypted block, start with a scratch buffer and convert into
-     * the caller's buffer. Else, start with the caller's buffer.
+     * If anticipating a compressed or encrypted block, start with an I/O buffer and convert into the
+     * caller's buffer. Else, start with the caller's buffer. Size the I/O buffer for the largest
+     * page we expect, the read grows it if the block is larger.
      */
     ip = buf;
     expect_conversion = compressor != NULL || encryptor != NULL;
     if (expect_conversion) {
-        WT_RET(__wt_scr_alloc(session, 4 * 1024, &tmp));
+        WT_RET(__wt_bufpool_get(session, WT_MAX(btree->maxintlpage, btree->maxleafpage), &tmp));
         ip = tmp;
     }
 
@@ -111,7 +112,11 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr,
     if (!found) {
         timer = WT_STAT_ENABLED(session) && !F_ISSET(session, WT_SESSION_INTERNAL);
         time_start = timer ? __wt_clock(session) : 0;
-        WT_ERR(bm->read(bm, session, ip, addr, addr_size));
+
+        /* Pre-fetch may have already read the block as part of a batch. */
+        if (session->pf.staged_count == 0 ||
+          !__wt_prefetch_staged_get(session, ip, addr, addr_size))
+            WT_ERR(bm->read(bm, session, ip, addr, addr_size));
         if (timer) {
             time_stop = __wt_clock(session);
             time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
@@ -146,7 +151,7 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr,
              * If checksums were turned off because we're depending on decryption to fail on any
              * corrupted data, we'll end up here on corrupted data.
              */
-            WT_ERR(__wt_scr_alloc(session, 0, &etmp));
+            WT_ERR(__wt_bufpool_get(session, ip->size, &etmp));
             if ((ret = __wt_decrypt(session, encryptor, WT_BLOCK_ENCRYPT_SKIP, ip, etmp)) != 0)
                 WT_ERR(__blkcache_read_corrupt(
                   session, ret, addr, addr_size, "block decryption failed"));
@@ -224,8 +229,8 @@ err:
     if (blkcache_found)
         (void)__wt_atomic_subv32(&blkcache_item->ref_count, 1);
 
-    __wt_scr_free(session, &tmp);
-    __wt_scr_free(session, &etmp);
+    __wt_bufpool_put(session, &tmp);
+    __wt_bufpool_put(session, &etmp);
     return (ret);
 }
 
@@ -289,7 +294,7 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_
 
         size = len + WT_BLOCK_COMPRESS_SKIP;
         WT_ERR(bm->write_size(bm, session, &size));
-        WT_ERR(__wt_scr_alloc(session, size, &ctmp));
+        WT_ERR(__wt_bufpool_get(session, size, &ctmp));
 
         /* Skip the header bytes of the destination data. */
         dst = (uint8_t *)ctmp->mem + WT_BLOCK_COMPRESS_SKIP;
@@ -343,7 +348,7 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_
         __wt_encrypt_size(session, kencryptor, ip->size, &size);
 
         WT_ERR(bm->write_size(bm, session, &size));
-        WT_ERR(__wt_scr_alloc(session, size, &etmp));
+        WT_ERR(__wt_bufpool_get(session, size, &etmp));
         WT_ERR(__wt_encrypt(session, kencryptor, WT_BLOCK_ENCRYPT_SKIP, ip, etmp));
 
         encrypted = true;
@@ -422,7 +427,7 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_
         WT_ERR(__wti_blkcache_put(session, compressed ? ctmp : buf, addr, *addr_sizep, true));
 
 err:
-    __wt_scr_free(session, &ctmp);
-    __wt_scr_free(session, &etmp);
+    __wt_bufpool_put(session, &ctmp);
+    __wt_bufpool_put(session, &etmp);
     return (ret);
 }
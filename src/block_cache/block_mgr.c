@@ -541,6 +541,16 @@ __bm_read(WT_BM *bm, WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr
     return (__wt_bm_read(bm, session, buf, addr, addr_size));
 }
 
+/*
+ * __bm_read_batch --
+ *     Read a batch of address cookies referenced blocks.
+ */
+static int
+__bm_read_batch(WT_BM *bm, WT_SESSION_IMPL *session, WT_BLOCK_READ_REQ *reqs, u_int nreqs)
+{
+    return (__wt_bm_read_batch(bm, session, reqs, nreqs));
+}
+
 /*
  * __bm_salvage_end --
  *     End a block manager salvage.
@@ -742,10 +752,12 @@ __bm_sync(WT_BM *bm, WT_SESSION_IMPL *session, bool block)
         WT_RET(__bm_sync_tiered_handles(bm, session));
 
     /* If we have made a switch from the older file, sync the older one instead. */
-    if (bm->prev_block != NULL)
+    if (bm->prev_block != NULL) {
+        WT_RET(__wt_block_write_combine_flush(session, bm->prev_block));
         return (__wt_fsync(session, bm->prev_block->fh, block));
-    else
-        return (__wt_fsync(session, bm->block->fh, block));
+    }
+    WT_RET(__wt_block_write_combine_flush(session, bm->block));
+    return (__wt_fsync(session, bm->block->fh, block));
 }
 
 /*
@@ -918,6 +930,7 @@ __bm_method_set(WT_BM *bm, bool readonly)
     bm->is_mapped = __bm_is_mapped;
     bm->map_discard = __bm_map_discard;
     bm->read = __bm_read;
+    bm->read_batch = __bm_read_batch;
     bm->salvage_end = __bm_salvage_end;
     bm->salvage_next = __bm_salvage_next;
     bm->salvage_start = __bm_salvage_start;
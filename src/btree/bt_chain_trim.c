@@ -0,0 +1,377 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Update chains are trimmed opportunistically when a key is updated, but a page that stops being
+ * updated once its chains can't be trimmed keeps its obsolete updates until it is reconciled or
+ * evicted. Readers walk those chains and the updates count against the cache. Writers remember the
+ * longest chain they couldn't trim on the page and the tree, and the update chain trim thread
+ * periodically walks the in-memory pages of those trees, trimming chains that have fallen behind
+ * the oldest pinned transaction ID and timestamp without evicting or reconciling the pages.
+ */
+
+/*
+ * __chain_trim_run_chk --
+ *     Check to decide if the update chain trim thread should continue running.
+ */
+static bool
+__chain_trim_run_chk(WT_SESSION_IMPL *session)
+{
+    return (FLD_ISSET(S2C(session)->server_flags, WT_CONN_SERVER_CHAIN_TRIM));
+}
+
+/*
+ * __chain_trim_list --
+ *     Trim a single update chain, returning the number of updates left in the chain.
+ */
+static u_int
+__chain_trim_list(WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *upd, uint64_t *updatesp,
+  uint64_t *bytesp)
+{
+    WT_UPDATE *next;
+    u_int count;
+
+    if (upd == NULL || upd->next == NULL)
+        return (upd == NULL ? 0 : 1);
+
+    next = __wt_update_obsolete_detach(session, page, upd, false, &count);
+    for (upd = next; upd != NULL; upd = upd->next) {
+        --count;
+        ++*updatesp;
+        *bytesp += WT_UPDATE_MEMSIZE(upd);
+    }
+    if (next != NULL)
+        __wt_free_update_list(session, &next);
+    return (count);
+}
+
+/*
+ * __chain_trim_insert_array --
+ *     Trim the update chains of an array of insert lists.
+ */
+static u_int
+__chain_trim_insert_array(WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD **head,
+  uint32_t entries, uint64_t *updatesp, uint64_t *bytesp)
+{
+    WT_INSERT *ins;
+    u_int count, longest;
+
+    longest = 0;
+    if (head == NULL)
+        return (longest);
+    for (; entries > 0; --entries, ++head)
+        WT_SKIP_FOREACH (ins, *head) {
+            count = __chain_trim_list(session, page, ins->upd, updatesp, bytesp);
+            longest = WT_MAX(longest, count);
+        }
+    return (longest);
+}
+
+/*
+ * __chain_trim_page --
+ *     Trim the obsolete updates from every update chain on a leaf page, returning if the page
+ *     should be looked at again.
+ */
+static bool
+__chain_trim_page(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_PAGE *page;
+    WT_PAGE_MODIFY *mod;
+    WT_TXN_GLOBAL *txn_global;
+    uint64_t bytes, updates;
+    uint32_t i;
+    u_int count, longest;
+    bool retry;
+
+    page = ref->page;
+    mod = page->modify;
+    txn_global = &S2C(session)->txn_global;
+
+    /* Nothing has changed since the last check found nothing obsolete on this page. */
+    if (mod->obsolete_check_txn != WT_TXN_NONE &&
+      !__wt_txn_visible_all(session, mod->obsolete_check_txn, mod->obsolete_check_timestamp))
+        return (true);
+
+    /*
+     * The page lock serializes trimming with the opportunistic obsolete check and reconciliation.
+     * If we can't lock it, try again on the next pass.
+     */
+    if (WT_PAGE_TRYLOCK(session, page) != 0)
+        return (true);
+
+    bytes = updates = 0;
+    longest = 0;
+    switch (page->type) {
+    case WT_PAGE_COL_FIX:
+    case WT_PAGE_COL_VAR:
+        if (mod->mod_col_append != NULL) {
+            count = __chain_trim_insert_array(
+              session, page, mod->mod_col_append, 1, &updates, &bytes);
+            longest = WT_MAX(longest, count);
+        }
+        count = __chain_trim_insert_array(session, page, mod->mod_col_update,
+          page->type == WT_PAGE_COL_FIX ? 1 : page->entries, &updates, &bytes);
+        longest = WT_MAX(longest, count);
+        break;
+    case WT_PAGE_ROW_LEAF:
+        count = __chain_trim_insert_array(
+          session, page, mod->mod_row_insert, page->entries + 1, &updates, &bytes);
+        longest = WT_MAX(longest, count);
+        if (mod->mod_row_update != NULL)
+            for (i = 0; i < page->entries; ++i) {
+                count = __chain_trim_list(session, page, mod->mod_row_update[i], &updates, &bytes);
+                longest = WT_MAX(longest, count);
+            }
+        break;
+    }
+
+    /*
+     * Decrement the byte count while holding the page lock, else we can race with checkpoints
+     * cleaning the page.
+     */
+    if (bytes != 0)
+        __wt_cache_page_inmem_decr(session, page, bytes);
+
+    /*
+     * If a long chain is left that couldn't be trimmed, don't look at the page again until the
+     * transaction state has moved forwards, otherwise forget about it.
+     */
+    retry = updates == 0 && longest >= __wt_atomic_load32(&S2C(session)->chain_trim_min_length);
+    if (retry) {
+        mod->obsolete_check_txn = __wt_atomic_loadv64(&txn_global->last_running);
+        if (txn_global->has_pinned_timestamp)
+            mod->obsolete_check_timestamp = txn_global->pinned_timestamp;
+    } else
+        __wt_atomic_store32(&mod->obsolete_chain_len, 0);
+
+    WT_PAGE_UNLOCK(session, page);
+
+    if (updates != 0) {
+        WT_STAT_CONN_INCR(session, cache_chain_trim_pages);
+        WT_STAT_CONN_INCRV(session, cache_chain_trim_updates, updates);
+        WT_STAT_CONN_INCRV(session, cache_chain_trim_bytes, bytes);
+    }
+    return (retry);
+}
+
+/*
+ * __chain_trim_walk_btree --
+ *     Walk the in-memory leaf pages of a tree, trimming the pages with long update chains.
+ */
+static int
+__chain_trim_walk_btree(WT_SESSION_IMPL *session, const char *uri)
+{
+    WT_BTREE *btree;
+    WT_DECL_RET;
+    WT_PAGE_MODIFY *mod;
+    WT_REF *ref;
+    uint32_t flags, len, min_length;
+
+    ref = NULL;
+    /* Only look at pages already in memory, and don't make them look recently used. */
+    flags = WT_READ_CACHE | WT_READ_NO_EVICT | WT_READ_NO_GEN | WT_READ_NO_WAIT |
+      WT_READ_SKIP_INTL | WT_READ_VISIBLE_ALL;
+    min_length = __wt_atomic_load32(&S2C(session)->chain_trim_min_length);
+
+    WT_RET(__wt_session_get_dhandle(session, uri, NULL, NULL, 0));
+    btree = S2BT(session);
+
+    /* Clear the tree's flag first, chains found to be long while we walk will set it again. */
+    __wt_atomic_store32(&btree->chain_trim_len, 0);
+
+    while ((ret = __wt_tree_walk(session, &ref, flags)) == 0 && ref != NULL) {
+        WT_STAT_CONN_INCR(session, cache_chain_trim_pages_visited);
+        mod = ref->page->modify;
+        if (mod != NULL && (len = __wt_atomic_load32(&mod->obsolete_chain_len)) >= min_length &&
+          __chain_trim_page(session, ref))
+            __wt_atomic_store32(&btree->chain_trim_len, len);
+
+        /* Check if we're quitting. */
+        if (!__chain_trim_run_chk(session))
+            break;
+    }
+
+    /* On error, clear any left-over tree walk. */
+    WT_TRET(__wt_page_release(session, ref, flags));
+    WT_TRET(__wt_session_release_dhandle(session));
+    return (ret);
+}
+
+/*
+ * __chain_trim_pass --
+ *     Trim the trees that have pages with long update chains.
+ */
+static int
+__chain_trim_pass(WT_SESSION_IMPL *session)
+{
+    WT_BTREE *btree;
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_ITEM(uris);
+    WT_DECL_RET;
+    size_t len;
+    uint32_t min_length;
+    const char *uri;
+
+    conn = S2C(session);
+    min_length = __wt_atomic_load32(&conn->chain_trim_min_length);
+
+    /* Move the oldest transaction ID forward, so updates become obsolete as soon as possible. */
+    WT_RET(__wt_txn_update_oldest(session, 0));
+
+    WT_RET(__wt_scr_alloc(session, 1024, &uris));
+
+    /*
+     * Gather the names of the trees with long update chains under the handle list lock, then walk
+     * them one at a time. Checkpoint handles are read-only, and the history store has different
+     * visibility rules that prevent its updates from being removed as obsolete.
+     */
+    WT_WITH_HANDLE_LIST_READ_LOCK(session, {
+        TAILQ_FOREACH (dhandle, &conn->dhqh, q) {
+            if (!WT_DHANDLE_BTREE(dhandle) || !F_ISSET(dhandle, WT_DHANDLE_OPEN) ||
+              WT_IS_HS(dhandle) || dhandle->checkpoint != NULL)
+                continue;
+            btree = dhandle->handle;
+            if (__wt_atomic_load32(&btree->chain_trim_len) < min_length)
+                continue;
+            len = strlen(dhandle->name) + 1;
+            if ((ret = __wt_buf_grow(session, uris, uris->size + len)) != 0)
+                break;
+            memcpy((uint8_t *)uris->mem + uris->size, dhandle->name, len);
+            uris->size += len;
+        }
+    });
+    WT_ERR(ret);
+
+    for (uri = uris->mem; uri < (const char *)uris->mem + uris->size; uri += strlen(uri) + 1) {
+        ret = __chain_trim_walk_btree(session, uri);
+        /* The tree may have been dropped, or be in exclusive use: skip it. */
+        if (ret == ENOENT || ret == EBUSY)
+            ret = 0;
+        WT_ERR(ret);
+
+        /* Check if we're quitting. */
+        if (!__chain_trim_run_chk(session))
+            break;
+    }
+
+err:
+    __wt_scr_free(session, &uris);
+    return (ret);
+}
+
+/*
+ * __chain_trim_server --
+ *     The update chain trim thread.
+ */
+static WT_THREAD_RET
+__chain_trim_server(void *arg)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    session = arg;
+    conn = S2C(session);
+
+    for (;;) {
+        __wt_cond_wait(session, conn->chain_trim_cond, conn->chain_trim_wait, __chain_trim_run_chk);
+
+        /* Check if we're quitting. */
+        if (!__chain_trim_run_chk(session))
+            break;
+
+        WT_ERR(__chain_trim_pass(session));
+        WT_STAT_CONN_INCR(session, cache_chain_trim_passes);
+    }
+
+err:
+    if (ret != 0)
+        WT_IGNORE_RET(__wt_panic(session, ret, "update chain trim error"));
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __wt_chain_trim_server_create --
+ *     Configure and start the update chain trim thread.
+ */
+int
+__wt_chain_trim_server_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+
+    /*
+     * Stop any server that is already running, reconfiguration bounces the server and starts again
+     * with the new configuration.
+     */
+    if (conn->chain_trim_session != NULL)
+        WT_RET(__wt_chain_trim_server_destroy(session));
+
+    if (F_ISSET(conn, WT_CONN_READONLY))
+        return (0);
+
+    WT_RET(__wt_config_gets(session, cfg, "chain_trim.enabled", &cval));
+    if (!cval.val)
+        return (0);
+
+    WT_RET(__wt_config_gets(session, cfg, "chain_trim.min_length", &cval));
+    __wt_atomic_store32(&conn->chain_trim_min_length, (uint32_t)cval.val);
+    WT_RET(__wt_config_gets(session, cfg, "chain_trim.wait_ms", &cval));
+    conn->chain_trim_wait = (uint64_t)cval.val * WT_THOUSAND;
+
+    /* Set first, the thread might run before we finish up. */
+    FLD_SET(conn->server_flags, WT_CONN_SERVER_CHAIN_TRIM);
+
+    WT_RET(__wt_open_internal_session(
+      conn, "chain-trim-server", true, 0, 0, &conn->chain_trim_session));
+    session = conn->chain_trim_session;
+
+    WT_RET(__wt_cond_alloc(session, "chain trim server", &conn->chain_trim_cond));
+
+    WT_RET(__wt_thread_create(session, &conn->chain_trim_tid, __chain_trim_server, session));
+    conn->chain_trim_tid_set = true;
+
+    return (0);
+}
+
+/*
+ * __wt_chain_trim_server_destroy --
+ *     Destroy the update chain trim thread.
+ */
+int
+__wt_chain_trim_server_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    /* Stop writers tracking long chains. */
+    __wt_atomic_store32(&conn->chain_trim_min_length, 0);
+
+    FLD_CLR(conn->server_flags, WT_CONN_SERVER_CHAIN_TRIM);
+    if (conn->chain_trim_tid_set) {
+        __wt_cond_signal(session, conn->chain_trim_cond);
+        WT_TRET(__wt_thread_join(session, &conn->chain_trim_tid));
+        conn->chain_trim_tid_set = false;
+    }
+    __wt_cond_destroy(session, &conn->chain_trim_cond);
+
+    /* Close the server thread's session. */
+    if (conn->chain_trim_session != NULL) {
+        WT_TRET(__wt_session_close_internal(conn->chain_trim_session));
+        conn->chain_trim_session = NULL;
+    }
+
+    return (ret);
+}
@@ -1248,6 +1248,10 @@ __debug_page_metadata(WT_DBG *ds, WT_REF *ref)
             WT_RET(flag_num == 0 ? ds->f(ds, "disk-mapped") : ds->f(ds, ", disk-mapped"));
             flag_num++;
         }
+        if (F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_SLAB)) {
+            WT_RET(flag_num == 0 ? ds->f(ds, "disk-slab") : ds->f(ds, ", disk-slab"));
+            flag_num++;
+        }
         if (F_ISSET_ATOMIC_16(page, WT_PAGE_EVICT_LRU)) {
             WT_RET(flag_num == 0 ? ds->f(ds, "evict-lru") : ds->f(ds, ", evict-lru"));
             flag_num++;
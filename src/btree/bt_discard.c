@@ -98,7 +98,7 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
     __wt_cache_page_evict(session, page);
 
     dsk = (WT_PAGE_HEADER *)page->dsk;
-    if (F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_ALLOC))
+    if (F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_ALLOC | WT_PAGE_DISK_SLAB))
         __wt_cache_page_image_decr(session, page);
 
     /* Discard any mapped image. */
@@ -136,6 +136,8 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
     /* Discard any allocated disk image. */
     if (F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_ALLOC))
         __wt_overwrite_and_free_len(session, dsk, dsk->mem_size);
+    if (F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_SLAB))
+        __wt_cache_slab_free(session, dsk, dsk->mem_size);
 
     __wt_overwrite_and_free(session, page);
 }
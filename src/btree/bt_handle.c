@@ -373,6 +373,13 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
     else
         F_CLR(btree, WT_BTREE_IN_MEMORY);
 
+    WT_RET(__wt_config_gets(session, cfg, "cache_max", &cval));
+    btree->cache_max = (uint64_t)cval.val;
+    WT_RET(__wt_config_gets(session, cfg, "cache_reserve", &cval));
+    btree->cache_reserve = (uint64_t)cval.val;
+    if (btree->cache_max != 0 && btree->cache_reserve > btree->cache_max)
+        WT_RET_MSG(session, EINVAL, "cache_reserve must not be larger than cache_max");
+
     WT_RET(__wt_config_gets(session, cfg, "ignore_in_memory_cache_size", &cval));
     if (cval.val) {
         if (!F_ISSET(conn, WT_CONN_IN_MEMORY))
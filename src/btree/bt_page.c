@@ -421,8 +421,14 @@ __wti_page_inmem(WT_SESSION_IMPL *session, WT_REF *ref, const void *image, uint3
      * Accounting is based on the page-header's in-memory disk size instead of the buffer memory
      * used to instantiate the page image even though the values might not match exactly, because
      * that's the only value we have when discarding the page image and accounting needs to match.
+     * Images in slab memory are the exception, account for the whole chunk.
      */
-    size = LF_ISSET(WT_PAGE_DISK_ALLOC) ? dsk->mem_size : 0;
+    if (LF_ISSET(WT_PAGE_DISK_ALLOC))
+        size = dsk->mem_size;
+    else if (LF_ISSET(WT_PAGE_DISK_SLAB))
+        size = __wt_cache_slab_chunk_size((void *)dsk);
+    else
+        size = 0;
 
     switch (page->type) {
     case WT_PAGE_COL_FIX:
@@ -447,7 +453,7 @@ __wti_page_inmem(WT_SESSION_IMPL *session, WT_REF *ref, const void *image, uint3
     /* Update the page's cache statistics. */
     __wt_cache_page_inmem_incr(session, page, size);
 
-    if (LF_ISSET(WT_PAGE_DISK_ALLOC))
+    if (LF_ISSET(WT_PAGE_DISK_ALLOC | WT_PAGE_DISK_SLAB))
         __wt_cache_page_image_incr(session, page);
 
     /* Link the new internal page to the parent. */
@@ -465,6 +471,8 @@ __wti_page_inmem(WT_SESSION_IMPL *session, WT_REF *ref, const void *image, uint3
     return (0);
 
 err:
+    /* The caller discards the disk image on error, don't discard it with the page. */
+    F_CLR_ATOMIC_16(page, WT_PAGE_DISK_ALLOC | WT_PAGE_DISK_SLAB);
     __wt_page_out(session, &page);
     return (ret);
 }
@@ -91,6 +91,13 @@ __wti_btree_prefetch(WT_SESSION_IMPL *session, WT_REF *ref)
     WT_INTL_FOREACH_END;
     session->pf.prefetch_prev_ref_home = ref->home;
 
+    /*
+     * Wake the pre-fetch threads once the whole group is queued, rather than for each ref, so the
+     * group can be read in batches.
+     */
+    if (block_preload > 0)
+        __wt_cond_signal(session, conn->prefetch_threads.wait_cond);
+
     WT_STAT_CONN_INCRV(session, prefetch_pages_queued, block_preload);
     return (ret);
 }
@@ -131,3 +138,131 @@ err:
     WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
     return (ret);
 }
+
+/*
+ * __wt_prefetch_read_batch --
+ *     Read the blocks for a group of pre-fetch queue entries in a single batch, staging the block
+ *     images in the session so reading the pages into the cache doesn't have to go back to disk.
+ *     Must be called while holding the dhandle shared by all of the entries.
+ */
+int
+__wt_prefetch_read_batch(WT_SESSION_IMPL *session, WT_PREFETCH_QUEUE_ENTRY **pes, u_int npes)
+{
+    WT_ADDR_COPY addr;
+    WT_BLOCK_READ_REQ *reqs;
+    WT_BM *bm;
+    WT_DECL_RET;
+    WT_PREFETCH *pf;
+    WT_PREFETCH_STAGED *staged;
+    u_int i, count;
+
+    pf = &session->pf;
+    reqs = NULL;
+
+    /* Staged buffers are reused from batch to batch. */
+    pf->staged_count = 0;
+    WT_RET(__wt_realloc_def(session, &pf->staged_allocated, npes, &pf->staged));
+
+    /*
+     * Copy the addresses of the pages still on disk. The copies are only a hint: when the pages are
+     * read into the cache, staged images are matched by address, so a page that's been read in or
+     * rewritten in the meantime is simply read the usual way.
+     */
+    count = 0;
+    WT_ENTER_GENERATION(session, WT_GEN_SPLIT);
+    for (i = 0; i < npes; ++i) {
+        if (WT_REF_GET_STATE(pes[i]->ref) != WT_REF_DISK || pes[i]->ref->page_del != NULL ||
+          !__wt_ref_addr_copy(session, pes[i]->ref, &addr))
+            continue;
+        staged = &pf->staged[count++];
+        memcpy(staged->addr, addr.addr, addr.size);
+        staged->addr_size = addr.size;
+        staged->valid = false;
+    }
+    WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
+
+    /* There's no point in a batch of one. */
+    if (count < 2)
+        return (0);
+
+    WT_RET(__wt_calloc_def(session, count, &reqs));
+    for (i = 0; i < count; ++i) {
+        reqs[i].addr = pf->staged[i].addr;
+        reqs[i].addr_size = pf->staged[i].addr_size;
+        reqs[i].buf = &pf->staged[i].buf;
+    }
+    bm = S2BT(session)->bm;
+    WT_ERR(bm->read_batch(bm, session, reqs, count));
+    for (i = 0; i < count; ++i)
+        pf->staged[i].valid = reqs[i].valid;
+    pf->staged_count = count;
+
+err:
+    __wt_free(session, reqs);
+    return (ret);
+}
+
+/*
+ * __wt_prefetch_staged_get --
+ *     Return a block image staged by a batched read, if there is one for the address.
+ */
+bool
+__wt_prefetch_staged_get(
+  WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr, size_t addr_size)
+{
+    WT_ITEM *sbuf, tmp;
+    WT_PREFETCH_STAGED *staged;
+    u_int i;
+
+    for (i = 0; i < session->pf.staged_count; ++i) {
+        staged = &session->pf.staged[i];
+        if (!staged->valid || staged->addr_size != addr_size ||
+          memcmp(staged->addr, addr, addr_size) != 0)
+            continue;
+
+        /*
+         * Swap the memory rather than copying the image, the caller's memory is reused for the next
+         * batch. The buffer flags (other than alignment, which describes the memory), stay with
+         * the buffer: the caller's buffer may be a scratch buffer.
+         */
+        sbuf = &staged->buf;
+        tmp = *buf;
+        buf->data = sbuf->data;
+        buf->size = sbuf->size;
+        buf->mem = sbuf->mem;
+        buf->memsize = sbuf->memsize;
+        F_CLR(buf, WT_ITEM_ALIGNED);
+        F_SET(buf, F_MASK(sbuf, WT_ITEM_ALIGNED));
+        sbuf->data = tmp.data;
+        sbuf->size = tmp.size;
+        sbuf->mem = tmp.mem;
+        sbuf->memsize = tmp.memsize;
+        sbuf->flags = FLD_MASK(tmp.flags, WT_ITEM_ALIGNED);
+
+        staged->valid = false;
+        WT_STAT_CONN_INCR(session, prefetch_pages_read_batch);
+        return (true);
+    }
+    return (false);
+}
+
+/*
+ * __wt_prefetch_staged_discard --
+ *     Discard the block image buffers staged by batched reads.
+ */
+void
+__wt_prefetch_staged_discard(WT_SESSION_IMPL *session)
+{
+    WT_PREFETCH *pf;
+    size_t i;
+
+    pf = &session->pf;
+    if (pf->staged == NULL)
+        return;
+
+    for (i = 0; i < pf->staged_allocated / sizeof(WT_PREFETCH_STAGED); ++i)
+        __wt_buf_free(session, &pf->staged[i].buf);
+    __wt_free(session, pf->staged);
+    pf->staged_allocated = 0;
+    pf->staged_count = 0;
+}
@@ -92,11 +92,14 @@ static int
 __page_read(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
 {
     WT_ADDR_COPY addr;
+    WT_DECL_ITEM(scratch);
     WT_DECL_RET;
-    WT_ITEM tmp;
+    WT_ITEM *buf, tmp;
     WT_PAGE *notused;
     WT_REF_STATE previous_state;
+    const WT_PAGE_HEADER *dsk;
     uint32_t page_flags;
+    void *image;
     bool prepare;
 
     /*
@@ -104,6 +107,7 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
      * memory of the appropriate size.
      */
     WT_CLEAR(tmp);
+    image = NULL;
 
     /* Lock the WT_REF. */
     switch (previous_state = WT_REF_GET_STATE(ref)) {
@@ -179,8 +183,31 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
         }
     }
 
-    /* There's an address, read the backing disk page and build an in-memory version of the page. */
-    WT_ERR(__wt_blkcache_read(session, &tmp, addr.addr, addr.size));
+    /*
+     * There's an address, read the backing disk page and build an in-memory version of the page.
+     *
+     * If the cache allocates page images from slabs, read into a scratch buffer and copy the image
+     * into a slab chunk: the heap only sees scratch memory, which is reused. Images too large for
+     * a slab chunk are copied into allocated memory.
+     */
+    buf = &tmp;
+    if (S2C(session)->cache->slab_enabled) {
+        WT_ERR(__wt_scr_alloc(session, 0, &scratch));
+        buf = scratch;
+    }
+    WT_ERR(__wt_blkcache_read(session, buf, addr.addr, addr.size));
+    page_flags = WT_DATA_IN_ITEM(buf) ? WT_PAGE_DISK_ALLOC : WT_PAGE_DISK_MAPPED;
+    dsk = buf->data;
+    if (buf == scratch && page_flags == WT_PAGE_DISK_ALLOC) {
+        WT_ERR(__wt_cache_slab_alloc(session, dsk->mem_size, &image));
+        if (image == NULL)
+            WT_ERR(__wt_buf_set(session, &tmp, dsk, dsk->mem_size));
+        else {
+            memcpy(image, dsk, dsk->mem_size);
+            page_flags = WT_PAGE_DISK_SLAB;
+        }
+        dsk = image == NULL ? tmp.data : image;
+    }
 
     /*
      * Build the in-memory version of the page. Clear our local reference to the allocated copy of
@@ -191,13 +218,14 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
      * workloads repeatedly reading a page with eviction disabled (e.g., a metadata page), then
      * evicting that page and deciding that is a sign that eviction is unstuck.
      */
-    page_flags = WT_DATA_IN_ITEM(&tmp) ? WT_PAGE_DISK_ALLOC : WT_PAGE_DISK_MAPPED;
     if (LF_ISSET(WT_READ_IGNORE_CACHE_SIZE))
         FLD_SET(page_flags, WT_PAGE_EVICT_NO_PROGRESS);
     if (LF_ISSET(WT_READ_PREFETCH))
         FLD_SET(page_flags, WT_PAGE_PREFETCH);
-    WT_ERR(__wti_page_inmem(session, ref, tmp.data, page_flags, &notused, &prepare));
+    WT_ERR(__wti_page_inmem(session, ref, dsk, page_flags, &notused, &prepare));
     tmp.mem = NULL;
+    image = NULL;
+    __wt_scr_free(session, &scratch);
     if (prepare)
         WT_ERR(__wti_page_inmem_prepare(session, ref));
 
@@ -245,6 +273,9 @@ err:
     WT_REF_SET_STATE(ref, previous_state);
 
     __wt_buf_free(session, &tmp);
+    if (image != NULL)
+        __wt_cache_slab_free(session, image, ((WT_PAGE_HEADER *)image)->mem_size);
+    __wt_scr_free(session, &scratch);
 
     return (ret);
 }
@@ -472,8 +503,10 @@ skip_evict:
                     __wt_atomic_store64(&page->read_gen, WT_READGEN_WONT_NEED);
                 else
                     __wt_cache_read_gen_new(session, page);
-            } else if (!LF_ISSET(WT_READ_NO_GEN))
+            } else if (!LF_ISSET(WT_READ_NO_GEN)) {
                 __wt_cache_read_gen_bump(session, page);
+                __wt_cache_evict_freq_bump(session, page);
+            }
 
             /*
              * Check if we need an autocommit transaction. Starting a transaction can trigger
@@ -45,6 +45,8 @@ __wt_btree_stat_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
       __wt_cache_bytes_plus_overhead(
         S2C(session)->cache, __wt_atomic_load64(&btree->bytes_dirty_total)));
     WT_STATP_DSRC_SET(session, stats, cache_bytes_inuse, __wt_btree_bytes_inuse(session));
+    WT_STATP_DSRC_SET(session, stats, cache_bytes_quota, btree->cache_max);
+    WT_STATP_DSRC_SET(session, stats, cache_bytes_reserve, btree->cache_reserve);
 
     WT_STATP_DSRC_SET(
       session, stats, compress_precomp_leaf_max_page_size, btree->maxleafpage_precomp);
@@ -335,32 +335,21 @@ err:
 }
 
 /*
- * __wt_update_obsolete_check --
- *     Check for obsolete updates and force evict the page if the update list is too long.
+ * __wt_update_obsolete_detach --
+ *     Walk an update list looking for obsolete updates at the end, truncate them from the list and
+ *     return them for the caller to free. The caller must hold the page lock.
  */
-void
-__wt_update_obsolete_check(
-  WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_UPDATE *upd, bool update_accounting)
+WT_UPDATE *
+__wt_update_obsolete_detach(
+  WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *upd, bool update_accounting, u_int *countp)
 {
-    WT_PAGE *page;
-    WT_TXN_GLOBAL *txn_global;
     WT_UPDATE *first, *next;
     size_t size;
     u_int count;
 
     next = NULL;
-    page = cbt->ref->page;
-    txn_global = &S2C(session)->txn_global;
 
-    WT_ASSERT(session, page->modify != NULL);
-    /* If we can't lock it, don't scan, that's okay. */
-    if (WT_PAGE_TRYLOCK(session, page) != 0)
-        return;
     /*
-     * This function identifies obsolete updates, and truncates them from the rest of the chain;
-     * because this routine is called from inside a serialization function, the caller has
-     * responsibility for actually freeing the memory.
-     *
      * Walk the list of updates, looking for obsolete updates at the end.
      *
      * Only updates with globally visible, self-contained data can terminate update chains.
@@ -393,6 +382,7 @@ __wt_update_obsolete_check(
         if (F_ISSET(upd, WT_UPDATE_TO_DELETE_FROM_HS))
             first = NULL;
     }
+    *countp = count;
 
     /*
      * We cannot discard this WT_UPDATE structure, we can only discard WT_UPDATE structures
@@ -401,8 +391,7 @@ __wt_update_obsolete_check(
      */
     if (first != NULL && (next = first->next) != NULL) {
         /*
-         * No need to use a compare and swap because we have obtained a lock at the start of the
-         * function.
+         * No need to use a compare and swap because the caller holds the page lock.
          */
         first->next = NULL;
 
@@ -418,6 +407,40 @@ __wt_update_obsolete_check(
         }
     }
 
+    return (next);
+}
+
+/*
+ * __wt_update_obsolete_check --
+ *     Check for obsolete updates and force evict the page if the update list is too long.
+ */
+void
+__wt_update_obsolete_check(
+  WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_UPDATE *upd, bool update_accounting)
+{
+    WT_BTREE *btree;
+    WT_PAGE *page;
+    WT_TXN_GLOBAL *txn_global;
+    WT_UPDATE *next;
+    uint32_t min_length;
+    u_int count;
+
+    btree = S2BT(session);
+    page = cbt->ref->page;
+    txn_global = &S2C(session)->txn_global;
+
+    WT_ASSERT(session, page->modify != NULL);
+    /* If we can't lock it, don't scan, that's okay. */
+    if (WT_PAGE_TRYLOCK(session, page) != 0)
+        return;
+
+    /*
+     * Identify obsolete updates and truncate them from the rest of the chain. Because this routine
+     * is called from inside a serialization function, the caller has responsibility for actually
+     * freeing the memory.
+     */
+    next = __wt_update_obsolete_detach(session, page, upd, update_accounting, &count);
+
     /*
      * Force evict a page when there are more than WT_THOUSAND updates to a single item. Increasing
      * the minSnapshotHistoryWindowInSeconds to 300 introduced a performance regression in which the
@@ -441,6 +464,19 @@ __wt_update_obsolete_check(
             if (txn_global->has_pinned_timestamp)
                 page->modify->obsolete_check_timestamp = txn_global->pinned_timestamp;
         }
+
+        /*
+         * Remember long chains on the page and the tree so background trimming can find them if
+         * the page isn't updated again once the transaction state has moved forwards. Updates
+         * added to the page until then are counted as they are skipped by the check.
+         */
+        min_length = __wt_atomic_load32(&S2C(session)->chain_trim_min_length);
+        if (min_length != 0 && count > 20) {
+            if (count > __wt_atomic_load32(&page->modify->obsolete_chain_len))
+                __wt_atomic_store32(&page->modify->obsolete_chain_len, count);
+            if (count >= min_length && __wt_atomic_load32(&btree->chain_trim_len) < min_length)
+                __wt_atomic_store32(&btree->chain_trim_len, count);
+        }
     }
 
     WT_PAGE_UNLOCK(session, page);
@@ -1245,6 +1245,7 @@ err:
      * writes and we're about to do a final checkpoint separately from the checkpoint server.
      */
     WT_TRET(__wti_background_compact_server_destroy(session));
+    WT_TRET(__wt_chain_trim_server_destroy(session));
     WT_TRET(__wt_checkpoint_cleanup_destroy(session));
     WT_TRET(__wti_checkpoint_server_destroy(session));
 
@@ -1325,6 +1326,10 @@ __conn_debug_info(WT_CONNECTION *wt_conn, const char *config)
     if (cval.val != 0)
         WT_ERR(__wt_verbose_dump_sessions(session, true));
 
+    WT_ERR(__wt_config_gets(session, cfg, "eviction_trace", &cval));
+    if (cval.val != 0)
+        WT_ERR(__wt_verbose_dump_evict_trace(session));
+
     WT_ERR(__wt_config_gets(session, cfg, "handles", &cval));
     if (cval.val != 0)
         WT_ERR(__wti_verbose_dump_handles(session));
@@ -3056,6 +3061,10 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
         WT_ERR_MSG(session, EINVAL, "buffer_alignment requires posix_memalign");
 #endif
 
+    /* The I/O buffer pool only holds aligned buffers, there's nothing to pool without alignment. */
+    WT_ERR(__wt_config_gets(session, cfg, "io_buffer_pool_max", &cval));
+    conn->bufpool.max = conn->buffer_alignment == 0 ? 0 : (size_t)cval.val;
+
     WT_ERR(__wt_config_gets(session, cfg, "cache_cursors", &cval));
     if (cval.val)
         F_SET(conn, WT_CONN_CACHE_CURSORS);
@@ -3106,6 +3115,12 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
         WT_ERR_MSG(
           session, EINVAL, "direct I/O configuration is incompatible with mmap_all configuration");
 
+    WT_ERR(__wt_config_gets(session, cfg, "io_uring.enabled", &cval));
+    if (cval.val != 0) {
+        WT_ERR(__wt_config_gets(session, cfg, "io_uring.queue_depth", &cval));
+        conn->io_uring_depth = (uint32_t)cval.val;
+    }
+
     WT_ERR(__wt_config_gets(session, cfg, "prefetch.available", &cval));
     conn->prefetch_available = cval.val != 0;
     if (F_ISSET(conn, WT_CONN_IN_MEMORY) && conn->prefetch_available)
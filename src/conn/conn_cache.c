@@ -219,6 +219,21 @@ __cache_config_local(WT_SESSION_IMPL *session, bool shared, const char *cfg[])
     WT_RET(__wt_config_gets(session, cfg, "eviction.evict_sample_inmem", &cval));
     conn->evict_sample_inmem = cval.val != 0;
 
+    WT_RET(__wt_config_gets(session, cfg, "eviction.policy", &cval));
+    cache->evict_policy = WT_EVICT_POLICY_LRU;
+    if (WT_CONFIG_LIT_MATCH("frequency", cval))
+        cache->evict_policy = WT_EVICT_POLICY_FREQUENCY;
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction.tree_selection", &cval));
+    __wt_atomic_storebool(&cache->evict_rank_trees, WT_CONFIG_LIT_MATCH("ranked", cval));
+
+    /* Retrieve the application eviction wait budget and convert from milliseconds */
+    WT_RET(__wt_config_gets(session, cfg, "eviction.app_wait_ms", &cval));
+    __wt_atomic_store64(&cache->evict_app_wait_us, (uint64_t)cval.val * WT_THOUSAND);
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction.pacing_horizon_ms", &cval));
+    __wt_atomic_store64(&cache->evict_pacing_horizon_ms, (uint64_t)cval.val);
+
     /* Retrieve the wait time and convert from milliseconds */
     WT_RET(__wt_config_gets(session, cfg, "cache_max_wait_ms", &cval));
     cache->cache_max_wait_us = (uint64_t)(cval.val * WT_THOUSAND);
@@ -292,7 +307,8 @@ __wti_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
     WT_CACHE *cache;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
-    int i;
+    WT_EVICT_SHARD *shard;
+    uint32_t i;
 
     conn = S2C(session);
 
@@ -305,6 +321,9 @@ __wti_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
     /* Use a common routine for run-time configuration options. */
     WT_RET(__wti_cache_config(session, cfg, false));
 
+    WT_RET(__wti_cache_slab_create(session, cfg));
+    WT_RET(__wt_evict_trace_create(session, cfg));
+
     /*
      * The lowest possible page read-generation has a special meaning, it marks a page for forcible
      * eviction; don't let it happen by accident.
@@ -314,6 +333,7 @@ __wti_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
 
     WT_RET(__wt_cond_auto_alloc(
       session, "cache eviction server", 10 * WT_THOUSAND, WT_MILLION, &cache->evict_cond));
+    WT_RET(__wt_cond_alloc(session, "cache eviction application wait", &cache->evict_app_cond));
     WT_RET(__wt_spin_init(session, &cache->evict_pass_lock, "evict pass"));
     WT_RET(__wt_spin_init(session, &cache->evict_queue_lock, "cache eviction queue"));
     WT_RET(__wt_spin_init(session, &cache->evict_walk_lock, "cache walk"));
@@ -321,17 +341,37 @@ __wti_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
            conn, "evict pass", false, WT_SESSION_NO_DATA_HANDLES, 0, &cache->walk_session)) != 0)
         WT_RET_MSG(NULL, ret, "Failed to create session for eviction walks");
 
-    /* Allocate the LRU eviction queue. */
+    /*
+     * Allocate the LRU eviction queues: a pair of ordinary queues for each shard and an urgent
+     * queue. The number of shards is fixed when the cache is created, based on the maximum number
+     * of eviction threads.
+     */
+    cache->evict_shard_count = WT_MIN(
+      (conn->evict_threads_max + WT_EVICT_SHARD_THREADS - 1) / WT_EVICT_SHARD_THREADS,
+      WT_EVICT_SHARD_MAX);
+    if (cache->evict_shard_count == 0)
+        cache->evict_shard_count = 1;
+    cache->evict_queue_count = 2 * cache->evict_shard_count + 1;
+    WT_RET(__wt_calloc_def(session, cache->evict_queue_count, &cache->evict_queues));
+    WT_RET(__wt_calloc_def(session, cache->evict_shard_count, &cache->evict_shards));
+
+    WT_RET(__wt_calloc_def(session, WT_EVICT_RANK_TREES_MAX, &cache->evict_ranked));
+
     cache->evict_slots = WT_EVICT_WALK_BASE + WT_EVICT_WALK_INCR;
-    for (i = 0; i < WT_EVICT_QUEUE_MAX; ++i) {
+    for (i = 0; i < cache->evict_queue_count; ++i) {
         WT_RET(__wt_calloc_def(session, cache->evict_slots, &cache->evict_queues[i].evict_queue));
         WT_RET(__wt_spin_init(session, &cache->evict_queues[i].evict_lock, "cache eviction"));
     }
 
     /* Ensure there are always non-NULL queues. */
-    cache->evict_current_queue = cache->evict_fill_queue = &cache->evict_queues[0];
-    cache->evict_other_queue = &cache->evict_queues[1];
-    cache->evict_urgent_queue = &cache->evict_queues[WT_EVICT_URGENT_QUEUE];
+    for (i = 0; i < cache->evict_shard_count; ++i) {
+        shard = &cache->evict_shards[i];
+        WT_RET(__wt_spin_init(session, &shard->evict_queue_lock, "cache eviction shard"));
+        shard->evict_queues = &cache->evict_queues[2 * i];
+        shard->evict_current_queue = shard->evict_fill_queue = &shard->evict_queues[0];
+        shard->evict_other_queue = &shard->evict_queues[1];
+    }
+    cache->evict_urgent_queue = &cache->evict_queues[cache->evict_queue_count - 1];
 
     /*
      * We get/set some values in the cache statistics (rather than have two copies), configure them.
@@ -379,6 +419,11 @@ __wti_cache_stats_update(WT_SESSION_IMPL *session)
     WT_STATP_CONN_SET(session, stats, cache_bytes_leaf, leaf);
     WT_STATP_CONN_SET(session, stats, cache_bytes_other, __wt_cache_bytes_other(cache));
     WT_STATP_CONN_SET(session, stats, cache_bytes_updates, __wt_cache_bytes_updates(cache));
+    WT_STATP_CONN_SET(session, stats, cache_slab_bytes, __wt_atomic_load64(&cache->slab_bytes));
+    WT_STATP_CONN_SET(
+      session, stats, cache_slab_bytes_inuse, __wt_atomic_load64(&cache->slab_bytes_inuse));
+    WT_STATP_CONN_SET(session, stats, cache_slab_bytes_requested,
+      __wt_atomic_load64(&cache->slab_bytes_requested));
 
     WT_STATP_CONN_SET(session, stats, cache_eviction_maximum_page_size,
       __wt_atomic_load64(&cache->evict_max_page_size));
@@ -389,6 +434,15 @@ __wti_cache_stats_update(WT_SESSION_IMPL *session)
     WT_STATP_CONN_SET(
       session, stats, cache_pages_dirty, cache->pages_dirty_intl + cache->pages_dirty_leaf);
 
+    WT_STATP_CONN_SET(
+      session, stats, cache_eviction_pacing_inuse_rate, (int64_t)cache->evict_pacing_inuse_rate);
+    WT_STATP_CONN_SET(
+      session, stats, cache_eviction_pacing_dirty_rate, (int64_t)cache->evict_pacing_dirty_rate);
+    WT_STATP_CONN_SET(session, stats, cache_eviction_pacing_inuse_predicted,
+      cache->evict_pacing_inuse_predicted);
+    WT_STATP_CONN_SET(session, stats, cache_eviction_pacing_dirty_predicted,
+      cache->evict_pacing_dirty_predicted);
+
     WT_STATP_CONN_SET(session, stats, cache_eviction_state, __wt_atomic_load32(&cache->flags));
     WT_STATP_CONN_SET(session, stats, cache_eviction_aggressive_set, cache->evict_aggressive_score);
     WT_STATP_CONN_SET(session, stats, cache_eviction_empty_score, cache->evict_empty_score);
@@ -423,7 +477,7 @@ __wti_cache_destroy(WT_SESSION_IMPL *session)
     WT_CACHE *cache;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
-    int i;
+    uint32_t i;
 
     conn = S2C(session);
     cache = conn->cache;
@@ -454,16 +508,27 @@ __wti_cache_destroy(WT_SESSION_IMPL *session)
           cache->pages_dirty_intl + cache->pages_dirty_leaf);
 
     __wt_cond_destroy(session, &cache->evict_cond);
+    __wt_cond_destroy(session, &cache->evict_app_cond);
     __wt_spin_destroy(session, &cache->evict_pass_lock);
     __wt_spin_destroy(session, &cache->evict_queue_lock);
     __wt_spin_destroy(session, &cache->evict_walk_lock);
     if (cache->walk_session != NULL)
         WT_TRET(__wt_session_close_internal(cache->walk_session));
 
-    for (i = 0; i < WT_EVICT_QUEUE_MAX; ++i) {
-        __wt_spin_destroy(session, &cache->evict_queues[i].evict_lock);
-        __wt_free(session, cache->evict_queues[i].evict_queue);
-    }
+    if (cache->evict_queues != NULL)
+        for (i = 0; i < cache->evict_queue_count; ++i) {
+            __wt_spin_destroy(session, &cache->evict_queues[i].evict_lock);
+            __wt_free(session, cache->evict_queues[i].evict_queue);
+        }
+    if (cache->evict_shards != NULL)
+        for (i = 0; i < cache->evict_shard_count; ++i)
+            __wt_spin_destroy(session, &cache->evict_shards[i].evict_queue_lock);
+    __wt_free(session, cache->evict_queues);
+    __wt_free(session, cache->evict_shards);
+    __wt_free(session, cache->evict_ranked);
+
+    __wti_cache_slab_destroy(session);
+    __wt_evict_trace_destroy(session);
 
     __wt_free(session, conn->cache);
     return (ret);
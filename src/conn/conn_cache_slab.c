@@ -0,0 +1,313 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Page images read from disk live as long as their page stays in the cache, then are freed in an
+ * order unrelated to the order they were allocated in. Allocating them from the heap fragments it,
+ * the process size ends up well above the cache size. Instead, allocate page images from slabs of
+ * chunks of the same size, and return the memory of freed chunks to the system without giving up
+ * the address space, so the memory the process holds follows the memory the cache holds.
+ */
+
+/*
+ * Chunk sizes of the size classes, in granules. Classes are coarser as chunks get larger, bounding
+ * the memory lost to rounding up while keeping the number of partially used slabs small.
+ */
+static const uint8_t __cache_slab_granules[WT_CACHE_SLAB_CLASSES] = {
+  1, 2, 3, 4, 5, 6, 7, 8, 10, 12, 14, 16, 20, 24, 28, 32};
+
+/*
+ * __cache_slab_new --
+ *     Get a slab for a size class, reusing an empty slab if there is one.
+ */
+static int
+__cache_slab_new(WT_SESSION_IMPL *session, uint8_t class_id, WT_CACHE_SLAB **slabp)
+{
+    WT_CACHE *cache;
+    WT_CACHE_SLAB *slab;
+    uint32_t i;
+    void *mem;
+
+    *slabp = NULL;
+    cache = S2C(session)->cache;
+    mem = NULL;
+
+    __wt_spin_lock(session, &cache->slab_empty_lock);
+    if (cache->slab_empty_count > 0)
+        mem = cache->slab_empty[--cache->slab_empty_count];
+    __wt_spin_unlock(session, &cache->slab_empty_lock);
+
+    if (mem == NULL) {
+#if defined(HAVE_POSIX_MEMALIGN)
+        WT_DECL_RET;
+
+        WT_STAT_CONN_INCR(session, memory_allocation);
+        if ((ret = posix_memalign(&mem, WT_CACHE_SLAB_SIZE, WT_CACHE_SLAB_SIZE)) != 0)
+            WT_RET_MSG(session, ret, "cache slab allocation of %d bytes failed",
+              (int)WT_CACHE_SLAB_SIZE);
+#else
+        WT_RET_MSG(session, ENOTSUP, "cache slabs require posix_memalign");
+#endif
+#ifdef MADV_HUGEPAGE
+        /* Huge pages are advisory, ignore failure. */
+        if (cache->slab_hugepages)
+            (void)madvise(mem, WT_CACHE_SLAB_SIZE, MADV_HUGEPAGE);
+#endif
+        (void)__wt_atomic_add64(&cache->slab_bytes, WT_CACHE_SLAB_SIZE);
+        WT_STAT_CONN_INCR(session, cache_slab_allocated);
+    }
+
+    /* The slab header takes the first granule, build the list of free chunks from the rest. */
+    slab = mem;
+    slab->class_id = class_id;
+    slab->chunk_size = (size_t)__cache_slab_granules[class_id] * WT_CACHE_SLAB_GRANULE;
+    slab->chunks = (uint32_t)((WT_CACHE_SLAB_SIZE - WT_CACHE_SLAB_GRANULE) / slab->chunk_size);
+    slab->used = 0;
+    for (i = 0; i < slab->chunks; ++i)
+        slab->next[i] = (uint16_t)(i + 1);
+    slab->next[slab->chunks - 1] = WT_CACHE_SLAB_CHUNK_NONE;
+    slab->free = 0;
+
+    *slabp = slab;
+    return (0);
+}
+
+/*
+ * __cache_slab_discard --
+ *     Keep an empty slab for reuse by any size class, or free its memory.
+ */
+static void
+__cache_slab_discard(WT_SESSION_IMPL *session, WT_CACHE_SLAB *slab, bool keep)
+{
+    WT_CACHE *cache;
+
+    cache = S2C(session)->cache;
+
+    if (keep) {
+        __wt_spin_lock(session, &cache->slab_empty_lock);
+        if (cache->slab_empty_count < WT_CACHE_SLAB_EMPTY_MAX) {
+            cache->slab_empty[cache->slab_empty_count++] = slab;
+            slab = NULL;
+        }
+        __wt_spin_unlock(session, &cache->slab_empty_lock);
+        if (slab == NULL)
+            return;
+    }
+
+    (void)__wt_atomic_sub64(&cache->slab_bytes, WT_CACHE_SLAB_SIZE);
+    WT_STAT_CONN_INCR(session, cache_slab_freed);
+
+    __wt_free(session, slab);
+}
+
+/*
+ * __wt_cache_slab_alloc --
+ *     Allocate memory for a page image from the cache's slabs. Return NULL if slabs aren't
+ *     configured or the image is too large for the largest size class, the caller allocates from
+ *     the heap in that case.
+ */
+int
+__wt_cache_slab_alloc(WT_SESSION_IMPL *session, size_t size, void *retp)
+{
+    WT_CACHE *cache;
+    WT_CACHE_SLAB *new_slab, *slab;
+    WT_CACHE_SLAB_CLASS *slab_class;
+    size_t chunk_size, granules;
+    uint16_t chunk;
+    uint8_t class_id;
+
+    *(void **)retp = NULL;
+    cache = S2C(session)->cache;
+
+    if (!cache->slab_enabled || size == 0)
+        return (0);
+    granules = (size + WT_CACHE_SLAB_GRANULE - 1) / WT_CACHE_SLAB_GRANULE;
+    if (granules > __cache_slab_granules[WT_CACHE_SLAB_CLASSES - 1])
+        return (0);
+    for (class_id = 0; __cache_slab_granules[class_id] < granules; ++class_id)
+        ;
+    slab_class = &cache->slab_classes[class_id];
+
+    /*
+     * Take a chunk from the first slab with free chunks. If there isn't one, get a new slab outside
+     * the lock and try again: another thread may have added a slab in the meantime.
+     */
+    for (new_slab = NULL;;) {
+        __wt_spin_lock(session, &slab_class->lock);
+        if ((slab = TAILQ_FIRST(&slab_class->slabqh)) == NULL && new_slab != NULL) {
+            TAILQ_INSERT_HEAD(&slab_class->slabqh, new_slab, q);
+            slab = new_slab;
+            new_slab = NULL;
+        }
+        if (slab != NULL)
+            break;
+        __wt_spin_unlock(session, &slab_class->lock);
+
+        WT_RET(__cache_slab_new(session, class_id, &new_slab));
+    }
+
+    ++slab->used;
+    chunk = slab->free;
+    slab->free = slab->next[chunk];
+    if (slab->free == WT_CACHE_SLAB_CHUNK_NONE)
+        TAILQ_REMOVE(&slab_class->slabqh, slab, q);
+    chunk_size = slab->chunk_size;
+    __wt_spin_unlock(session, &slab_class->lock);
+
+    if (new_slab != NULL)
+        __cache_slab_discard(session, new_slab, true);
+
+    (void)__wt_atomic_add64(&cache->slab_bytes_inuse, chunk_size);
+    (void)__wt_atomic_add64(&cache->slab_bytes_requested, size);
+
+    *(void **)retp = (uint8_t *)slab + WT_CACHE_SLAB_GRANULE + chunk * chunk_size;
+    return (0);
+}
+
+/*
+ * __wt_cache_slab_free --
+ *     Return a page image allocated by __wt_cache_slab_alloc to its slab.
+ */
+void
+__wt_cache_slab_free(WT_SESSION_IMPL *session, void *p, size_t size)
+{
+    WT_CACHE *cache;
+    WT_CACHE_SLAB *discard, *slab;
+    WT_CACHE_SLAB_CLASS *slab_class;
+    size_t chunk_size;
+    uint16_t chunk;
+
+    cache = S2C(session)->cache;
+    discard = NULL;
+
+    slab = (WT_CACHE_SLAB *)((uintptr_t)p & ~(uintptr_t)(WT_CACHE_SLAB_SIZE - 1));
+    slab_class = &cache->slab_classes[slab->class_id];
+    chunk_size = slab->chunk_size;
+    chunk = (uint16_t)((WT_PTRDIFF(p, slab) - WT_CACHE_SLAB_GRANULE) / chunk_size);
+    WT_ASSERT(session, size <= chunk_size);
+
+#ifdef HAVE_DIAGNOSTIC
+    __wt_explicit_overwrite(p, size);
+#endif
+
+    /*
+     * Return the chunk's memory to the system. Prefer lazily freeing it: the system reclaims the
+     * memory when it needs it, and reusing the chunk before then doesn't fault. Don't split huge
+     * pages, slabs backed by huge pages keep their memory.
+     */
+    if (!cache->slab_hugepages) {
+#if defined(MADV_FREE)
+        (void)madvise(p, chunk_size, MADV_FREE);
+#elif defined(MADV_DONTNEED)
+        (void)madvise(p, chunk_size, MADV_DONTNEED);
+#endif
+    }
+
+    __wt_spin_lock(session, &slab_class->lock);
+
+    /* A full slab isn't on the list, add it at the end so chunks come from fuller slabs first. */
+    if (slab->free == WT_CACHE_SLAB_CHUNK_NONE)
+        TAILQ_INSERT_TAIL(&slab_class->slabqh, slab, q);
+    slab->next[chunk] = slab->free;
+    slab->free = chunk;
+
+    /* Take empty slabs out of the size class, any class can reuse them. */
+    if (--slab->used == 0) {
+        TAILQ_REMOVE(&slab_class->slabqh, slab, q);
+        discard = slab;
+    }
+    __wt_spin_unlock(session, &slab_class->lock);
+
+    (void)__wt_atomic_sub64(&cache->slab_bytes_inuse, chunk_size);
+    (void)__wt_atomic_sub64(&cache->slab_bytes_requested, size);
+
+    if (discard != NULL)
+        __cache_slab_discard(session, discard, true);
+}
+
+/*
+ * __wt_cache_slab_chunk_size --
+ *     Return the size of the chunk holding a page image allocated by __wt_cache_slab_alloc.
+ */
+size_t
+__wt_cache_slab_chunk_size(void *p)
+{
+    WT_CACHE_SLAB *slab;
+
+    slab = (WT_CACHE_SLAB *)((uintptr_t)p & ~(uintptr_t)(WT_CACHE_SLAB_SIZE - 1));
+    return (slab->chunk_size);
+}
+
+/*
+ * __wti_cache_slab_create --
+ *     Configure the cache's slab allocator.
+ */
+int
+__wti_cache_slab_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CACHE *cache;
+    WT_CONFIG_ITEM cval;
+    u_int i;
+
+    cache = S2C(session)->cache;
+
+    WT_RET(__wt_config_gets(session, cfg, "cache_slab.enabled", &cval));
+    if (cval.val == 0)
+        return (0);
+#if !defined(HAVE_POSIX_MEMALIGN)
+    WT_RET_MSG(session, EINVAL, "cache_slab requires posix_memalign");
+#endif
+
+    WT_RET(__wt_config_gets(session, cfg, "cache_slab.hugepages", &cval));
+    cache->slab_hugepages = cval.val != 0;
+
+    WT_RET(__wt_spin_init(session, &cache->slab_empty_lock, "cache slab empty"));
+    WT_RET(__wt_calloc_def(session, WT_CACHE_SLAB_CLASSES, &cache->slab_classes));
+    for (i = 0; i < WT_CACHE_SLAB_CLASSES; ++i) {
+        WT_RET(__wt_spin_init(session, &cache->slab_classes[i].lock, "cache slab"));
+        TAILQ_INIT(&cache->slab_classes[i].slabqh);
+    }
+    cache->slab_enabled = true;
+    return (0);
+}
+
+/*
+ * __wti_cache_slab_destroy --
+ *     Discard the cache's slabs. Only slabs with free chunks can be found, slabs that are still
+ *     full belong to pages the application chose to leak on close.
+ */
+void
+__wti_cache_slab_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CACHE *cache;
+    WT_CACHE_SLAB *slab;
+    WT_CACHE_SLAB_CLASS *slab_class;
+    u_int i;
+
+    cache = S2C(session)->cache;
+
+    if (cache->slab_classes == NULL)
+        return;
+
+    for (i = 0; i < WT_CACHE_SLAB_CLASSES; ++i) {
+        slab_class = &cache->slab_classes[i];
+        while ((slab = TAILQ_FIRST(&slab_class->slabqh)) != NULL) {
+            TAILQ_REMOVE(&slab_class->slabqh, slab, q);
+            __cache_slab_discard(session, slab, false);
+        }
+        __wt_spin_destroy(session, &slab_class->lock);
+    }
+    __wt_free(session, cache->slab_classes);
+
+    while (cache->slab_empty_count > 0)
+        __cache_slab_discard(session, cache->slab_empty[--cache->slab_empty_count], false);
+    __wt_spin_destroy(session, &cache->slab_empty_lock);
+    cache->slab_enabled = false;
+}
@@ -21,6 +21,18 @@ __background_compact_server_run_chk(WT_SESSION_IMPL *session)
     return (FLD_ISSET(S2C(session)->server_flags, WT_CONN_SERVER_COMPACT));
 }
 
+/*
+ * __background_compact_server_idle_chk --
+ *     Check to decide if the compact server should wait for work. The server can miss the signal
+ *     to change state while waiting for the worker threads, so don't wait if it is pending.
+ */
+static bool
+__background_compact_server_idle_chk(WT_SESSION_IMPL *session)
+{
+    return (__background_compact_server_run_chk(session) &&
+      !__wt_atomic_loadbool(&S2C(session)->background_compact.signalled));
+}
+
 /*
  * __background_compact_exclude_list_add --
  *     Add the entry to the exclude hash table.
@@ -230,6 +242,50 @@ __background_compact_get_stat(WT_SESSION_IMPL *session, const char *uri, int64_t
     return (NULL);
 }
 
+/*
+ * __background_compact_skip_tracked --
+ *     Check the statistics tracked for a file to decide whether to skip compacting it. Called with
+ *     the background compaction lock held.
+ */
+static bool
+__background_compact_skip_tracked(WT_SESSION_IMPL *session, const char *uri, int64_t id)
+{
+    WT_BACKGROUND_COMPACT_STAT *compact_stat;
+    WT_CONNECTION_IMPL *conn;
+    uint64_t cur_time;
+
+    conn = S2C(session);
+
+    /* If we haven't seen this file before we should try and compact it. */
+    compact_stat = __background_compact_get_stat(session, uri, id);
+    if (compact_stat == NULL)
+        return (false);
+
+    /* If we are running once, force compaction on the file. */
+    if (conn->background_compact.run_once)
+        return (false);
+
+    /* Proceed with compaction when the file has not been compacted for some time. */
+    cur_time = __wt_clock(session);
+    if (WT_CLOCKDIFF_SEC(cur_time, compact_stat->prev_compact_time) >=
+      conn->background_compact.max_file_skip_time)
+        return (false);
+
+    /*
+     * If the last compaction pass was unsuccessful or less successful than the average, skip it for
+     * some time.
+     */
+    if (!compact_stat->prev_compact_success ||
+      compact_stat->bytes_rewritten < conn->background_compact.bytes_rewritten_ema) {
+        compact_stat->skip_count++;
+        conn->background_compact.files_skipped++;
+        WT_STAT_CONN_INCR(session, background_compact_skipped);
+        return (true);
+    }
+
+    return (false);
+}
+
 /*
  * __background_compact_should_skip --
  *     Check whether we should proceed with calling compaction on the given file.
@@ -237,11 +293,9 @@ __background_compact_get_stat(WT_SESSION_IMPL *session, const char *uri, int64_t
 static int
 __background_compact_should_skip(WT_SESSION_IMPL *session, const char *uri, int64_t id, bool *skipp)
 {
-    WT_BACKGROUND_COMPACT_STAT *compact_stat;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     wt_off_t file_size;
-    uint64_t cur_time;
     const char *filename;
 
     conn = S2C(session);
@@ -272,41 +326,10 @@ __background_compact_should_skip(WT_SESSION_IMPL *session, const char *uri, int6
         return (0);
     }
 
-    /* If we haven't seen this file before we should try and compact it. */
-    compact_stat = __background_compact_get_stat(session, uri, id);
-    if (compact_stat == NULL) {
-        *skipp = false;
-        return (0);
-    }
-
-    /* If we are running once, force compaction on the file. */
-    if (conn->background_compact.run_once) {
-        *skipp = false;
-        return (0);
-    }
-
-    /* Proceed with compaction when the file has not been compacted for some time. */
-    cur_time = __wt_clock(session);
-    if (WT_CLOCKDIFF_SEC(cur_time, compact_stat->prev_compact_time) >=
-      conn->background_compact.max_file_skip_time) {
-        *skipp = false;
-        return (0);
-    }
-
-    /*
-     * If the last compaction pass was unsuccessful or less successful than the average, skip it for
-     * some time.
-     */
-    if (!compact_stat->prev_compact_success ||
-      compact_stat->bytes_rewritten < conn->background_compact.bytes_rewritten_ema) {
-        compact_stat->skip_count++;
-        conn->background_compact.files_skipped++;
-        WT_STAT_CONN_INCR(session, background_compact_skipped);
-        *skipp = true;
-        return (0);
-    }
-
-    *skipp = false;
+    /* The tracking list is shared with the worker threads. */
+    __wt_spin_lock(session, &conn->background_compact.lock);
+    *skipp = __background_compact_skip_tracked(session, uri, id);
+    __wt_spin_unlock(session, &conn->background_compact.lock);
     return (0);
 }
 
@@ -319,14 +342,18 @@ __wt_background_compact_start(WT_SESSION_IMPL *session)
 {
     WT_BACKGROUND_COMPACT_STAT *compact_stat;
     WT_BM *bm;
+    WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     uint32_t id;
     const char *uri;
 
     bm = S2BT(session)->bm;
+    conn = S2C(session);
     id = S2BT(session)->id;
     uri = session->dhandle->name;
 
+    /* The tracking list is shared between the server and the worker threads. */
+    __wt_spin_lock(session, &conn->background_compact.lock);
     compact_stat = __background_compact_get_stat(session, uri, id);
 
     /* If the table is not in the list, allocate a new entry and insert it. */
@@ -341,9 +368,11 @@ __wt_background_compact_start(WT_SESSION_IMPL *session)
     WT_ERR(bm->size(bm, session, &compact_stat->start_size));
     compact_stat->prev_compact_time = __wt_clock(session);
 
+    __wt_spin_unlock(session, &conn->background_compact.lock);
     return (0);
 
 err:
+    __wt_spin_unlock(session, &conn->background_compact.lock);
     __wt_free(session, compact_stat);
 
     return (ret);
@@ -360,21 +389,22 @@ __wt_background_compact_end(WT_SESSION_IMPL *session)
     WT_BACKGROUND_COMPACT_STAT *compact_stat;
     WT_BM *bm;
     WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
     wt_off_t bytes_recovered;
     int64_t id;
     const char *uri;
 
     bm = S2BT(session)->bm;
+    conn = S2C(session);
     id = S2BT(session)->id;
     uri = session->dhandle->name;
 
+    __wt_spin_lock(session, &conn->background_compact.lock);
     compact_stat = __background_compact_get_stat(session, uri, id);
 
     WT_ASSERT(session, compact_stat != NULL);
 
-    conn = S2C(session);
-
-    WT_RET(bm->size(bm, session, &compact_stat->end_size));
+    WT_ERR(bm->size(bm, session, &compact_stat->end_size));
     compact_stat->bytes_rewritten = bm->block->compact_bytes_rewritten;
     bytes_recovered = compact_stat->start_size - compact_stat->end_size;
 
@@ -404,7 +434,9 @@ __wt_background_compact_end(WT_SESSION_IMPL *session)
           session, background_compact_ema, conn->background_compact.bytes_rewritten_ema);
     }
 
-    return (0);
+err:
+    __wt_spin_unlock(session, &conn->background_compact.lock);
+    return (ret);
 }
 
 /*
@@ -429,6 +461,7 @@ __background_compact_list_cleanup(
       cleanup_type == BACKGROUND_COMPACT_CLEANUP_OFF)
         cleanup_stat = true;
 
+    __wt_spin_lock(session, &conn->background_compact.lock);
     for (i = 0; i < conn->hash_size; i++) {
         TAILQ_FOREACH_SAFE(
           compact_stat, &conn->background_compact.stat_hash[i], hashq, temp_compact_stat)
@@ -439,6 +472,7 @@ __background_compact_list_cleanup(
                 __background_compact_list_remove(session, compact_stat, i);
         }
     }
+    __wt_spin_unlock(session, &conn->background_compact.lock);
 
     if (cleanup_type == BACKGROUND_COMPACT_CLEANUP_EXIT)
         __wt_free(session, conn->background_compact.stat_hash);
@@ -511,6 +545,219 @@ err:
     return (ret);
 }
 
+/*
+ * __background_compact_file --
+ *     Compact a file, silencing the errors background compaction expects.
+ */
+static int
+__background_compact_file(WT_SESSION_IMPL *session, const char *uri, const char *config)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION *wt_session;
+    bool running;
+
+    conn = S2C(session);
+    wt_session = (WT_SESSION *)session;
+
+    ret = wt_session->compact(wt_session, uri, config);
+
+    /*
+     * Compact may return:
+     * - EBUSY or WT_ROLLBACK for various reasons.
+     * - ENOENT if the underlying file does not exist.
+     * - ETIMEDOUT if the configured timer has elapsed.
+     * - WT_ERROR if the background compaction has been interrupted.
+     */
+    if (ret != 0) {
+        WT_STAT_CONN_INCR(session, background_compact_fail);
+        /* The following errors are always silenced. */
+        if (ret == EBUSY || ret == ENOENT || ret == ETIMEDOUT || ret == WT_ROLLBACK) {
+            if (ret == EBUSY && __wt_cache_stuck(session))
+                WT_STAT_CONN_INCR(session, background_compact_fail_cache_pressure);
+            else if (ret == ETIMEDOUT)
+                WT_STAT_CONN_INCR(session, background_compact_timeout);
+            ret = 0;
+        }
+
+        /*
+         * Verify WT_ERROR comes from an interruption by checking the server is no longer running.
+         */
+        else if (ret == WT_ERROR) {
+            __wt_spin_lock(session, &conn->background_compact.lock);
+            running = __wt_atomic_loadbool(&conn->background_compact.running);
+            __wt_spin_unlock(session, &conn->background_compact.lock);
+            if (!running) {
+                WT_STAT_CONN_INCR(session, background_compact_interrupted);
+                ret = 0;
+            }
+        }
+    } else
+        WT_STAT_CONN_INCR(session, background_compact_success);
+
+    return (ret);
+}
+
+/*
+ * __background_compact_work_clear --
+ *     Discard the files queued for the worker threads. Called with the background compaction lock
+ *     held.
+ */
+static void
+__background_compact_work_clear(WT_SESSION_IMPL *session)
+{
+    WT_BACKGROUND_COMPACT_WORK *work;
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+
+    while ((work = TAILQ_FIRST(&conn->background_compact.workqh)) != NULL) {
+        TAILQ_REMOVE(&conn->background_compact.workqh, work, q);
+        --conn->background_compact.work_queued;
+        __wt_free(session, work->uri);
+        __wt_free(session, work->config);
+        __wt_free(session, work);
+    }
+}
+
+/*
+ * __background_compact_worker_run --
+ *     Entry function for a background compaction worker thread. This is called repeatedly from the
+ *     thread group code so it does not need to loop itself.
+ */
+static int
+__background_compact_worker_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_BACKGROUND_COMPACT_WORK *work;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    WT_UNUSED(thread);
+    conn = S2C(session);
+
+    /* Mark the session as a background compaction session. */
+    F_SET(session, WT_SESSION_BACKGROUND_COMPACT);
+
+    __wt_spin_lock(session, &conn->background_compact.lock);
+    if ((work = TAILQ_FIRST(&conn->background_compact.workqh)) != NULL) {
+        TAILQ_REMOVE(&conn->background_compact.workqh, work, q);
+        --conn->background_compact.work_queued;
+        (void)__wt_atomic_add32(&conn->background_compact.work_active, 1);
+        WT_STAT_CONN_INCR(session, background_compact_files_active);
+    }
+    __wt_spin_unlock(session, &conn->background_compact.lock);
+
+    /* If there is no work for the thread to do, wait for the server to queue a file. */
+    if (work == NULL) {
+        __wt_cond_wait(session, conn->background_compact.workers.wait_cond, WT_MILLION,
+          __background_compact_server_run_chk);
+        return (0);
+    }
+
+    ret = __background_compact_file(session, work->uri, work->config);
+
+    /* Let the server know a worker is available. */
+    (void)__wt_atomic_sub32(&conn->background_compact.work_active, 1);
+    WT_STAT_CONN_DECR(session, background_compact_files_active);
+    __wt_cond_signal(session, conn->background_compact.cond);
+
+    __wt_free(session, work->uri);
+    __wt_free(session, work->config);
+    __wt_free(session, work);
+    return (ret);
+}
+
+/*
+ * __background_compact_workers_wait --
+ *     Wait until no more than the given number of files are queued or being compacted by the
+ *     worker threads. Disabling background compaction interrupts the workers, so this doesn't wait
+ *     long once the server has been told to stop.
+ */
+static void
+__background_compact_workers_wait(WT_SESSION_IMPL *session, uint32_t max_outstanding)
+{
+    WT_CONNECTION_IMPL *conn;
+    uint32_t outstanding;
+
+    conn = S2C(session);
+
+    for (;;) {
+        __wt_spin_lock(session, &conn->background_compact.lock);
+        outstanding = conn->background_compact.work_queued +
+          __wt_atomic_load32(&conn->background_compact.work_active);
+        __wt_spin_unlock(session, &conn->background_compact.lock);
+
+        if (outstanding <= max_outstanding || !__background_compact_server_run_chk(session))
+            return;
+
+        __wt_cond_wait(session, conn->background_compact.cond, 100 * WT_THOUSAND,
+          __background_compact_server_run_chk);
+    }
+}
+
+/*
+ * __background_compact_workers_queue --
+ *     Queue a file for the worker threads, waiting for one of them to be available.
+ */
+static int
+__background_compact_workers_queue(
+  WT_SESSION_IMPL *session, uint32_t nworkers, const char *uri, const char *config)
+{
+    WT_BACKGROUND_COMPACT_WORK *work;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    __background_compact_workers_wait(session, nworkers - 1);
+
+    WT_RET(__wt_calloc_one(session, &work));
+    WT_ERR(__wt_strdup(session, uri, &work->uri));
+    WT_ERR(__wt_strdup(session, config, &work->config));
+
+    /* Background compaction may have been disabled while waiting, don't queue the file then. */
+    __wt_spin_lock(session, &conn->background_compact.lock);
+    if (__wt_atomic_loadbool(&conn->background_compact.running)) {
+        TAILQ_INSERT_TAIL(&conn->background_compact.workqh, work, q);
+        ++conn->background_compact.work_queued;
+        work = NULL;
+    }
+    __wt_spin_unlock(session, &conn->background_compact.lock);
+
+    __wt_cond_signal(session, conn->background_compact.workers.wait_cond);
+
+err:
+    if (work != NULL) {
+        __wt_free(session, work->uri);
+        __wt_free(session, work->config);
+        __wt_free(session, work);
+    }
+    return (ret);
+}
+
+/*
+ * __background_compact_workers_config --
+ *     Start, resize or stop the worker threads to match the number of threads background
+ *     compaction is configured with.
+ */
+static int
+__background_compact_workers_config(WT_SESSION_IMPL *session, uint32_t nworkers)
+{
+    WT_THREAD_GROUP *group;
+    uint32_t session_flags;
+
+    group = &S2C(session)->background_compact.workers;
+    session_flags = WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL;
+
+    if (group->alloc == 0)
+        return (nworkers == 0 ?
+            0 :
+            __wt_thread_group_create(session, group, "compact-worker", nworkers, nworkers,
+              session_flags, __background_compact_server_run_chk, __background_compact_worker_run,
+              NULL));
+    return (__wt_thread_group_resize(session, group, nworkers, nworkers, session_flags));
+}
+
 /*
  * __background_compact_server --
  *     The compact server thread.
@@ -523,13 +770,13 @@ __background_compact_server(void *arg)
     WT_DECL_ITEM(next_uri);
     WT_DECL_ITEM(uri);
     WT_DECL_RET;
-    WT_SESSION *wt_session;
     WT_SESSION_IMPL *session;
-    bool full_iteration, running;
+    uint32_t nworkers;
+    bool cleanup, full_iteration, reconfig_workers, running;
 
     session = arg;
     conn = S2C(session);
-    wt_session = (WT_SESSION *)session;
+    nworkers = 0;
     full_iteration = running = false;
 
     WT_ERR(__wt_scr_alloc(session, 1024, &config));
@@ -567,13 +814,14 @@ __background_compact_server(void *arg)
             /* Check periodically in case the signal was missed. */
             __wt_cond_wait(session, conn->background_compact.cond,
               conn->background_compact.full_iteration_wait_time * WT_MILLION,
-              __background_compact_server_run_chk);
+              __background_compact_server_idle_chk);
         }
 
         /* Check if we're quitting or being reconfigured. */
         if (!__background_compact_server_run_chk(session))
             break;
 
+        cleanup = reconfig_workers = false;
         __wt_spin_lock(session, &conn->background_compact.lock);
         running = __wt_atomic_loadbool(&conn->background_compact.running);
 
@@ -582,18 +830,35 @@ __background_compact_server(void *arg)
 
             /* If configured to run once, start from the beginning. */
             if (running && conn->background_compact.run_once)
-                WT_ERR(__wt_buf_set(session, uri, WT_BACKGROUND_COMPACT_URI_PREFIX,
-                  strlen(WT_BACKGROUND_COMPACT_URI_PREFIX) + 1));
+                ret = __wt_buf_set(session, uri, WT_BACKGROUND_COMPACT_URI_PREFIX,
+                  strlen(WT_BACKGROUND_COMPACT_URI_PREFIX) + 1);
+
+            /* If disabled, discard any queued files and clean up the stats. */
+            if (!running) {
+                __background_compact_work_clear(session);
+                cleanup = true;
+            }
 
-            /* If disabled, clean up the stats. */
-            if (!running)
-                __background_compact_list_cleanup(session, BACKGROUND_COMPACT_CLEANUP_OFF);
+            /* Compact files with worker threads if configured with more than one thread. */
+            nworkers = running && conn->background_compact.workers_max > 1 ?
+              conn->background_compact.workers_max :
+              0;
+            reconfig_workers = true;
 
             conn->background_compact.signalled = false;
             WT_STAT_CONN_SET(session, background_compact_running, running);
         }
 
         __wt_spin_unlock(session, &conn->background_compact.lock);
+        WT_ERR(ret);
+
+        /* The worker threads update the tracking list, wait for them before cleaning it up. */
+        if (cleanup) {
+            __background_compact_workers_wait(session, 0);
+            __background_compact_list_cleanup(session, BACKGROUND_COMPACT_CLEANUP_OFF);
+        }
+        if (reconfig_workers)
+            WT_ERR(__background_compact_workers_config(session, nworkers));
 
         /*
          * This check is necessary as we may have timed out while waiting on the mutex to be
@@ -605,8 +870,14 @@ __background_compact_server(void *arg)
         /* Find the next URI to compact. */
         WT_ERR_NOTFOUND_OK(__background_compact_find_next_uri(session, uri, next_uri), true);
 
-        /* All the keys with the specified prefix have been parsed. */
+        /*
+         * All the keys with the specified prefix have been parsed. Wait for the worker threads to
+         * finish with the files they were given, so a file isn't queued again while it's still being
+         * compacted, and running once stops after every file has been compacted.
+         */
         if (ret == WT_NOTFOUND) {
+            if (nworkers > 1)
+                __background_compact_workers_wait(session, 0);
             full_iteration = true;
             continue;
         }
@@ -624,47 +895,27 @@ __background_compact_server(void *arg)
 
         WT_ERR(ret);
 
-        ret = wt_session->compact(wt_session, (const char *)uri->data, (const char *)config->data);
-
-        /*
-         * Compact may return:
-         * - EBUSY or WT_ROLLBACK for various reasons.
-         * - ENOENT if the underlying file does not exist.
-         * - ETIMEDOUT if the configured timer has elapsed.
-         * - WT_ERROR if the background compaction has been interrupted.
-         */
-        if (ret != 0) {
-            WT_STAT_CONN_INCR(session, background_compact_fail);
-            /* The following errors are always silenced. */
-            if (ret == EBUSY || ret == ENOENT || ret == ETIMEDOUT || ret == WT_ROLLBACK) {
-                if (ret == EBUSY && __wt_cache_stuck(session))
-                    WT_STAT_CONN_INCR(session, background_compact_fail_cache_pressure);
-                else if (ret == ETIMEDOUT)
-                    WT_STAT_CONN_INCR(session, background_compact_timeout);
-                ret = 0;
-            }
-
-            /*
-             * Verify WT_ERROR comes from an interruption by checking the server is no longer
-             * running.
-             */
-            else if (ret == WT_ERROR) {
-                __wt_spin_lock(session, &conn->background_compact.lock);
-                running = __wt_atomic_loadbool(&conn->background_compact.running);
-                __wt_spin_unlock(session, &conn->background_compact.lock);
-                if (!running) {
-                    WT_STAT_CONN_INCR(session, background_compact_interrupted);
-                    ret = 0;
-                }
-            }
-            WT_ERR(ret);
-        } else
-            WT_STAT_CONN_INCR(session, background_compact_success);
+        if (nworkers > 1)
+            WT_ERR(__background_compact_workers_queue(
+              session, nworkers, (const char *)uri->data, (const char *)config->data));
+        else
+            WT_ERR(__background_compact_file(
+              session, (const char *)uri->data, (const char *)config->data));
     }
 
     WT_STAT_CONN_SET(session, background_compact_running, 0);
 
 err:
+    /* Stop the worker threads before freeing the state they share with the server. */
+    if (conn->background_compact.workers.alloc != 0) {
+        __wt_atomic_storebool(&conn->background_compact.running, false);
+        __wt_writelock(session, &conn->background_compact.workers.lock);
+        WT_TRET(__wt_thread_group_destroy(session, &conn->background_compact.workers));
+    }
+    __wt_spin_lock(session, &conn->background_compact.lock);
+    __background_compact_work_clear(session);
+    __wt_spin_unlock(session, &conn->background_compact.lock);
+
     __background_compact_exclude_list_clear(session, true);
     __background_compact_list_cleanup(session, BACKGROUND_COMPACT_CLEANUP_EXIT);
 
@@ -712,6 +963,8 @@ __wti_background_compact_server_create(WT_SESSION_IMPL *session)
     WT_RET(__wt_open_internal_session(
       conn, "compact-server", true, session_flags, 0, &conn->background_compact.session));
     session = conn->background_compact.session;
+    F_SET(session, WT_SESSION_BACKGROUND_COMPACT);
+    TAILQ_INIT(&conn->background_compact.workqh);
 
     WT_RET(__wt_cond_alloc(session, "compact server", &conn->background_compact.cond));
 
@@ -809,6 +1062,10 @@ __wt_background_compact_signal(WT_SESSION_IMPL *session, const char *config)
         WT_ERR(__wt_config_getones(session, stripped_config, "run_once", &cval));
         conn->background_compact.run_once = cval.val;
 
+        /* The number of threads compacting files in parallel. */
+        WT_ERR(__wt_config_getones(session, stripped_config, "threads", &cval));
+        conn->background_compact.workers_max = (uint32_t)cval.val;
+
         /* Process excluded tables. */
         WT_ERR(__background_compact_exclude_list_process(session, config));
     }
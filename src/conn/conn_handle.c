@@ -53,6 +53,7 @@ __wti_connection_init(WT_CONNECTION_IMPL *conn)
     WT_RET(__wt_spin_init(session, &conn->api_lock, "api"));
     WT_SPIN_INIT_TRACKED(session, &conn->checkpoint_lock, checkpoint);
     WT_RET(__wt_spin_init(session, &conn->background_compact.lock, "background compact"));
+    WT_RET(__wt_spin_init(session, &conn->bufpool.lock, "I/O buffer pool"));
     WT_RET(__wt_spin_init(session, &conn->chunkcache_metadata_lock, "chunk cache metadata"));
     WT_RET(__wt_spin_init(session, &conn->encryptor_lock, "encryptor"));
     WT_RET(__wt_spin_init(session, &conn->fh_lock, "file list"));
@@ -120,6 +121,8 @@ __wti_connection_destroy(WT_CONNECTION_IMPL *conn)
 
     __wt_conn_foc_discard(session); /* free-on-close */
 
+    __wt_bufpool_destroy(session); /* I/O buffer pool */
+
     __wt_spin_destroy(session, &conn->api_lock);
     __wt_spin_destroy(session, &conn->background_compact.lock);
     __wt_spin_destroy(session, &conn->block_lock);
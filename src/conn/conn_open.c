@@ -91,10 +91,12 @@ __wti_connection_close(WT_CONNECTION_IMPL *conn)
      * down before the eviction server, and shut all servers down before closing open data handles.
      */
     WT_TRET(__wti_background_compact_server_destroy(session));
+    WT_TRET(__wt_chain_trim_server_destroy(session));
     WT_TRET(__wti_checkpoint_server_destroy(session));
     WT_TRET(__wti_statlog_destroy(session, true));
     WT_TRET(__wti_tiered_storage_destroy(session, false));
     WT_TRET(__wti_sweep_destroy(session));
+    WT_TRET(__wt_blkcache_prewarm_destroy(session));
     WT_TRET(__wt_chunkcache_teardown(session));
     WT_TRET(__wti_chunkcache_metadata_destroy(session));
     WT_TRET(__wti_prefetch_destroy(session));
@@ -272,8 +274,14 @@ __wti_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
     /* Start pre-fetch utilities. */
     WT_RET(__wti_prefetch_create(session, cfg));
 
+    /* Start reloading the block cache's content from before the restart. */
+    WT_RET(__wt_blkcache_prewarm_create(session));
+
     /* Start the checkpoint cleanup thread. */
     WT_RET(__wt_checkpoint_cleanup_create(session, cfg));
 
+    /* Start the optional update chain trim thread. */
+    WT_RET(__wt_chain_trim_server_create(session, cfg));
+
     return (0);
 }
@@ -28,7 +28,8 @@ __prefetch_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
 {
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
-    WT_PREFETCH_QUEUE_ENTRY *pe;
+    WT_PREFETCH_QUEUE_ENTRY *pe, *pes[WT_PREFETCH_QUEUE_PER_TRIGGER];
+    u_int batch_max, i, npes;
 
     WT_UNUSED(thread);
     WT_ASSERT(session, session->id != 0);
@@ -44,70 +45,92 @@ __prefetch_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
         /* Encourage races. */
         __wt_timing_stress(session, WT_TIMING_STRESS_PREFETCH_DELAY, NULL);
 
-        __wt_spin_lock(session, &conn->prefetch_lock);
-        pe = TAILQ_FIRST(&conn->pfqh);
-
-        /* If there is no work for the thread to do - return back to the thread pool */
-        if (pe == NULL) {
-            __wt_spin_unlock(session, &conn->prefetch_lock);
-            break;
-        }
-
-        TAILQ_REMOVE(&conn->pfqh, pe, q);
-        --conn->prefetch_queue_count;
-
         /*
-         * If the cache is getting close to its eviction clean trigger, don't attempt to pre-fetch
-         * the current ref as we may hang if the cache becomes full and we need to wait until space
-         * in the cache clears up. Repeat this process until either eviction has evicted enough
-         * eligible pages (allowing pre-fetch to read into the cache), or we iterate through and
-         * remove all the refs from the pre-fetch queue and pre-fetch becomes a no-op.
+         * If batched reads are configured, take the entry at the head of the queue along with the
+         * entries following it for the same tree, so their blocks can be read in a single batch.
          */
-        if (__wt_eviction_clean_pressure(session)) {
-            F_CLR_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH);
-            __wt_spin_unlock(session, &conn->prefetch_lock);
-            __wt_free(session, pe);
-            continue;
-        }
+        batch_max = WT_MIN(conn->io_uring_depth, WT_PREFETCH_QUEUE_PER_TRIGGER);
+        batch_max = WT_MAX(batch_max, 1);
+        npes = 0;
 
-        /*
-         * We increment this while in the prefetch lock as the thread reading from the queue expects
-         * that behavior.
-         */
-        (void)__wt_atomic_addv32(&((WT_BTREE *)pe->dhandle->handle)->prefetch_busy, 1);
+        __wt_spin_lock(session, &conn->prefetch_lock);
+        while (npes < batch_max && (pe = TAILQ_FIRST(&conn->pfqh)) != NULL &&
+          (npes == 0 || pe->dhandle == pes[0]->dhandle)) {
+            TAILQ_REMOVE(&conn->pfqh, pe, q);
+            --conn->prefetch_queue_count;
 
-        WT_PREFETCH_ASSERT(
-          session, F_ISSET_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH), prefetch_skipped_no_flag_set);
+            /*
+             * If the cache is getting close to its eviction clean trigger, don't attempt to
+             * pre-fetch the current ref as we may hang if the cache becomes full and we need to
+             * wait until space in the cache clears up. Repeat this process until either eviction
+             * has evicted enough eligible pages (allowing pre-fetch to read into the cache), or we
+             * iterate through and remove all the refs from the pre-fetch queue and pre-fetch
+             * becomes a no-op.
+             */
+            if (__wt_eviction_clean_pressure(session)) {
+                F_CLR_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH);
+                __wt_free(session, pe);
+                continue;
+            }
+
+            /*
+             * We increment this while in the prefetch lock as the thread reading from the queue
+             * expects that behavior.
+             */
+            (void)__wt_atomic_addv32(&((WT_BTREE *)pe->dhandle->handle)->prefetch_busy, 1);
+
+            WT_PREFETCH_ASSERT(session, F_ISSET_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH),
+              prefetch_skipped_no_flag_set);
+            pes[npes++] = pe;
+        }
         __wt_spin_unlock(session, &conn->prefetch_lock);
 
-        /*
-         * It's a weird case, but if verify is utilizing prefetch and encounters a corrupted block,
-         * stop using prefetch. Some of the guarantees about ref and page freeing are ignored in
-         * that case, which can invalidate entries on the prefetch queue. Don't prefetch fast
-         * deleted pages - they have special performance and visibility considerations associated
-         * with them. Don't prefetch fast deleted pages to avoid wasted effort. We can skip reading
-         * these deleted pages into the cache if the fast truncate information is visible in the
-         * session transaction snapshot.
-         */
-        if (!F_ISSET(conn, WT_CONN_DATA_CORRUPTION) && pe->ref->page_del == NULL)
-            WT_WITH_DHANDLE(session, pe->dhandle, ret = __wt_prefetch_page_in(session, pe));
+        /* If there is no work for the thread to do - return back to the thread pool */
+        if (npes == 0)
+            continue;
 
         /*
-         * It is now safe to clear the flag. The prefetch worker is done interacting with the ref
-         * and the associated internal page can be safely evicted from now on.
+         * Read the blocks for the whole group first: failure isn't fatal, any block not returned by
+         * the batch is read by the normal path, which handles error reporting.
          */
-        F_CLR_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH);
-        (void)__wt_atomic_subv32(&((WT_BTREE *)pe->dhandle->handle)->prefetch_busy, 1);
+        if (npes > 1 && !F_ISSET(conn, WT_CONN_DATA_CORRUPTION))
+            WT_WITH_DHANDLE(session, pes[0]->dhandle,
+              WT_IGNORE_RET(__wt_prefetch_read_batch(session, pes, npes)));
+
+        for (i = 0; i < npes; ++i) {
+            pe = pes[i];
+
+            /*
+             * It's a weird case, but if verify is utilizing prefetch and encounters a corrupted
+             * block, stop using prefetch. Some of the guarantees about ref and page freeing are
+             * ignored in that case, which can invalidate entries on the prefetch queue. Don't
+             * prefetch fast deleted pages - they have special performance and visibility
+             * considerations associated with them. Don't prefetch fast deleted pages to avoid
+             * wasted effort. We can skip reading these deleted pages into the cache if the fast
+             * truncate information is visible in the session transaction snapshot.
+             */
+            if (ret == 0 && !F_ISSET(conn, WT_CONN_DATA_CORRUPTION) && pe->ref->page_del == NULL)
+                WT_WITH_DHANDLE(session, pe->dhandle, ret = __wt_prefetch_page_in(session, pe));
+
+            /*
+             * It is now safe to clear the flag. The prefetch worker is done interacting with the
+             * ref and the associated internal page can be safely evicted from now on.
+             */
+            F_CLR_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH);
+            (void)__wt_atomic_subv32(&((WT_BTREE *)pe->dhandle->handle)->prefetch_busy, 1);
 
-        __wt_free(session, pe);
+            __wt_free(session, pe);
 
-        /*
-         * Ignore specific errors that prevented prefetch from making progress, they are harmless.
-         */
-        if (ret == WT_NOTFOUND || ret == WT_RESTART) {
-            WT_STAT_CONN_INCR(session, prefetch_skipped_error_ok);
-            ret = 0;
+            /*
+             * Ignore specific errors that prevented prefetch from making progress, they are
+             * harmless.
+             */
+            if (ret == WT_NOTFOUND || ret == WT_RESTART) {
+                WT_STAT_CONN_INCR(session, prefetch_skipped_error_ok);
+                ret = 0;
+            }
         }
+        session->pf.staged_count = 0;
         WT_ERR(ret);
     }
 
@@ -159,7 +182,8 @@ err:
 
 /*
  * __wt_conn_prefetch_queue_push --
- *     Push a ref onto the pre-fetch queue.
+ *     Push a ref onto the pre-fetch queue. The caller is responsible for waking the pre-fetch
+ *     threads once it has finished queuing refs.
  */
 int
 __wt_conn_prefetch_queue_push(WT_SESSION_IMPL *session, WT_REF *ref)
@@ -199,7 +223,6 @@ __wt_conn_prefetch_queue_push(WT_SESSION_IMPL *session, WT_REF *ref)
     TAILQ_INSERT_TAIL(&conn->pfqh, pe, q);
     ++conn->prefetch_queue_count;
     __wt_spin_unlock(session, &conn->prefetch_lock);
-    __wt_cond_signal(session, conn->prefetch_threads.wait_cond);
 
     if (0) {
 err:
@@ -411,6 +411,7 @@ __wti_conn_reconfig(WT_SESSION_IMPL *session, const char **cfg)
     WT_ERR(__wti_conn_statistics_config(session, cfg));
     WT_ERR(__wti_cache_config(session, cfg, true));
     WT_ERR(__wti_capacity_server_create(session, cfg));
+    WT_ERR(__wt_chain_trim_server_create(session, cfg));
     WT_ERR(__wti_checkpoint_server_create(session, cfg));
     WT_ERR(__wti_debug_mode_config(session, cfg));
     WT_ERR(__wti_extra_diagnostics_config(session, cfg));
@@ -76,6 +76,8 @@ __wt_conn_stat_init(WT_SESSION_IMPL *session)
     __wti_cache_stats_update(session);
     __wt_txn_stats_update(session);
 
+    WT_STATP_CONN_SET(
+      session, stats, block_buffer_pool_bytes, __wt_atomic_loadsize(&conn->bufpool.bytes));
     WT_STATP_CONN_SET(session, stats, file_open, conn->open_file_count);
     WT_STATP_CONN_SET(
       session, stats, cursor_open_count, __wt_atomic_load32(&conn->open_cursor_count));
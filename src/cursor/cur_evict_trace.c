@@ -0,0 +1,269 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __curevict_trace_load --
+ *     Take a copy of the events in the eviction trace, if the cursor doesn't have one.
+ */
+static int
+__curevict_trace_load(WT_SESSION_IMPL *session, WT_CURSOR_EVICT_TRACE *cet)
+{
+    if (cet->loaded)
+        return (0);
+
+    __wt_free(session, cet->events);
+    cet->entries = 0;
+    WT_RET(__wt_evict_trace_copy(session, &cet->events, &cet->entries));
+    cet->loaded = true;
+    return (0);
+}
+
+/*
+ * __curevict_trace_kv --
+ *     Set the key and value of the eviction trace cursor to return to the user.
+ */
+static int
+__curevict_trace_kv(WT_CURSOR *cursor)
+{
+    WT_CURSOR_EVICT_TRACE *cet;
+    WT_EVICT_TRACE_EVENT *event;
+    uint64_t raw;
+    const char *reason, *thread, *type;
+
+    cet = (WT_CURSOR_EVICT_TRACE *)cursor;
+    event = &cet->events[cet->next - 1];
+    __wt_evict_trace_names(event, &thread, &type, &reason);
+
+    /* Temporarily turn off raw so we can do direct cursor operations. */
+    raw = F_MASK(cursor, WT_CURSTD_RAW);
+    F_CLR(cursor, WT_CURSTD_RAW);
+
+    /*
+     * The eviction trace cursor sets the event's sequence number as the cursor key and the rest of
+     * the event in the value.
+     */
+    __wt_cursor_set_key(cursor, event->seq);
+    if (cursor->saved_err == 0)
+        __wt_cursor_set_value(cursor, event->time_us, thread, type, reason, event->uri,
+          event->page, event->page_bytes, event->reconcile_us, event->hs_bytes, event->elapsed_us);
+
+    F_SET(cursor, raw);
+    return (cursor->saved_err);
+}
+
+/*
+ * __curevict_trace_next --
+ *     WT_CURSOR.next method for the eviction trace cursor type.
+ */
+static int
+__curevict_trace_next(WT_CURSOR *cursor)
+{
+    WT_CURSOR_EVICT_TRACE *cet;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    cet = (WT_CURSOR_EVICT_TRACE *)cursor;
+    CURSOR_API_CALL(cursor, session, ret, next, NULL);
+
+    WT_ERR(__curevict_trace_load(session, cet));
+    if (cet->next >= cet->entries)
+        WT_ERR(WT_NOTFOUND);
+    ++cet->next;
+    WT_ERR(__curevict_trace_kv(cursor));
+    WT_STAT_CONN_DSRC_INCR(session, cursor_next);
+
+    if (0) {
+err:
+        F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+    }
+    API_END_RET(session, ret);
+}
+
+/*
+ * __curevict_trace_prev --
+ *     WT_CURSOR.prev method for the eviction trace cursor type.
+ */
+static int
+__curevict_trace_prev(WT_CURSOR *cursor)
+{
+    WT_CURSOR_EVICT_TRACE *cet;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    cet = (WT_CURSOR_EVICT_TRACE *)cursor;
+    CURSOR_API_CALL(cursor, session, ret, prev, NULL);
+
+    WT_ERR(__curevict_trace_load(session, cet));
+
+    /* An unpositioned cursor moves to the last event. */
+    if (cet->next == 0)
+        cet->next = cet->entries + 1;
+    if (cet->next <= 1) {
+        cet->next = 0;
+        WT_ERR(WT_NOTFOUND);
+    }
+    --cet->next;
+    WT_ERR(__curevict_trace_kv(cursor));
+    WT_STAT_CONN_DSRC_INCR(session, cursor_prev);
+
+    if (0) {
+err:
+        F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+    }
+    API_END_RET(session, ret);
+}
+
+/*
+ * __curevict_trace_search --
+ *     WT_CURSOR.search method for the eviction trace cursor type.
+ */
+static int
+__curevict_trace_search(WT_CURSOR *cursor)
+{
+    WT_CURSOR_EVICT_TRACE *cet;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    uint64_t raw, seq;
+    uint32_t base, indx, limit;
+
+    cet = (WT_CURSOR_EVICT_TRACE *)cursor;
+    /* Temporarily turn off raw so we can do direct cursor operations. */
+    raw = F_MASK(cursor, WT_CURSTD_RAW);
+    F_CLR(cursor, WT_CURSTD_RAW);
+
+    CURSOR_API_CALL(cursor, session, ret, search, NULL);
+
+    WT_ERR(__wt_cursor_get_key(cursor, &seq));
+    WT_ERR(__curevict_trace_load(session, cet));
+
+    /* The copied events are sorted by sequence number, binary search them. */
+    for (base = 0, limit = cet->entries; limit != 0; limit >>= 1) {
+        indx = base + (limit >> 1);
+        if (cet->events[indx].seq == seq)
+            break;
+        if (cet->events[indx].seq < seq) {
+            base = indx + 1;
+            --limit;
+        }
+    }
+    if (limit == 0)
+        WT_ERR(WT_NOTFOUND);
+    cet->next = indx + 1;
+    WT_ERR(__curevict_trace_kv(cursor));
+    WT_STAT_CONN_DSRC_INCR(session, cursor_search);
+
+err:
+    F_SET(cursor, raw);
+    API_END_RET(session, ret);
+}
+
+/*
+ * __curevict_trace_reset --
+ *     WT_CURSOR.reset method for the eviction trace cursor type.
+ */
+static int
+__curevict_trace_reset(WT_CURSOR *cursor)
+{
+    WT_CURSOR_EVICT_TRACE *cet;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    cet = (WT_CURSOR_EVICT_TRACE *)cursor;
+    CURSOR_API_CALL_PREPARE_ALLOWED(cursor, session, reset, NULL);
+
+    /* Take a new copy of the events on the next operation. */
+    cet->loaded = false;
+    cet->next = 0;
+    F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+
+err:
+    API_END_RET(session, ret);
+}
+
+/*
+ * __curevict_trace_close --
+ *     WT_CURSOR.close method for the eviction trace cursor type.
+ */
+static int
+__curevict_trace_close(WT_CURSOR *cursor)
+{
+    WT_CURSOR_EVICT_TRACE *cet;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    cet = (WT_CURSOR_EVICT_TRACE *)cursor;
+    CURSOR_API_CALL_PREPARE_ALLOWED(cursor, session, close, NULL);
+err:
+
+    __wt_free(session, cet->events);
+
+    __wt_cursor_close(cursor);
+
+    API_END_RET(session, ret);
+}
+
+/*
+ * __wt_curevict_trace_open --
+ *     Initialize an eviction trace cursor.
+ */
+int
+__wt_curevict_trace_open(
+  WT_SESSION_IMPL *session, const char *uri, const char *cfg[], WT_CURSOR **cursorp)
+{
+    WT_CURSOR_STATIC_INIT(iface, __wt_cursor_get_key, /* get-key */
+      __wt_cursor_get_value,                          /* get-value */
+      __wt_cursor_get_raw_key_value,                  /* get-raw-key-value */
+      __wt_cursor_set_key,                            /* set-key */
+      __wt_cursor_set_value,                          /* set-value */
+      __wti_cursor_compare_notsup,                    /* compare */
+      __wti_cursor_equals_notsup,                     /* equals */
+      __curevict_trace_next,                          /* next */
+      __curevict_trace_prev,                          /* prev */
+      __curevict_trace_reset,                         /* reset */
+      __curevict_trace_search,                        /* search */
+      __wti_cursor_search_near_notsup,                /* search-near */
+      __wt_cursor_notsup,                             /* insert */
+      __wti_cursor_modify_notsup,                     /* modify */
+      __wt_cursor_notsup,                             /* update */
+      __wt_cursor_notsup,                             /* remove */
+      __wt_cursor_notsup,                             /* reserve */
+      __wt_cursor_config_notsup,                      /* reconfigure */
+      __wt_cursor_notsup,                             /* largest_key */
+      __wt_cursor_config_notsup,                      /* bound */
+      __wt_cursor_notsup,                             /* cache */
+      __wt_cursor_reopen_notsup,                      /* reopen */
+      __wt_cursor_checkpoint_id,                      /* checkpoint ID */
+      __curevict_trace_close);                        /* close */
+    WT_CURSOR *cursor;
+    WT_CURSOR_EVICT_TRACE *cet;
+    WT_DECL_RET;
+
+    WT_VERIFY_OPAQUE_POINTER(WT_CURSOR_EVICT_TRACE);
+
+    if (S2C(session)->cache->evict_trace == NULL)
+        WT_RET_MSG(session, EINVAL, "eviction trace cursors require the eviction trace be enabled");
+
+    WT_RET(__wt_calloc_one(session, &cet));
+    cursor = (WT_CURSOR *)cet;
+    *cursor = iface;
+    cursor->session = (WT_SESSION *)session;
+    cursor->key_format = WT_EVICT_TRACE_KEY_FORMAT;
+    cursor->value_format = WT_EVICT_TRACE_VALUE_FORMAT;
+
+    WT_ERR(__wt_cursor_init(cursor, uri, NULL, cfg, cursorp));
+
+    if (0) {
+err:
+        WT_TRET(__curevict_trace_close(cursor));
+        *cursorp = NULL;
+    }
+
+    return (ret);
+}
@@ -22,6 +22,12 @@ static int __evict_walk_tree(WT_SESSION_IMPL *, WT_EVICT_QUEUE *, u_int, u_int *
 
 #define WT_EVICT_HAS_WORKERS(s) (__wt_atomic_load32(&S2C(s)->evict_threads.current_threads) > 1)
 
+#define WT_EVICT_PACING_SAMPLE_US (10 * WT_THOUSAND) /* Minimum time between pacing samples */
+#define WT_EVICT_PACING_WEIGHT 0.25                  /* Weight of a new sample in the rates */
+
+/* Histogram of the time application threads spend in eviction. */
+WT_STAT_USECS_HIST_INCR_FUNC(evictapp, perf_hist_evictapp_latency)
+
 /*
  * __evict_lock_handle_list --
  *     Try to get the handle list lock, with yield and sleep back off. Keep timing statistics
@@ -85,6 +91,10 @@ __evict_entry_priority(WT_SESSION_IMPL *session, WT_REF *ref)
     if (__wt_atomic_loadsize(&page->memory_footprint) > btree->splitmempage)
         return (WT_READGEN_OLDEST);
 
+    /* Leaf pages from a tree over its cache quota should be discarded. */
+    if (!F_ISSET(ref, WT_REF_FLAG_INTERNAL) && __wt_btree_over_cache_quota(btree))
+        return (WT_READGEN_OLDEST);
+
     /*
      * The base read-generation is skewed by the eviction priority. Internal pages are also
      * adjusted, we prefer to evict leaf pages.
@@ -169,8 +179,8 @@ __evict_list_clear_page_locked(WT_SESSION_IMPL *session, WT_REF *ref, bool exclu
     uint32_t elem, i, q, last_queue_idx;
     bool found;
 
-    last_queue_idx = exclude_urgent ? WT_EVICT_URGENT_QUEUE : WT_EVICT_QUEUE_MAX;
     cache = S2C(session)->cache;
+    last_queue_idx = exclude_urgent ? cache->evict_queue_count - 1 : cache->evict_queue_count;
     found = false;
 
     WT_ASSERT_SPINLOCK_OWNED(session, &cache->evict_queue_lock);
@@ -340,8 +350,14 @@ __evict_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
         else {
             __wt_verbose_debug2(session, WT_VERB_EVICTSERVER, "%s", "sleeping");
 
-            /* Don't rely on signals: check periodically. */
-            __wt_cond_auto_wait(session, cache->evict_cond, did_work, NULL);
+            /*
+             * Don't rely on signals: check periodically. Eviction pacing samples the cache content
+             * at a steady rate.
+             */
+            if (__wt_atomic_load64(&cache->evict_pacing_horizon_ms) != 0)
+                __wt_cond_wait(session, cache->evict_cond, WT_EVICT_PACING_SAMPLE_US, NULL);
+            else
+                __wt_cond_auto_wait(session, cache->evict_cond, did_work, NULL);
             __wt_verbose_debug2(session, WT_VERB_EVICTSERVER, "%s", "waking");
         }
     } else
@@ -596,6 +612,47 @@ __wt_evict_destroy(WT_SESSION_IMPL *session)
     return (0);
 }
 
+/*
+ * __evict_pacing_update --
+ *     Sample the cache content, update the smoothed rates at which it grows and project it at the
+ *     eviction pacing horizon.
+ */
+static void
+__evict_pacing_update(WT_SESSION_IMPL *session, uint64_t bytes_inuse, uint64_t bytes_dirty)
+{
+    WT_CACHE *cache;
+    double horizon_secs, secs;
+    uint64_t elapsed_us, horizon_ms, time_now;
+
+    cache = S2C(session)->cache;
+    time_now = __wt_clock(session);
+
+    /* Rates measured over very short intervals are mostly noise. */
+    if (cache->evict_pacing_sample_time != 0) {
+        elapsed_us = WT_CLOCKDIFF_US(time_now, cache->evict_pacing_sample_time);
+        if (elapsed_us < WT_EVICT_PACING_SAMPLE_US)
+            return;
+        secs = (double)elapsed_us / WT_MILLION;
+        cache->evict_pacing_inuse_rate += WT_EVICT_PACING_WEIGHT *
+          (((double)bytes_inuse - (double)cache->evict_pacing_inuse_last) / secs -
+            cache->evict_pacing_inuse_rate);
+        cache->evict_pacing_dirty_rate += WT_EVICT_PACING_WEIGHT *
+          (((double)bytes_dirty - (double)cache->evict_pacing_dirty_last) / secs -
+            cache->evict_pacing_dirty_rate);
+    }
+    cache->evict_pacing_sample_time = time_now;
+    cache->evict_pacing_inuse_last = bytes_inuse;
+    cache->evict_pacing_dirty_last = bytes_dirty;
+
+    /* Content that isn't growing is projected at its current size. */
+    horizon_ms = __wt_atomic_load64(&cache->evict_pacing_horizon_ms);
+    horizon_secs = (double)horizon_ms / WT_THOUSAND;
+    cache->evict_pacing_inuse_predicted =
+      bytes_inuse + (uint64_t)WT_MAX(cache->evict_pacing_inuse_rate * horizon_secs, 0);
+    cache->evict_pacing_dirty_predicted =
+      bytes_dirty + (uint64_t)WT_MAX(cache->evict_pacing_dirty_rate * horizon_secs, 0);
+}
+
 /*
  * __evict_update_work --
  *     Configure eviction work state.
@@ -609,6 +666,7 @@ __evict_update_work(WT_SESSION_IMPL *session)
     double dirty_target, dirty_trigger, target, trigger, updates_target, updates_trigger;
     uint64_t bytes_dirty, bytes_inuse, bytes_max, bytes_updates;
     uint32_t flags;
+    bool early;
 
     conn = S2C(session);
     cache = conn->cache;
@@ -665,6 +723,29 @@ __evict_update_work(WT_SESSION_IMPL *session)
     else if (bytes_updates > (uint64_t)(updates_target * bytes_max) / 100)
         LF_SET(WT_CACHE_EVICT_UPDATES);
 
+    /*
+     * With eviction pacing, start evicting before the content reaches the targets if it is growing
+     * fast enough to cross the triggers within the pacing horizon: eviction gets going before the
+     * triggers pull application threads into eviction. Dirty eviction scrubs pages ahead of
+     * checkpoints the same way.
+     */
+    if (__wt_atomic_load64(&cache->evict_pacing_horizon_ms) != 0) {
+        __evict_pacing_update(session, bytes_inuse, bytes_dirty);
+        early = false;
+        if (!LF_ISSET(WT_CACHE_EVICT_CLEAN) &&
+          cache->evict_pacing_inuse_predicted > (uint64_t)(trigger * bytes_max) / 100) {
+            LF_SET(WT_CACHE_EVICT_CLEAN);
+            early = true;
+        }
+        if (!LF_ISSET(WT_CACHE_EVICT_DIRTY) &&
+          cache->evict_pacing_dirty_predicted > (uint64_t)(dirty_trigger * bytes_max) / 100) {
+            LF_SET(WT_CACHE_EVICT_DIRTY);
+            early = true;
+        }
+        if (early)
+            WT_STAT_CONN_INCR(session, cache_eviction_pacing_early);
+    }
+
     /*
      * If application threads are blocked by the total volume of data in cache, try dirty pages as
      * well.
@@ -688,6 +769,15 @@ __evict_update_work(WT_SESSION_IMPL *session)
         LF_CLR(WT_CACHE_EVICT_NOKEEP);
     }
 
+    /*
+     * If a tree has grown past its cache quota and there is no other reason to evict, evict from
+     * the trees over quota alone. Don't scrub, the point is to release the memory.
+     */
+    if (__wt_atomic_loadbool(&cache->evict_quota_exceeded) && !LF_ISSET(WT_CACHE_EVICT_ALL)) {
+        LF_SET(WT_CACHE_EVICT_CLEAN | WT_CACHE_EVICT_DIRTY | WT_CACHE_EVICT_QUOTA);
+        LF_CLR(WT_CACHE_EVICT_SCRUB);
+    }
+
     /*
      * With an in-memory cache, we only do dirty eviction in order to scrub pages.
      */
@@ -940,7 +1030,7 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session)
      */
     __wt_spin_lock(session, &cache->evict_queue_lock);
 
-    for (q = 0; q < WT_EVICT_QUEUE_MAX; q++) {
+    for (q = 0; q < cache->evict_queue_count; q++) {
         __wt_spin_lock(session, &cache->evict_queues[q].evict_lock);
         elem = cache->evict_queues[q].evict_max;
         for (i = 0, evict = cache->evict_queues[q].evict_queue; i < elem; i++, evict++)
@@ -1216,9 +1306,10 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_EVICT_QUEUE *other_queue, *queue;
+    WT_EVICT_SHARD *shard;
     WT_TRACK_OP_DECL;
     uint64_t read_gen_oldest;
-    uint32_t candidates, entries;
+    uint32_t candidates, entries, i;
 
     WT_TRACK_OP_INIT(session);
     conn = S2C(session);
@@ -1228,10 +1319,20 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
     if (cache->evict_empty_score > 0)
         --cache->evict_empty_score;
 
-    /* Fill the next queue (that isn't the urgent queue). */
-    queue = cache->evict_fill_queue;
-    other_queue = cache->evict_queues + (1 - (queue - cache->evict_queues));
-    cache->evict_fill_queue = other_queue;
+    /*
+     * Fill the next queue (that isn't the urgent queue). The shards are filled in turn, skipping
+     * any shard where both queues are full.
+     */
+    for (i = 0;; ++i) {
+        shard = &cache->evict_shards[cache->evict_fill_shard];
+        cache->evict_fill_shard = (cache->evict_fill_shard + 1) % cache->evict_shard_count;
+        queue = shard->evict_fill_queue;
+        other_queue = shard->evict_queues + (1 - (queue - shard->evict_queues));
+        if (i + 1 == cache->evict_shard_count || !__evict_queue_full(queue) ||
+          !__evict_queue_full(other_queue))
+            break;
+    }
+    shard->evict_fill_queue = other_queue;
 
     /* If this queue is full, try the other one. */
     if (__evict_queue_full(queue) && !__evict_queue_full(other_queue))
@@ -1273,7 +1374,7 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
      * We have locked the queue: in the (unusual) case where we are filling the current queue, mark
      * it empty so that subsequent requests switch to the other queue.
      */
-    if (queue == cache->evict_current_queue)
+    if (queue == shard->evict_current_queue)
         queue->evict_current = NULL;
 
     entries = queue->evict_entries;
@@ -1371,12 +1472,168 @@ err:
     return (ret);
 }
 
+/*
+ * __evict_rank_cmp --
+ *     Qsort function: sort ranked trees, best first.
+ */
+static int WT_CDECL
+__evict_rank_cmp(const void *a_arg, const void *b_arg)
+{
+    const WT_EVICT_TREE *a, *b;
+
+    a = a_arg;
+    b = b_arg;
+    return (a->score > b->score ? -1 : (a->score == b->score ? 0 : 1));
+}
+
+/*
+ * __evict_rank_score --
+ *     Return how much of the cache content eviction is looking for a tree holds.
+ */
+static WT_INLINE uint64_t
+__evict_rank_score(WT_CACHE *cache, WT_BTREE *btree)
+{
+    uint64_t bytes_inmem, bytes_internal, score;
+
+    score = 0;
+    if (F_ISSET(cache, WT_CACHE_EVICT_CLEAN)) {
+        /* Internal pages, including the root, are rarely evicted: count the leaf pages. */
+        bytes_inmem = __wt_atomic_load64(&btree->bytes_inmem);
+        bytes_internal = __wt_atomic_load64(&btree->bytes_internal);
+        if (bytes_inmem > bytes_internal)
+            score = bytes_inmem - bytes_internal;
+    }
+    if (F_ISSET(cache, WT_CACHE_EVICT_DIRTY))
+        score = WT_MAX(score, __wt_atomic_load64(&btree->bytes_dirty_leaf));
+    if (F_ISSET(cache, WT_CACHE_EVICT_UPDATES))
+        score = WT_MAX(score, __wt_atomic_load64(&btree->bytes_updates));
+
+    /* Trees over their cache quota are walked before any others. */
+    if (__wt_btree_over_cache_quota(btree))
+        score = WT_MIN(score, WT_EXABYTE) + WT_EXABYTE;
+    return (score);
+}
+
+/*
+ * __evict_rank_trees --
+ *     Rank the open trees by the cache content eviction is looking for, keeping the best
+ *     WT_EVICT_RANK_TREES_MAX of them.
+ */
+static void
+__evict_rank_trees(WT_SESSION_IMPL *session)
+{
+    WT_BTREE *btree;
+    WT_CACHE *cache;
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    WT_EVICT_TREE *ranked, tmp;
+    uint64_t score, skipped;
+    uint32_t child, entries, i;
+
+    conn = S2C(session);
+    cache = conn->cache;
+    ranked = cache->evict_ranked;
+    entries = 0;
+    skipped = 0;
+
+    /*
+     * Keep the best trees in a min-heap, so a tree that makes the ranking replaces the worst ranked
+     * tree, then sort the heap.
+     */
+    TAILQ_FOREACH (dhandle, &conn->dhqh, q) {
+        if (!WT_DHANDLE_BTREE(dhandle) || !F_ISSET(dhandle, WT_DHANDLE_OPEN))
+            continue;
+        btree = dhandle->handle;
+        if (btree->evict_disabled > 0 || btree->root.page == NULL)
+            continue;
+        if ((score = __evict_rank_score(cache, btree)) == 0) {
+            ++skipped;
+            continue;
+        }
+
+        if (entries < WT_EVICT_RANK_TREES_MAX) {
+            /* Sift the new tree up. */
+            for (i = entries++; i > 0 && ranked[(i - 1) / 2].score > score; i = (i - 1) / 2)
+                ranked[i] = ranked[(i - 1) / 2];
+        } else if (score > ranked[0].score) {
+            /* Sift the new tree down from the worst ranked tree's place. */
+            for (i = 0; (child = 2 * i + 1) < entries; i = child) {
+                if (child + 1 < entries && ranked[child + 1].score < ranked[child].score)
+                    ++child;
+                if (ranked[child].score >= score)
+                    break;
+                ranked[i] = ranked[child];
+            }
+        } else
+            continue;
+        tmp.dhandle = dhandle;
+        tmp.score = score;
+        ranked[i] = tmp;
+    }
+
+    __wt_qsort(ranked, entries, sizeof(WT_EVICT_TREE), __evict_rank_cmp);
+
+    cache->evict_ranked_entries = entries;
+    cache->evict_ranked_next = 0;
+    cache->evict_ranked_dhandle_gen = conn->dhandle_remove_gen;
+    cache->evict_ranked_pass_gen = __wt_atomic_load64(&cache->evict_pass_gen);
+    cache->evict_ranked_flags = F_MASK(cache, WT_CACHE_EVICT_ALL | WT_CACHE_EVICT_QUOTA);
+
+    WT_STAT_CONN_INCR(session, cache_eviction_server_rank_trees);
+    WT_STAT_CONN_SET(session, cache_eviction_server_rank_trees_ranked, entries);
+    WT_STAT_CONN_INCRV(session, cache_eviction_server_rank_trees_skipped, skipped);
+}
+
+/*
+ * __evict_rank_choose_dhandle --
+ *     Select the next ranked tree for an eviction walk. When every ranked tree has been walked,
+ *     start again from the best one, ranking the trees again first if the ranking is out of date or
+ *     left trees out. The ranking is started again at most once per walk.
+ */
+static void
+__evict_rank_choose_dhandle(
+  WT_SESSION_IMPL *session, WT_DATA_HANDLE **dhandle_p, bool *rank_restartedp)
+{
+    WT_CACHE *cache;
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+    cache = conn->cache;
+    *dhandle_p = NULL;
+
+    /*
+     * Ranked handles are only known to be valid while no handle has been removed from the list
+     * since the ranking.
+     */
+    if (cache->evict_ranked_dhandle_gen != conn->dhandle_remove_gen)
+        cache->evict_ranked_entries = 0;
+
+    if (!*rank_restartedp) {
+        if (cache->evict_ranked_entries == 0 ||
+          (cache->evict_ranked_next >= cache->evict_ranked_entries &&
+            cache->evict_ranked_entries == WT_EVICT_RANK_TREES_MAX) ||
+          __wt_atomic_load64(&cache->evict_pass_gen) >=
+            cache->evict_ranked_pass_gen + WT_EVICT_RANK_PASSES ||
+          F_MASK(cache, WT_CACHE_EVICT_ALL | WT_CACHE_EVICT_QUOTA) != cache->evict_ranked_flags) {
+            __evict_rank_trees(session);
+            *rank_restartedp = true;
+        } else if (cache->evict_ranked_next >= cache->evict_ranked_entries) {
+            cache->evict_ranked_next = 0;
+            *rank_restartedp = true;
+        }
+    }
+
+    if (cache->evict_ranked_next < cache->evict_ranked_entries)
+        *dhandle_p = cache->evict_ranked[cache->evict_ranked_next++].dhandle;
+}
+
 /*
  * __evict_walk_choose_dhandle --
  *     Randomly select a dhandle for the next eviction walk
  */
 static void
-__evict_walk_choose_dhandle(WT_SESSION_IMPL *session, WT_DATA_HANDLE **dhandle_p)
+__evict_walk_choose_dhandle(
+  WT_SESSION_IMPL *session, WT_DATA_HANDLE **dhandle_p, bool *rank_restartedp)
 {
     WT_CONNECTION_IMPL *conn;
     WT_DATA_HANDLE *dhandle;
@@ -1386,6 +1643,11 @@ __evict_walk_choose_dhandle(WT_SESSION_IMPL *session, WT_DATA_HANDLE **dhandle_p
 
     WT_ASSERT(session, __wt_rwlock_islocked(session, &conn->dhandle_lock));
 
+    if (__wt_atomic_loadbool(&conn->cache->evict_rank_trees)) {
+        __evict_rank_choose_dhandle(session, dhandle_p, rank_restartedp);
+        return;
+    }
+
 #undef RANDOM_DH_SELECTION_ENABLED
 
 #ifdef RANDOM_DH_SELECTION_ENABLED
@@ -1451,7 +1713,7 @@ __evict_walk(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue)
     uint32_t evict_walk_period;
     u_int loop_count, max_entries, retries, slot, start_slot;
     u_int total_candidates;
-    bool dhandle_locked, incr;
+    bool dhandle_locked, incr, over_quota, rank_restarted;
 
     WT_TRACK_OP_INIT(session);
 
@@ -1459,7 +1721,7 @@ __evict_walk(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue)
     cache = conn->cache;
     btree = NULL;
     dhandle = NULL;
-    dhandle_locked = incr = false;
+    dhandle_locked = incr = rank_restarted = false;
     retries = 0;
 
     /*
@@ -1477,6 +1739,9 @@ __evict_walk(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue)
         __wt_atomic_load64(&cache->pages_dirty_leaf));
     max_entries = WT_MIN(max_entries, 1 + total_candidates / 2);
 
+    /* Trees still over their cache quota set the flag again as we walk them. */
+    __wt_atomic_storebool(&cache->evict_quota_exceeded, false);
+
 retry:
     loop_count = 0;
     while (slot < max_entries && loop_count++ < conn->dhandle_count) {
@@ -1508,7 +1773,7 @@ retry:
             if ((dhandle = cache->walk_tree) != NULL)
                 cache->walk_tree = NULL;
             else
-                __evict_walk_choose_dhandle(session, &dhandle);
+                __evict_walk_choose_dhandle(session, &dhandle, &rank_restarted);
         } else {
             if (incr) {
                 WT_ASSERT(session, __wt_atomic_loadi32(&dhandle->session_inuse) > 0);
@@ -1516,7 +1781,7 @@ retry:
                 incr = false;
                 cache->walk_tree = NULL;
             }
-            __evict_walk_choose_dhandle(session, &dhandle);
+            __evict_walk_choose_dhandle(session, &dhandle, &rank_restarted);
         }
 
         /* If we couldn't find any dhandle, we're done. */
@@ -1543,13 +1808,29 @@ retry:
             continue;
         }
 
+        /*
+         * Files over their cache quota are always walked; remember there is still work to do. If
+         * we're only evicting to enforce quotas, skip the other files. Skip files using less than
+         * their cache reservation until we become aggressive.
+         */
+        over_quota = __wt_btree_over_cache_quota(btree);
+        if (over_quota)
+            __wt_atomic_storebool(&cache->evict_quota_exceeded, true);
+        else if (F_ISSET(cache, WT_CACHE_EVICT_QUOTA)) {
+            WT_STAT_CONN_INCR(session, cache_eviction_server_skip_trees_under_quota);
+            continue;
+        } else if (__wt_btree_under_cache_reserve(btree) && !__wt_cache_aggressive(session)) {
+            WT_STAT_CONN_INCR(session, cache_eviction_server_skip_trees_reserved);
+            continue;
+        }
+
         /*
          * Skip files that are configured to stick in cache until we become aggressive.
          *
          * If the file is contributing heavily to our cache usage then ignore the "stickiness" of
          * its pages.
          */
-        if (btree->evict_priority != 0 && !__wt_cache_aggressive(session) &&
+        if (!over_quota && btree->evict_priority != 0 && !__wt_cache_aggressive(session) &&
           !__wt_btree_dominating_cache(session, btree)) {
             WT_STAT_CONN_INCR(session, cache_eviction_server_skip_trees_stick_in_cache);
             continue;
@@ -1571,7 +1852,8 @@ retry:
          * If we are filling the queue, skip files that haven't been useful in the past.
          */
         evict_walk_period = __wt_atomic_load32(&btree->evict_walk_period);
-        if (evict_walk_period != 0 && btree->evict_walk_skips++ < evict_walk_period) {
+        if (!over_quota && evict_walk_period != 0 &&
+          btree->evict_walk_skips++ < evict_walk_period) {
             WT_STAT_CONN_INCR(session, cache_eviction_server_skip_trees_not_useful_before);
             continue;
         }
@@ -1838,6 +2120,7 @@ __evict_walk_tree(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue, u_int max_ent
     uint64_t min_pages, pages_already_queued, pages_queued, pages_seen, refs_walked;
     uint32_t evict_walk_period, read_flags, remaining_slots, target_pages, walk_flags;
     int restarts;
+    uint8_t freq;
     bool give_up, modified, urgent_queued, want_page;
 
     conn = S2C(session);
@@ -2180,6 +2463,18 @@ rand_next:
         if (__wt_cache_aggressive(session))
             goto fast;
 
+        /*
+         * With the frequency policy, pages accessed since the walk last saw them get a second
+         * chance: age the access count and leave the page for a later walk. Pages read once by a
+         * scan are queued on the next visit, frequently accessed pages stay in cache.
+         */
+        if (cache->evict_policy == WT_EVICT_POLICY_FREQUENCY &&
+          (freq = __wt_atomic_load8(&page->evict_freq)) > 0) {
+            __wt_atomic_store8(&page->evict_freq, freq - 1);
+            WT_STAT_CONN_INCR(session, cache_eviction_server_skip_frequent_pages);
+            continue;
+        }
+
         if (modified && __evict_skip_dirty_candidate(session, page))
             continue;
 
@@ -2280,8 +2575,9 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
     WT_CACHE *cache;
     WT_EVICT_ENTRY *evict;
     WT_EVICT_QUEUE *queue, *other_queue, *urgent_queue;
+    WT_EVICT_SHARD *home, *shard;
     WT_REF_STATE previous_state;
-    uint32_t candidates;
+    uint32_t candidates, home_idx, i;
     bool is_app, server_only, urgent_ok;
 
     *btreep = NULL;
@@ -2300,12 +2596,26 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
       (is_app && F_ISSET(cache, WT_CACHE_EVICT_DIRTY_HARD));
     urgent_queue = cache->evict_urgent_queue;
 
+    /*
+     * The eviction server starts with the shard it will fill next, other threads with a shard
+     * chosen by their session ID. If both queues in that shard are empty, steal from another shard.
+     */
+    home_idx = (is_server ? cache->evict_fill_shard : session->id) % cache->evict_shard_count;
+    home = &cache->evict_shards[home_idx];
+
     WT_STAT_CONN_INCR(session, cache_eviction_get_ref);
 
-    /* Avoid the LRU lock if no pages are available. */
-    if (__evict_queue_empty(cache->evict_current_queue, is_server) &&
-      __evict_queue_empty(cache->evict_other_queue, is_server) &&
-      (!urgent_ok || __evict_queue_empty(urgent_queue, false))) {
+    for (shard = home, i = 0; i < cache->evict_shard_count; ++i) {
+        shard = &cache->evict_shards[(home_idx + i) % cache->evict_shard_count];
+        if (!__evict_queue_empty(shard->evict_current_queue, is_server) ||
+          !__evict_queue_empty(shard->evict_other_queue, is_server))
+            break;
+    }
+    if (i == cache->evict_shard_count)
+        shard = home;
+
+    /* Avoid the locks if no pages are available. */
+    if (i == cache->evict_shard_count && (!urgent_ok || __evict_queue_empty(urgent_queue, false))) {
         WT_STAT_CONN_INCR(session, cache_eviction_get_ref_empty);
         return (WT_NOTFOUND);
     }
@@ -2319,38 +2629,39 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
      * refill the queues. Such cases are extremely rare in real applications.
      */
     if (is_server && (!urgent_ok || __evict_queue_empty(urgent_queue, false)) &&
-      !__evict_queue_full(cache->evict_current_queue) &&
-      !__evict_queue_full(cache->evict_fill_queue) &&
+      !__evict_queue_full(home->evict_current_queue) &&
+      !__evict_queue_full(home->evict_fill_queue) &&
       (cache->evict_empty_score > WT_EVICT_SCORE_CUTOFF ||
-        __evict_queue_empty(cache->evict_fill_queue, false)))
+        __evict_queue_empty(home->evict_fill_queue, false)))
         return (WT_NOTFOUND);
 
-    __wt_spin_lock(session, &cache->evict_queue_lock);
-
     /* Check the urgent queue first. */
     if (urgent_ok && !__evict_queue_empty(urgent_queue, false))
         queue = urgent_queue;
     else {
+        if (shard != home)
+            WT_STAT_CONN_INCR(session, cache_eviction_get_ref_steal);
+
         /*
          * Check if the current queue needs to change.
          *
          * The server will only evict half of the pages before looking for more, but should only
          * switch queues if there are no other eviction workers.
          */
-        queue = cache->evict_current_queue;
-        other_queue = cache->evict_other_queue;
+        __wt_spin_lock(session, &shard->evict_queue_lock);
+        queue = shard->evict_current_queue;
+        other_queue = shard->evict_other_queue;
         if (__evict_queue_empty(queue, server_only) &&
           !__evict_queue_empty(other_queue, server_only)) {
-            cache->evict_current_queue = other_queue;
-            cache->evict_other_queue = queue;
+            shard->evict_current_queue = other_queue;
+            shard->evict_other_queue = queue;
         }
+        __wt_spin_unlock(session, &shard->evict_queue_lock);
     }
 
-    __wt_spin_unlock(session, &cache->evict_queue_lock);
-
     /*
-     * We got the queue lock, which should be fast, and chose a queue. Now we want to get the lock
-     * on the individual queue.
+     * We chose a queue, taking at most the shard's lock, which should be fast. Now we want to get
+     * the lock on the individual queue.
      */
     for (;;) {
         /* Verify there are still pages available. */
@@ -2380,6 +2691,16 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
             continue;
         WT_ASSERT(session, evict->btree != NULL);
 
+        /*
+         * If we're only evicting to enforce cache quotas, discard candidates from trees that have
+         * dropped back within their quota.
+         */
+        if (F_ISSET(cache, WT_CACHE_EVICT_QUOTA) && queue != urgent_queue &&
+          !__wt_btree_over_cache_quota(evict->btree)) {
+            __evict_list_clear(session, evict);
+            continue;
+        }
+
         /*
          * Evicting a dirty page in the server thread could stall during a write and prevent
          * eviction from finding new work.
@@ -2497,6 +2818,11 @@ __evict_page(WT_SESSION_IMPL *session, bool is_server)
           session, cache_eviction_app_time, WT_CLOCKDIFF_US(time_stop, time_start));
     }
 
+    /* Let application threads waiting on the eviction threads know there's progress. */
+    if (ret == 0 && (is_server || F_ISSET(session, WT_SESSION_INTERNAL)) &&
+      __wt_atomic_load32(&cache->evict_app_waiters) != 0)
+        __wt_cond_signal(session, cache->evict_app_cond);
+
     if (WT_UNLIKELY(ret != 0)) {
         if (is_server)
             WT_STAT_CONN_INCR(session, cache_eviction_server_evict_fail);
@@ -2524,11 +2850,13 @@ __wt_cache_eviction_worker(WT_SESSION_IMPL *session, bool busy, bool readonly, d
     WT_CACHE *cache;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
+    WT_EVICT_TRACE_EVENT trace_event;
     WT_TRACK_OP_DECL;
     WT_TXN_GLOBAL *txn_global;
     WT_TXN_SHARED *txn_shared;
-    uint64_t cache_max_wait_us, initial_progress, max_progress;
+    uint64_t app_wait_us, cache_max_wait_us, initial_progress, max_progress;
     uint64_t elapsed, time_start, time_stop;
+    uint8_t trace_reason;
     bool app_thread;
 
     WT_TRACK_OP_INIT(session);
@@ -2536,6 +2864,7 @@ __wt_cache_eviction_worker(WT_SESSION_IMPL *session, bool busy, bool readonly, d
     conn = S2C(session);
     cache = conn->cache;
     time_start = 0;
+    trace_reason = WT_EVICT_TRACE_REASON_NONE;
     txn_global = &conn->txn_global;
     txn_shared = WT_SESSION_TXN_SHARED(session);
 
@@ -2567,8 +2896,19 @@ __wt_cache_eviction_worker(WT_SESSION_IMPL *session, bool busy, bool readonly, d
 
     /* Track how long application threads spend doing eviction. */
     app_thread = !F_ISSET(session, WT_SESSION_INTERNAL);
-    if (app_thread)
+    if (app_thread) {
         time_start = __wt_clock(session);
+        if (cache->evict_trace != NULL)
+            trace_reason = __wti_evict_trace_reason(session, 0);
+    }
+
+    /*
+     * Application threads with a wait budget leave eviction to the eviction threads for as long as
+     * the budget lasts. Without eviction worker threads, the server is busy filling the queues.
+     */
+    app_wait_us = 0;
+    if (app_thread && WT_EVICT_HAS_WORKERS(session))
+        app_wait_us = __wt_atomic_load64(&cache->evict_app_wait_us);
 
     /*
      * Note that this for loop is designed to reset expected eviction error codes before exiting,
@@ -2628,6 +2968,24 @@ __wt_cache_eviction_worker(WT_SESSION_IMPL *session, bool busy, bool readonly, d
             (__wt_atomic_loadv64(&cache->eviction_progress) > initial_progress + max_progress)))
             break;
 
+        /*
+         * Wait for the eviction threads to make progress while there's budget left in this
+         * operation, then fall back to evicting pages ourselves.
+         */
+        if (app_wait_us != 0) {
+            elapsed = WT_CLOCKDIFF_US(__wt_clock(session), time_start);
+            if (elapsed < app_wait_us) {
+                (void)__wt_atomic_addv32(&cache->evict_app_waiters, 1);
+                __wt_cond_wait(session, cache->evict_app_cond,
+                  WT_MIN(app_wait_us - elapsed, 10 * WT_THOUSAND), NULL);
+                (void)__wt_atomic_subv32(&cache->evict_app_waiters, 1);
+                WT_STAT_CONN_INCR(session, cache_eviction_app_wait);
+                continue;
+            }
+            WT_STAT_CONN_INCR(session, cache_eviction_app_wait_exhausted);
+            app_wait_us = 0;
+        }
+
         /* Evict a page. */
         switch (ret = __evict_page(session, false)) {
         case 0:
@@ -2652,8 +3010,16 @@ err:
         elapsed = WT_CLOCKDIFF_US(time_stop, time_start);
         WT_STAT_CONN_INCR(session, application_cache_ops);
         WT_STAT_CONN_INCRV(session, application_cache_time, elapsed);
+        __wt_stat_usecs_hist_incr_evictapp(session, elapsed);
         WT_STAT_SESSION_INCRV(session, cache_time, elapsed);
         session->cache_wait_us += elapsed;
+        if (cache->evict_trace != NULL) {
+            WT_CLEAR(trace_event);
+            trace_event.type = WT_EVICT_TRACE_STALL;
+            trace_event.reason = trace_reason;
+            trace_event.elapsed_us = elapsed;
+            __wti_evict_trace_add(session, &trace_event);
+        }
         /*
          * Check if a rollback is required only if there has not been an error. Returning an error
          * takes precedence over asking for a rollback. We can not do both.
@@ -2699,7 +3065,7 @@ __wt_page_evict_urgent(WT_SESSION_IMPL *session, WT_REF *ref)
         return (false);
 
     /* Append to the urgent queue if we can. */
-    urgent_queue = &cache->evict_queues[WT_EVICT_URGENT_QUEUE];
+    urgent_queue = cache->evict_urgent_queue;
     queued = false;
 
     __wt_spin_lock(session, &cache->evict_queue_lock);
@@ -186,15 +186,28 @@ __wt_evict(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF_STATE previous_state, u
 {
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
+    WT_EVICT_TRACE_EVENT trace_event;
     WT_PAGE *page;
+    uint64_t reconcile_start, trace_start;
     uint8_t stats_flags;
-    bool clean_page, closing, ebusy_only, inmem_split, tree_dead;
+    bool clean_page, closing, ebusy_only, inmem_split, reentry, trace, tree_dead;
 
     conn = S2C(session);
     page = ref->page;
     closing = LF_ISSET(WT_EVICT_CALL_CLOSING);
     stats_flags = 0;
-    clean_page = ebusy_only = false;
+    clean_page = ebusy_only = inmem_split = false;
+    reconcile_start = trace_start = 0;
+
+    /* Describe the page for the eviction trace before it's discarded. */
+    trace = conn->cache->evict_trace != NULL;
+    if (trace) {
+        WT_CLEAR(trace_event);
+        trace_event.page = (uint64_t)(uintptr_t)page;
+        trace_event.page_bytes = __wt_atomic_loadsize(&page->memory_footprint);
+        trace_event.reason = __wti_evict_trace_reason(session, flags);
+        trace_start = __wt_clock(session);
+    }
 
     __wt_verbose(
       session, WT_VERB_EVICT, "page %p (%s)", (void *)page, __wt_page_type_string(page->type));
@@ -204,7 +217,8 @@ __wt_evict(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF_STATE previous_state, u
         LF_SET(WT_EVICT_CALL_NO_SPLIT);
 
     /* As re-entry into eviction is possible, only clear the statistics on the first entry. */
-    if (__wt_session_gen((session), (WT_GEN_EVICT)) == 0) {
+    reentry = __wt_session_gen((session), (WT_GEN_EVICT)) != 0;
+    if (!reentry) {
         WT_CLEAR(session->evict_timeline);
         session->evict_timeline.evict_start = __wt_clock(session);
     } else {
@@ -271,8 +285,14 @@ __wt_evict(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF_STATE previous_state, u
     }
 
     /* No need to reconcile the page if it is from a dead tree or it is clean. */
-    if (!tree_dead && __wt_page_is_modified(page))
-        WT_ERR(__evict_reconcile(session, ref, flags));
+    if (!tree_dead && __wt_page_is_modified(page)) {
+        if (trace)
+            reconcile_start = __wt_clock(session);
+        ret = __evict_reconcile(session, ref, flags);
+        if (trace)
+            trace_event.reconcile_us = WT_CLOCKDIFF_US(__wt_clock(session), reconcile_start);
+        WT_ERR(ret);
+    }
 
     /* After this spot, the only recoverable failure is EBUSY. */
     ebusy_only = true;
@@ -306,11 +326,16 @@ __wt_evict(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF_STATE previous_state, u
     /* Update the reference and discard the page. */
     if (__wt_ref_is_root(ref))
         __wt_ref_out(session, ref);
-    else if ((clean_page && !F_ISSET(conn, WT_CONN_IN_MEMORY)) || tree_dead)
+    else if ((clean_page && !F_ISSET(conn, WT_CONN_IN_MEMORY)) || tree_dead) {
+        /* Let a victim block cache know the page's on-disk image was recently used. */
+        if (clean_page && !tree_dead)
+            __wt_blkcache_page_evicted(session, ref);
+
         /*
          * Pages that belong to dead trees never write back to disk and can't support page splits.
          */
         WT_ERR(__evict_page_clean_update(session, ref, flags));
+    }
     else
         WT_ERR(__evict_page_dirty_update(session, ref, flags));
 
@@ -333,6 +358,18 @@ done:
         FLD_SET(stats_flags, WT_EVICT_STATS_SUCCESS);
     __evict_stats_update(session, stats_flags);
 
+    if (trace) {
+        if (ret != 0)
+            trace_event.type = WT_EVICT_TRACE_EVICT_FAIL;
+        else
+            trace_event.type = inmem_split ? WT_EVICT_TRACE_SPLIT : WT_EVICT_TRACE_EVICT;
+        /* History store writes are only counted for the outermost eviction. */
+        if (!reentry)
+            trace_event.hs_bytes = session->evict_timeline.hs_bytes;
+        trace_event.elapsed_us = WT_CLOCKDIFF_US(__wt_clock(session), trace_start);
+        __wti_evict_trace_add(session, &trace_event);
+    }
+
     /* Leave any local eviction generation. */
     WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
     WT_LEAVE_GENERATION(session, WT_GEN_EVICT);
@@ -0,0 +1,242 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The eviction trace keeps the most recent page evictions and application thread stalls in a ring
+ * buffer owned by the cache. Writers claim a slot by incrementing the trace's sequence number, and
+ * never wait for each other or for readers: the sequence number of a slot is cleared while its
+ * event is written, readers copy events out and discard copies whose sequence number changed.
+ */
+
+static const char *const __evict_trace_thread[] = {"application", "eviction", "internal"};
+
+static const char *const __evict_trace_type[] = {"evict", "evict_fail", "split", "stall"};
+
+static const char *const __evict_trace_reason[] = {"none", "forced", "close", "clean_trigger",
+  "dirty_trigger", "updates_trigger", "clean_target", "dirty_target", "updates_target", "quota"};
+
+/*
+ * __wt_evict_trace_create --
+ *     Allocate the eviction trace if it's configured.
+ */
+int
+__wt_evict_trace_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CACHE *cache;
+    WT_CONFIG_ITEM cval;
+
+    cache = S2C(session)->cache;
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction_trace.enabled", &cval));
+    if (cval.val == 0)
+        return (0);
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction_trace.events", &cval));
+    WT_RET(__wt_calloc_def(session, (size_t)cval.val, &cache->evict_trace));
+    cache->evict_trace_size = (uint32_t)cval.val;
+    return (0);
+}
+
+/*
+ * __wt_evict_trace_destroy --
+ *     Discard the eviction trace.
+ */
+void
+__wt_evict_trace_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CACHE *cache;
+
+    cache = S2C(session)->cache;
+
+    __wt_free(session, cache->evict_trace);
+    cache->evict_trace_size = 0;
+}
+
+/*
+ * __wti_evict_trace_reason --
+ *     Return the cache state causing an eviction with the given flags, or an application thread
+ *     stall.
+ */
+uint8_t
+__wti_evict_trace_reason(WT_SESSION_IMPL *session, uint32_t flags)
+{
+    WT_CACHE *cache;
+    uint32_t cache_flags;
+
+    cache = S2C(session)->cache;
+
+    if (LF_ISSET(WT_EVICT_CALL_URGENT))
+        return (WT_EVICT_TRACE_REASON_FORCED);
+    if (LF_ISSET(WT_EVICT_CALL_CLOSING))
+        return (WT_EVICT_TRACE_REASON_CLOSE);
+
+    /* The most pressing state the eviction server last saw wins. */
+    cache_flags = __wt_atomic_load32(&cache->flags);
+    if (FLD_ISSET(cache_flags, WT_CACHE_EVICT_CLEAN_HARD))
+        return (WT_EVICT_TRACE_REASON_CLEAN_TRIGGER);
+    if (FLD_ISSET(cache_flags, WT_CACHE_EVICT_DIRTY_HARD))
+        return (WT_EVICT_TRACE_REASON_DIRTY_TRIGGER);
+    if (FLD_ISSET(cache_flags, WT_CACHE_EVICT_UPDATES_HARD))
+        return (WT_EVICT_TRACE_REASON_UPDATES_TRIGGER);
+    if (FLD_ISSET(cache_flags, WT_CACHE_EVICT_CLEAN))
+        return (WT_EVICT_TRACE_REASON_CLEAN_TARGET);
+    if (FLD_ISSET(cache_flags, WT_CACHE_EVICT_DIRTY))
+        return (WT_EVICT_TRACE_REASON_DIRTY_TARGET);
+    if (FLD_ISSET(cache_flags, WT_CACHE_EVICT_UPDATES))
+        return (WT_EVICT_TRACE_REASON_UPDATES_TARGET);
+    if (FLD_ISSET(cache_flags, WT_CACHE_EVICT_QUOTA))
+        return (WT_EVICT_TRACE_REASON_QUOTA);
+    return (WT_EVICT_TRACE_REASON_NONE);
+}
+
+/*
+ * __wti_evict_trace_add --
+ *     Add an event to the eviction trace. The caller fills in the type, reason and measurements of
+ *     the event, the rest is filled in here.
+ */
+void
+__wti_evict_trace_add(WT_SESSION_IMPL *session, WT_EVICT_TRACE_EVENT *event)
+{
+    struct timespec ts;
+    WT_CACHE *cache;
+    WT_EVICT_TRACE_EVENT *slot;
+    uint64_t seq;
+
+    cache = S2C(session)->cache;
+
+    __wt_epoch(session, &ts);
+    event->time_us = (uint64_t)ts.tv_sec * WT_MILLION + (uint64_t)ts.tv_nsec / WT_THOUSAND;
+    if (F_ISSET(session, WT_SESSION_EVICTION))
+        event->thread = WT_EVICT_TRACE_THREAD_EVICT;
+    else if (F_ISSET(session, WT_SESSION_INTERNAL))
+        event->thread = WT_EVICT_TRACE_THREAD_INTERNAL;
+    else
+        event->thread = WT_EVICT_TRACE_THREAD_APP;
+    if (session->dhandle != NULL)
+        WT_IGNORE_RET(
+          __wt_snprintf(event->uri, sizeof(event->uri), "%s", session->dhandle->name));
+    else
+        event->uri[0] = '\0';
+
+    /*
+     * Claim a slot, clear its sequence number so readers ignore it while it's written, and publish
+     * the event by setting its sequence number last.
+     */
+    seq = __wt_atomic_add64(&cache->evict_trace_seq, 1);
+    slot = &cache->evict_trace[seq % cache->evict_trace_size];
+    __wt_atomic_store64(&slot->seq, 0);
+    WT_RELEASE_BARRIER();
+    event->seq = 0;
+    *slot = *event;
+    WT_RELEASE_BARRIER();
+    __wt_atomic_store64(&slot->seq, seq);
+}
+
+/*
+ * __wt_evict_trace_copy --
+ *     Copy the events in the eviction trace, oldest first, into an allocated array.
+ */
+int
+__wt_evict_trace_copy(
+  WT_SESSION_IMPL *session, WT_EVICT_TRACE_EVENT **eventsp, uint32_t *entriesp)
+{
+    WT_CACHE *cache;
+    WT_EVICT_TRACE_EVENT *event, *events;
+    uint64_t first, last, seq;
+    uint32_t entries;
+
+    *eventsp = NULL;
+    *entriesp = 0;
+
+    cache = S2C(session)->cache;
+    if (cache->evict_trace == NULL)
+        return (0);
+
+    last = __wt_atomic_load64(&cache->evict_trace_seq);
+    if (last == 0)
+        return (0);
+    first = last > cache->evict_trace_size ? last - cache->evict_trace_size + 1 : 1;
+    WT_RET(__wt_calloc_def(session, (size_t)(last - first + 1), &events));
+
+    /* Skip events being written, or overwritten since we started copying. */
+    for (entries = 0, seq = first; seq <= last; ++seq) {
+        event = &cache->evict_trace[seq % cache->evict_trace_size];
+        if (__wt_atomic_load64(&event->seq) != seq)
+            continue;
+        WT_ACQUIRE_BARRIER();
+        events[entries] = *event;
+        WT_ACQUIRE_BARRIER();
+        if (__wt_atomic_load64(&event->seq) != seq)
+            continue;
+        events[entries].seq = seq;
+        events[entries].uri[WT_EVICT_TRACE_URI_MAX - 1] = '\0';
+        ++entries;
+    }
+
+    *eventsp = events;
+    *entriesp = entries;
+    return (0);
+}
+
+/*
+ * __wt_evict_trace_names --
+ *     Return the names of an event's thread, type and reason.
+ */
+void
+__wt_evict_trace_names(const WT_EVICT_TRACE_EVENT *event, const char **threadp,
+  const char **typep, const char **reasonp)
+{
+    *threadp = event->thread < WT_ELEMENTS(__evict_trace_thread) ?
+      __evict_trace_thread[event->thread] :
+      "unknown";
+    *typep = event->type < WT_ELEMENTS(__evict_trace_type) ?
+      __evict_trace_type[event->type] :
+      "unknown";
+    *reasonp = event->reason < WT_ELEMENTS(__evict_trace_reason) ?
+      __evict_trace_reason[event->reason] :
+      "unknown";
+}
+
+/*
+ * __wt_verbose_dump_evict_trace --
+ *     Output the events in the eviction trace.
+ */
+int
+__wt_verbose_dump_evict_trace(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+    WT_EVICT_TRACE_EVENT *event, *events;
+    uint32_t entries, i;
+    const char *reason, *thread, *type;
+
+    WT_RET(__wt_msg(session, "%s", WT_DIVIDER));
+    WT_RET(__wt_msg(session, "eviction trace dump"));
+
+    if (S2C(session)->cache->evict_trace == NULL)
+        return (__wt_msg(session, "eviction trace not enabled"));
+
+    WT_RET(__wt_evict_trace_copy(session, &events, &entries));
+    WT_ERR(__wt_msg(session, "%" PRIu32 " events", entries));
+    for (i = 0; i < entries; ++i) {
+        event = &events[i];
+        __wt_evict_trace_names(event, &thread, &type, &reason);
+        WT_ERR(__wt_msg(session,
+          "%" PRIu64 ": time %" PRIu64 "us, %s thread, %s, reason %s, uri %s, page 0x%" PRIx64
+          ", %" PRIu64 "B, reconcile %" PRIu64 "us, history store %" PRIu64 "B, elapsed %" PRIu64
+          "us",
+          event->seq, event->time_us, thread, type, reason,
+          event->uri[0] == '\0' ? "none" : event->uri, event->page, event->page_bytes,
+          event->reconcile_us, event->hs_bytes, event->elapsed_us));
+    }
+
+err:
+    __wt_free(session, events);
+    return (ret);
+}
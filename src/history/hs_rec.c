@@ -236,6 +236,7 @@ __hs_insert_record(WT_SESSION_IMPL *session, WT_CURSOR *cursor, WT_BTREE *btree,
     cursor->set_value(
       cursor, tw, tw->durable_stop_ts, tw->durable_start_ts, (uint64_t)type, hs_value);
     WT_ERR(cursor->insert(cursor));
+    session->evict_timeline.hs_bytes += key->size + hs_value->size;
 
 err:
     if (!hs_read_all_flag)
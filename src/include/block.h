@@ -43,6 +43,15 @@
  * list, the alloc and discard extent lists are not searched based on size.
  */
 
+/*
+ * WT_BLOCK_SIZE_CLASSES --
+ *	Available extents are grouped into size classes: up to 4KB, up to 32KB, up
+ * to 1MB, and larger. Segregated allocation doesn't split an extent from one
+ * class to satisfy a request from a smaller class, unless the extent is in the
+ * largest class.
+ */
+#define WT_BLOCK_SIZE_CLASSES 4
+
 /*
  * WT_EXTLIST --
  *	An extent list.
@@ -60,6 +69,10 @@ struct __wt_extlist {
 
     bool track_size; /* Maintain per-size skiplist */
 
+    /* Per-size class counts, maintained along with the per-size skiplist. */
+    uint32_t class_entries[WT_BLOCK_SIZE_CLASSES];
+    uint64_t class_bytes[WT_BLOCK_SIZE_CLASSES];
+
     WT_EXT *last; /* Cached last element */
 
     WT_EXT *off[WT_SKIP_MAXDEPTH]; /* Size/offset skiplists */
@@ -174,6 +187,24 @@ struct __wt_block_ckpt {
     WT_EXTLIST ckpt_discard; /* Checkpoint archive */
 };
 
+/*
+ * WT_BLOCK_READ_REQ --
+ *	A single address-cookie referenced block in a batched read.
+ */
+struct __wt_block_read_req {
+    const uint8_t *addr; /* Address cookie */
+    size_t addr_size;
+    WT_ITEM *buf; /* Returned block image */
+    bool valid;   /* Block read and checksum verified */
+};
+
+/*
+ * WT_BLOCK_READ_COALESCE_MAX --
+ *	Blocks in a batched read that are adjacent in the file are read with a single
+ * I/O up to this size, and then copied into their own buffers.
+ */
+#define WT_BLOCK_READ_COALESCE_MAX (4 * WT_MEGABYTE)
+
 /*
  * WT_BM --
  *	Block manager handle, references a single checkpoint in a btree.
@@ -202,6 +233,7 @@ struct __wt_bm {
     bool (*is_mapped)(WT_BM *, WT_SESSION_IMPL *);
     int (*map_discard)(WT_BM *, WT_SESSION_IMPL *, void *, size_t);
     int (*read)(WT_BM *, WT_SESSION_IMPL *, WT_ITEM *, const uint8_t *, size_t);
+    int (*read_batch)(WT_BM *, WT_SESSION_IMPL *, WT_BLOCK_READ_REQ *, u_int);
     int (*salvage_end)(WT_BM *, WT_SESSION_IMPL *);
     int (*salvage_next)(WT_BM *, WT_SESSION_IMPL *, uint8_t *, size_t *, bool *);
     int (*salvage_start)(WT_BM *, WT_SESSION_IMPL *);
@@ -268,13 +300,25 @@ struct __wt_block {
 
     /* Configuration information, set when the file is opened. */
     wt_shared uint32_t allocfirst; /* Allocation is first-fit */
+    bool allocsegregated;          /* Allocation is segregated by size class */
     uint32_t allocsize;            /* Allocation size */
     size_t os_cache;               /* System buffer cache flush max */
     size_t os_cache_max;
     size_t os_cache_dirty_max;
+    size_t write_combine_max; /* Combined checkpoint write max */
 
     u_int block_header; /* Header length */
 
+    /*
+     * Checkpoint writes to adjacent file offsets are gathered into a single buffer and written
+     * together, the pending write is flushed before the checkpoint completes.
+     */
+    WT_SPINLOCK write_combine_lock;      /* Combined write lock */
+    WT_ITEM write_combine_buf;           /* Combined write buffer */
+    wt_off_t write_combine_offset;       /* Combined write file offset */
+    wt_shared size_t write_combine_size; /* Combined write pending bytes */
+    u_int write_combine_blocks;          /* Combined write pending blocks */
+
     /*
      * There is only a single checkpoint in a file that can be written; stored here, only accessed
      * by one WT_BM handle.
@@ -34,6 +34,12 @@
 #define WT_BLKCACHE_EVICT_OTHER 0            /* Not evicting for various reasons */
 #define WT_BLKCACHE_NOT_EVICTION_CANDIDATE 1 /* Not evicting because of frequency counter */
 
+/* Victim cache: number of eviction generation ranges tracked in an eviction pass. */
+#define WT_BLKCACHE_VICTIM_BUCKETS 64
+
+/* Blocks read in each batch when warming the cache on startup. */
+#define WT_BLKCACHE_PREWARM_BATCH 64
+
 /* Block access operations. */
 #define WT_BLKCACHE_RM_EXIT 1
 #define WT_BLKCACHE_RM_FREE 2
@@ -60,11 +66,30 @@ struct __wt_blkcache_item {
 
     wt_shared uint32_t ref_count; /* References */
 
+    /*
+     * In a victim cache, the eviction generation of the block's page: zero while the page is in the
+     * cache, set when a clean copy of the page is evicted.
+     */
+    uint64_t evict_gen;
+
     uint32_t fid;      /* File ID */
     uint8_t addr_size; /* Address cookie */
     uint8_t addr[];
 };
 
+/*
+ * WT_BLKCACHE_MANIFEST_ENTRY --
+ *     A block listed in the warm restart manifest.
+ */
+struct __wt_blkcache_manifest_entry {
+    wt_off_t offset;   /* Block offset, set when the manifest is loaded */
+    size_t addr_off;   /* Offset of the address cookie in the cookie buffer */
+    uint32_t fid;      /* File ID */
+    uint32_t refs;     /* References */
+    uint32_t size;     /* Block size */
+    uint8_t addr_size; /* Address cookie size */
+};
+
 /*
  * WT_BLKCACHE --
  *     Block cache metadata includes the hashtable of cached items, number of cached data blocks
@@ -82,6 +107,26 @@ struct __wt_blkcache {
     bool cache_on_checkpoint; /* Don't cache blocks written by checkpoints */
     bool cache_on_writes;     /* Cache blocks on writes */
 
+    /*
+     * Victim cache: keep the blocks of clean pages evicted from the cache, evicting them in least
+     * recently evicted order.
+     */
+    bool victim_cache;
+    wt_shared uint64_t victim_gen; /* Current eviction generation */
+    uint64_t victim_evict_gen;     /* Evict blocks up to this generation */
+
+    /*
+     * Warm restart: checkpoints and shutdown write a manifest of the most referenced blocks in the
+     * cache, and a thread reads them back into the cache on startup. Until the manifest has been
+     * loaded, the cache holds only part of the previous content, don't overwrite it.
+     */
+    bool warm_restart;
+    WT_SESSION_IMPL *prewarm_session;
+    wt_thread_t prewarm_tid;
+    bool prewarm_tid_set;
+    wt_shared volatile bool prewarm_exiting; /* If stopping the warm restart thread */
+    wt_shared volatile bool prewarm_done;    /* If the manifest has been loaded */
+
 #ifdef ENABLE_MEMKIND
     struct memkind *pmem_kind; /* NVRAM connection */
 #endif
@@ -37,6 +37,7 @@ struct __wt_chunkcache_hashid {
     const char *objectname;
     uint32_t objectid;
     wt_off_t offset;
+    uint64_t hash; /* full hash of the ID, the key of the frequency sketch */
 };
 
 /* Hold the values used while hashing object ID, name, and offset tuples. */
@@ -61,9 +62,23 @@ struct __wt_chunkcache_chunk {
     size_t chunk_size;
     wt_shared volatile bool valid; /* Availability to read data from the chunk marked. */
 
+/* How the chunk got into the cache, for hit statistics. */
+#define WT_CHUNK_ORIGIN_FLUSHED 0  /* Ingested from a freshly-flushed table */
+#define WT_CHUNK_ORIGIN_METADATA 1 /* Created from persisted metadata on startup */
+#define WT_CHUNK_ORIGIN_READ 2     /* Read from storage on a miss */
+    uint8_t origin;
+
+/* The TinyLFU region holding the chunk, when it is on one of the policy's lists. */
+#define WT_CHUNK_SEGMENT_WINDOW 0
+#define WT_CHUNK_SEGMENT_PROBATION 1
+#define WT_CHUNK_SEGMENT_PROTECTED 2
+#define WT_CHUNK_SEGMENT_COUNT 3
+    uint8_t segment;
+
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CHUNK_FROM_METADATA 0x1u
-#define WT_CHUNK_PINNED 0x2u
+#define WT_CHUNK_ON_LRU 0x2u
+#define WT_CHUNK_PINNED 0x4u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 8 */
     uint8_t flags;
 };
@@ -74,6 +89,20 @@ struct __wt_chunkcache_bucket {
     WT_SPINLOCK bucket_lock;
 };
 
+/*
+ * WT_CHUNKCACHE_SKETCH --
+ *     A count-min sketch estimating how often each chunk is accessed. Every 64-bit word holds
+ *     sixteen 4-bit counters and a chunk maps to four counters in four different words. Once the
+ *     number of recorded accesses reaches the sample size, all counters are halved so the sketch
+ *     favors recent popularity.
+ */
+struct __wt_chunkcache_sketch {
+    uint64_t *table;      /* Counter words */
+    uint64_t mask;        /* Number of words minus one, a power of two */
+    uint64_t additions;   /* Accesses recorded since the last halving */
+    uint64_t sample_size; /* Accesses between halvings */
+};
+
 struct __wt_chunkcache_pinned_list {
     char **array;         /* list of objects we wish to pin in chunk cache */
     uint32_t entries;     /* count of pinned objects */
@@ -119,6 +148,24 @@ struct __wt_chunkcache {
     unsigned int evict_trigger; /* When this percent of cache is full, we trigger eviction. */
     WT_CHUNKCACHE_PINNED_LIST pinned_objects;
 
+    /*
+     * Admission and replacement policy. The clock policy sweeps the hash table evicting chunks that
+     * haven't been accessed recently. The TinyLFU policy admits new chunks into a small LRU window;
+     * chunks leaving the window only enter the main region, split into probation and protected LRU
+     * segments, if the frequency sketch estimates they are accessed more often than the chunk they
+     * would replace. The policy lists and sketch are protected by the policy lock, which is always
+     * acquired after any bucket lock.
+     */
+#define WT_CHUNKCACHE_POLICY_CLOCK 1
+#define WT_CHUNKCACHE_POLICY_TINYLFU 2
+    uint8_t policy;
+    WT_SPINLOCK policy_lock;
+    WT_CHUNKCACHE_SKETCH sketch;
+    TAILQ_HEAD(__wt_chunklru_head, __wt_chunkcache_chunk) lru[WT_CHUNK_SEGMENT_COUNT];
+    uint64_t lru_bytes[WT_CHUNK_SEGMENT_COUNT];
+    uint64_t window_max;    /* Maximum bytes in the window */
+    uint64_t protected_max; /* Maximum bytes in the protected segment */
+
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CHUNKCACHE_CONFIGURED 0x1u
 #define WT_CHUNK_CACHE_EXITING 0x2u
@@ -39,3 +39,19 @@ __wt_extlist_read_pair(const uint8_t **p, wt_off_t *offp, wt_off_t *sizep)
     *sizep = (wt_off_t)v;
     return (0);
 }
+
+/*
+ * __wt_block_size_class --
+ *     Return the size class of an extent.
+ */
+static WT_INLINE u_int
+__wt_block_size_class(wt_off_t size)
+{
+    if (size <= 4 * WT_KILOBYTE)
+        return (0);
+    if (size <= 32 * WT_KILOBYTE)
+        return (1);
+    if (size <= WT_MEGABYTE)
+        return (2);
+    return (WT_BLOCK_SIZE_CLASSES - 1);
+}
@@ -320,6 +320,9 @@ struct __wt_page_modify {
     uint64_t obsolete_check_txn;
     wt_timestamp_t obsolete_check_timestamp;
 
+    /* The longest update chain that could not be trimmed, for background trimming. */
+    wt_shared uint32_t obsolete_chain_len;
+
     /* The largest transaction seen on the page by reconciliation. */
     uint64_t rec_max_txn;
     wt_timestamp_t rec_max_timestamp;
@@ -726,13 +729,14 @@ struct __wt_page {
 #define WT_PAGE_COMPACTION_WRITE 0x002u   /* Writing the page for compaction */
 #define WT_PAGE_DISK_ALLOC 0x004u         /* Disk image in allocated memory */
 #define WT_PAGE_DISK_MAPPED 0x008u        /* Disk image in mapped memory */
-#define WT_PAGE_EVICT_LRU 0x010u          /* Page is on the LRU queue */
-#define WT_PAGE_EVICT_LRU_URGENT 0x020u   /* Page is in the urgent queue */
-#define WT_PAGE_EVICT_NO_PROGRESS 0x040u  /* Eviction doesn't count as progress */
-#define WT_PAGE_INTL_OVERFLOW_KEYS 0x080u /* Internal page has overflow keys (historic only) */
-#define WT_PAGE_PREFETCH 0x100u           /* The page is being pre-fetched */
-#define WT_PAGE_SPLIT_INSERT 0x200u       /* A leaf page was split for append */
-#define WT_PAGE_UPDATE_IGNORE 0x400u      /* Ignore updates on page discard */
+#define WT_PAGE_DISK_SLAB 0x010u          /* Disk image in cache slab memory */
+#define WT_PAGE_EVICT_LRU 0x020u          /* Page is on the LRU queue */
+#define WT_PAGE_EVICT_LRU_URGENT 0x040u   /* Page is in the urgent queue */
+#define WT_PAGE_EVICT_NO_PROGRESS 0x080u  /* Eviction doesn't count as progress */
+#define WT_PAGE_INTL_OVERFLOW_KEYS 0x100u /* Internal page has overflow keys (historic only) */
+#define WT_PAGE_PREFETCH 0x200u           /* The page is being pre-fetched */
+#define WT_PAGE_SPLIT_INSERT 0x400u       /* A leaf page was split for append */
+#define WT_PAGE_UPDATE_IGNORE 0x800u      /* Ignore updates on page discard */
                                           /* AUTOMATIC FLAG VALUE GENERATION STOP 16 */
     wt_shared uint16_t flags_atomic;      /* Atomic flags, use F_*_ATOMIC_16 */
 
@@ -748,7 +752,8 @@ struct __wt_page {
 #define WT_PAGE_ROW_LEAF 7      /* Row-store leaf page */
     uint8_t type;               /* Page type */
 
-    /* 1 byte hole expected. */
+#define WT_EVICT_FREQ_MAX 3
+    wt_shared uint8_t evict_freq; /* Access count for the frequency eviction policy */
 
     wt_shared size_t memory_footprint; /* Memory attached to the page */
 
@@ -210,6 +210,14 @@ struct __wt_btree {
      */
     uint64_t file_max;
 
+    /*
+     * Per-tree cache quota and reservation, in bytes. Eviction favors pages from trees using more
+     * than their quota and leaves trees using less than their reservation alone until eviction is
+     * aggressive.
+     */
+    uint64_t cache_max;
+    uint64_t cache_reserve;
+
 /*
  * We maintain a timer for a clean file to avoid excessive checking of checkpoint information that
  * incurs a large processing penalty. We avoid that but will periodically incur the cost to clean up
@@ -233,6 +241,8 @@ struct __wt_btree {
     uint64_t flush_most_recent_secs; /* Wall clock time for the most recent flush */
     uint64_t flush_most_recent_ts;   /* Timestamp of the most recent flush */
 
+    wt_shared uint32_t chain_trim_len; /* Longest untrimmed update chain, for background trimming */
+
 /*
  * All of the following fields live at the end of the structure so it's easier to clear everything
  * but the fields that persist.
@@ -264,6 +264,7 @@ __wt_cache_page_inmem_incr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 {
     WT_BTREE *btree;
     WT_CACHE *cache;
+    uint64_t btree_inmem;
 
     WT_ASSERT(session, size < WT_EXABYTE);
     btree = S2BT(session);
@@ -277,13 +278,18 @@ __wt_cache_page_inmem_incr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
      * threads that are trying to decrease the sizes concurrently.
      */
     (void)__wt_atomic_add64(&cache->bytes_inmem, size);
-    (void)__wt_atomic_add64(&btree->bytes_inmem, size);
+    btree_inmem = __wt_atomic_add64(&btree->bytes_inmem, size);
     if (WT_PAGE_IS_INTERNAL(page)) {
         (void)__wt_atomic_add64(&cache->bytes_internal, size);
         (void)__wt_atomic_add64(&btree->bytes_internal, size);
     }
     (void)__wt_atomic_addsize(&page->memory_footprint, size);
 
+    /* Wake eviction if the tree has grown past its cache quota. */
+    if (btree->cache_max != 0 && btree_inmem > btree->cache_max &&
+      !__wt_atomic_loadbool(&cache->evict_quota_exceeded))
+        __wt_atomic_storebool(&cache->evict_quota_exceeded, true);
+
     if (page->modify != NULL) {
         /*
          * For application threads, track the transaction bytes added to cache usage. We want to
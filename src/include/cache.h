@@ -32,8 +32,14 @@ struct __wt_evict_entry {
     uint64_t score;  /* Relative eviction priority */
 };
 
-#define WT_EVICT_QUEUE_MAX 3    /* Two ordinary queues plus urgent */
-#define WT_EVICT_URGENT_QUEUE 2 /* Urgent queue index */
+/*
+ * Ordinary eviction candidates are split across shards, each with a pair of queues, so threads
+ * looking for pages to evict don't all contend on the same locks. There's a shard for every few
+ * eviction threads: application threads and eviction workers take pages from their own shard and
+ * steal from the others when it's empty. There is a single urgent queue.
+ */
+#define WT_EVICT_SHARD_MAX 8     /* Maximum eviction queue shards */
+#define WT_EVICT_SHARD_THREADS 4 /* Eviction threads per queue shard */
 
 /*
  * WT_EVICT_QUEUE --
@@ -48,6 +54,82 @@ struct __wt_evict_queue {
     wt_shared volatile uint32_t evict_max; /* LRU maximum eviction slot used */
 };
 
+/*
+ * WT_EVICT_SHARD --
+ *	Encapsulation of a pair of ordinary eviction candidate queues.
+ */
+struct __wt_evict_shard {
+    WT_CACHE_LINE_PAD_BEGIN
+    WT_SPINLOCK evict_queue_lock;        /* Eviction current queue lock */
+    WT_EVICT_QUEUE *evict_queues;        /* The shard's pair of queues */
+    WT_EVICT_QUEUE *evict_current_queue; /* LRU current queue in use */
+    WT_EVICT_QUEUE *evict_fill_queue;    /* LRU next queue to fill.
+                                            This is usually the same as the
+                                            "other" queue but under heavy
+                                            load the eviction server will
+                                            start filling the current queue
+                                            before it switches. */
+    WT_EVICT_QUEUE *evict_other_queue;   /* LRU queue not in use */
+    WT_CACHE_LINE_PAD_END
+};
+
+/*
+ * WT_EVICT_TREE --
+ *	A tree ranked by the cache content eviction is looking for.
+ */
+struct __wt_evict_tree {
+    WT_DATA_HANDLE *dhandle; /* Ranked tree */
+    uint64_t score;          /* Bytes of interest to eviction */
+};
+
+#define WT_EVICT_RANK_TREES_MAX 1000 /* Trees kept by a ranking */
+#define WT_EVICT_RANK_PASSES 10      /* Eviction passes a ranking is used for */
+
+/*
+ * WT_EVICT_TRACE_EVENT --
+ *	A page eviction or an application thread stall recorded in the eviction trace. Events are
+ * written to a ring buffer: the sequence number is cleared while an event is written, so readers
+ * can tell complete events from events being written or overwritten.
+ */
+#define WT_EVICT_TRACE_URI_MAX 64 /* Tree URI bytes kept per event */
+
+#define WT_EVICT_TRACE_EVICT 0      /* Page evicted */
+#define WT_EVICT_TRACE_EVICT_FAIL 1 /* Page eviction failed */
+#define WT_EVICT_TRACE_SPLIT 2      /* Page split in memory instead of evicted */
+#define WT_EVICT_TRACE_STALL 3      /* Application thread stalled on a full cache */
+
+#define WT_EVICT_TRACE_THREAD_APP 0      /* Application thread */
+#define WT_EVICT_TRACE_THREAD_EVICT 1    /* Eviction thread */
+#define WT_EVICT_TRACE_THREAD_INTERNAL 2 /* Other internal thread */
+
+#define WT_EVICT_TRACE_REASON_NONE 0            /* Cache below its targets */
+#define WT_EVICT_TRACE_REASON_FORCED 1          /* Page forcibly evicted */
+#define WT_EVICT_TRACE_REASON_CLOSE 2           /* Tree closing */
+#define WT_EVICT_TRACE_REASON_CLEAN_TRIGGER 3   /* Cache over its trigger */
+#define WT_EVICT_TRACE_REASON_DIRTY_TRIGGER 4   /* Dirty content over its trigger */
+#define WT_EVICT_TRACE_REASON_UPDATES_TRIGGER 5 /* Updates over their trigger */
+#define WT_EVICT_TRACE_REASON_CLEAN_TARGET 6    /* Cache over its target */
+#define WT_EVICT_TRACE_REASON_DIRTY_TARGET 7    /* Dirty content over its target */
+#define WT_EVICT_TRACE_REASON_UPDATES_TARGET 8  /* Updates over their target */
+#define WT_EVICT_TRACE_REASON_QUOTA 9           /* Tree over its cache quota */
+
+#define WT_EVICT_TRACE_KEY_FORMAT WT_UNCHECKED_STRING(Q)
+#define WT_EVICT_TRACE_VALUE_FORMAT WT_UNCHECKED_STRING(QSSSSQQQQQ)
+
+struct __wt_evict_trace_event {
+    wt_shared uint64_t seq;           /* Sequence number, 0 while written */
+    uint64_t time_us;                 /* Time since the Epoch */
+    uint64_t page;                    /* Page address */
+    uint64_t page_bytes;              /* Page memory footprint */
+    uint64_t reconcile_us;            /* Time reconciling the page */
+    uint64_t hs_bytes;                /* History store bytes written */
+    uint64_t elapsed_us;              /* Time evicting the page, or stalled */
+    uint8_t type;                     /* Event type */
+    uint8_t thread;                   /* Type of thread */
+    uint8_t reason;                   /* Cache state causing the event */
+    char uri[WT_EVICT_TRACE_URI_MAX]; /* Tree */
+};
+
 /* Cache operations. */
 typedef enum __wt_cache_op {
     WT_SYNC_CHECKPOINT,
@@ -56,8 +138,13 @@ typedef enum __wt_cache_op {
     WT_SYNC_WRITE_LEAVES
 } WT_CACHE_OP;
 
+/* Eviction page replacement policies. */
+typedef enum __wt_evict_policy { WT_EVICT_POLICY_LRU, WT_EVICT_POLICY_FREQUENCY } WT_EVICT_POLICY;
+
 #define WT_HS_FILE_MIN (100 * WT_MEGABYTE)
 
+#define WT_CACHE_SLAB_EMPTY_MAX 2 /* Empty slabs kept for reuse */
+
 /*
  * WiredTiger cache structure.
  */
@@ -118,6 +205,26 @@ struct __wt_cache {
     WT_CONDVAR *evict_cond;      /* Eviction server condition */
     WT_SPINLOCK evict_walk_lock; /* Eviction walk location */
 
+    /*
+     * Application threads waiting for the eviction threads to make progress.
+     */
+    WT_CONDVAR *evict_app_cond;           /* Application eviction wait condition */
+    wt_shared uint32_t evict_app_waiters; /* Application threads waiting */
+    wt_shared uint64_t evict_app_wait_us; /* Application eviction wait budget per operation */
+
+    /*
+     * Eviction pacing: growth rates of the cache content smoothed over the eviction server's
+     * samples, and the content they project at the pacing horizon.
+     */
+    wt_shared uint64_t evict_pacing_horizon_ms;      /* Pacing horizon, 0 if pacing is off */
+    uint64_t evict_pacing_sample_time;               /* Time of the last sample */
+    uint64_t evict_pacing_inuse_last;                /* Bytes in cache at the last sample */
+    uint64_t evict_pacing_dirty_last;                /* Dirty bytes at the last sample */
+    wt_shared double evict_pacing_inuse_rate;        /* Bytes in cache growth per second */
+    wt_shared double evict_pacing_dirty_rate;        /* Dirty bytes growth per second */
+    wt_shared uint64_t evict_pacing_inuse_predicted; /* Bytes in cache at the horizon */
+    wt_shared uint64_t evict_pacing_dirty_predicted; /* Dirty bytes at the horizon */
+
     /*
      * Eviction threshold percentages use double type to allow for specifying percentages less than
      * one.
@@ -132,6 +239,9 @@ struct __wt_cache {
     double eviction_checkpoint_target; /* Percent to reduce dirty to during checkpoint scrubs */
     wt_shared double eviction_scrub_target; /* Current scrub target */
 
+    wt_shared WT_EVICT_POLICY evict_policy; /* Page replacement policy */
+    wt_shared bool evict_quota_exceeded;    /* A tree is over its cache quota */
+
     u_int overhead_pct;              /* Cache percent adjustment */
     uint64_t cache_max_wait_us;      /* Maximum time an operation waits for space in cache */
     uint64_t cache_stuck_timeout_ms; /* Maximum time the cache can be stuck for in diagnostic mode
@@ -161,18 +271,34 @@ struct __wt_cache {
     WT_SESSION_IMPL *walk_session; /* Eviction pass session */
     WT_DATA_HANDLE *walk_tree;     /* LRU walk current tree */
 
-    WT_SPINLOCK evict_queue_lock; /* Eviction current queue lock */
-    WT_EVICT_QUEUE evict_queues[WT_EVICT_QUEUE_MAX];
-    WT_EVICT_QUEUE *evict_current_queue; /* LRU current queue in use */
-    WT_EVICT_QUEUE *evict_fill_queue;    /* LRU next queue to fill.
-                                            This is usually the same as the
-                                            "other" queue but under heavy
-                                            load the eviction server will
-                                            start filling the current queue
-                                            before it switches. */
-    WT_EVICT_QUEUE *evict_other_queue;   /* LRU queue not in use */
-    WT_EVICT_QUEUE *evict_urgent_queue;  /* LRU urgent queue */
-    uint32_t evict_slots;                /* LRU list eviction slots */
+    /*
+     * Trees ranked by the cache content eviction is looking for, best first, when the eviction
+     * server chooses trees by rank rather than stepping through the handle list.
+     */
+    wt_shared bool evict_rank_trees;   /* Choose trees by rank */
+    WT_EVICT_TREE *evict_ranked;       /* Ranked trees */
+    uint32_t evict_ranked_entries;     /* Trees in the ranking */
+    uint32_t evict_ranked_next;        /* Next ranked tree to walk */
+    uint64_t evict_ranked_dhandle_gen; /* Handle list removals at the ranking */
+    uint64_t evict_ranked_pass_gen;    /* Eviction pass of the ranking */
+    uint32_t evict_ranked_flags;       /* Eviction flags of the ranking */
+
+    /*
+     * Eviction trace: a ring buffer of page evictions and application thread stalls, allocated when
+     * the trace is enabled.
+     */
+    WT_EVICT_TRACE_EVENT *evict_trace;  /* Ring buffer of events */
+    uint32_t evict_trace_size;          /* Events in the ring buffer */
+    wt_shared uint64_t evict_trace_seq; /* Last event sequence number */
+
+    WT_SPINLOCK evict_queue_lock;       /* Eviction urgent queue lock */
+    WT_EVICT_QUEUE *evict_queues;       /* Ordinary queues by shard, then urgent */
+    uint32_t evict_queue_count;         /* Number of eviction queues */
+    WT_EVICT_SHARD *evict_shards;       /* Ordinary queue shards */
+    uint32_t evict_shard_count;         /* Number of ordinary queue shards */
+    uint32_t evict_fill_shard;          /* Next shard to fill */
+    WT_EVICT_QUEUE *evict_urgent_queue; /* LRU urgent queue */
+    uint32_t evict_slots;               /* LRU list eviction slots */
 
 #define WT_EVICT_PRESSURE_THRESHOLD 0.95
 #define WT_EVICT_SCORE_BUMP 10
@@ -215,6 +341,19 @@ struct __wt_cache {
     uint64_t cp_saved_app_waits;  /* User wait count at last review */
     uint64_t cp_saved_read;       /* Read count at last review */
 
+    /*
+     * Slab allocator for page images read from disk.
+     */
+    bool slab_enabled;                                  /* Allocate page images from slabs */
+    bool slab_hugepages;                                /* Back slabs with huge pages */
+    WT_CACHE_SLAB_CLASS *slab_classes;                  /* Slabs by chunk size class */
+    WT_SPINLOCK slab_empty_lock;                        /* Empty slab lock */
+    WT_CACHE_SLAB *slab_empty[WT_CACHE_SLAB_EMPTY_MAX]; /* Empty slabs kept for reuse */
+    u_int slab_empty_count;                             /* Count of empty slabs */
+    wt_shared uint64_t slab_bytes;                      /* Bytes in slabs */
+    wt_shared uint64_t slab_bytes_inuse;                /* Bytes in chunks in use */
+    wt_shared uint64_t slab_bytes_requested;            /* Bytes requested from chunks in use */
+
 /*
  * Flags.
  */
@@ -230,10 +369,11 @@ struct __wt_cache {
 #define WT_CACHE_EVICT_DIRTY 0x004u        /* Evict dirty pages */
 #define WT_CACHE_EVICT_DIRTY_HARD 0x008u   /* Dirty % blocking app threads */
 #define WT_CACHE_EVICT_NOKEEP 0x010u       /* Don't add read pages to cache */
-#define WT_CACHE_EVICT_SCRUB 0x020u        /* Scrub dirty pages */
-#define WT_CACHE_EVICT_UPDATES 0x040u      /* Evict pages with updates */
-#define WT_CACHE_EVICT_UPDATES_HARD 0x080u /* Update % blocking app threads */
-#define WT_CACHE_EVICT_URGENT 0x100u       /* Pages are in the urgent queue */
+#define WT_CACHE_EVICT_QUOTA 0x020u        /* Trees are over their cache quota */
+#define WT_CACHE_EVICT_SCRUB 0x040u        /* Scrub dirty pages */
+#define WT_CACHE_EVICT_UPDATES 0x080u      /* Evict pages with updates */
+#define WT_CACHE_EVICT_UPDATES_HARD 0x100u /* Update % blocking app threads */
+#define WT_CACHE_EVICT_URGENT 0x200u       /* Pages are in the urgent queue */
 /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
 #define WT_CACHE_EVICT_ALL (WT_CACHE_EVICT_CLEAN | WT_CACHE_EVICT_DIRTY | WT_CACHE_EVICT_UPDATES)
 #define WT_CACHE_EVICT_HARD \
@@ -246,6 +386,40 @@ struct __wt_cache {
         WT_WITH_LOCK_WAIT(session, &cache->evict_pass_lock, WT_SESSION_LOCKED_PASS, op); \
     } while (0)
 
+/*
+ * WT_CACHE_SLAB --
+ *	A slab of memory for page images. Slabs are aligned to their size, so the slab a chunk belongs
+ * to can be found from the chunk's address. The slab header takes the first granule, the rest of
+ * the slab is split into chunks of a single size class. Free chunks are listed in the header rather
+ * than linked through the chunks, so the memory of a free chunk can be returned to the system.
+ */
+#define WT_CACHE_SLAB_SIZE (2 * WT_MEGABYTE)    /* Slab size, a huge page */
+#define WT_CACHE_SLAB_GRANULE (4 * WT_KILOBYTE) /* Chunk sizes are multiples of the granule */
+#define WT_CACHE_SLAB_CLASSES 16                /* Size classes, 4KB to 128KB */
+#define WT_CACHE_SLAB_CHUNKS_MAX (WT_CACHE_SLAB_SIZE / WT_CACHE_SLAB_GRANULE - 1)
+#define WT_CACHE_SLAB_CHUNK_NONE UINT16_MAX
+struct __wt_cache_slab {
+    TAILQ_ENTRY(__wt_cache_slab) q; /* Size class's slabs with free chunks */
+
+    size_t chunk_size; /* Chunk size */
+    uint32_t chunks;   /* Chunks in the slab */
+    uint32_t used;     /* Chunks in use */
+    uint8_t class_id;  /* Size class */
+
+    uint16_t free;                           /* First free chunk */
+    uint16_t next[WT_CACHE_SLAB_CHUNKS_MAX]; /* Next free chunk */
+};
+
+/*
+ * WT_CACHE_SLAB_CLASS --
+ *	The slabs of a chunk size class. Classes are locked separately, the lock is padded to a cache
+ * line.
+ */
+struct __wt_cache_slab_class {
+    WT_SPINLOCK lock;
+    TAILQ_HEAD(__wt_cache_slab_qh, __wt_cache_slab) slabqh; /* Slabs with free chunks */
+};
+
 /*
  * WT_CACHE_POOL --
  *	A structure that represents a shared cache.
@@ -64,6 +64,23 @@ __wt_cache_read_gen_bump(WT_SESSION_IMPL *session, WT_PAGE *page)
     __wt_atomic_store64(&page->read_gen, __wt_cache_read_gen(session) + WT_READGEN_STEP);
 }
 
+/*
+ * __wt_cache_evict_freq_bump --
+ *     Count an access to the page for the frequency eviction policy.
+ */
+static WT_INLINE void
+__wt_cache_evict_freq_bump(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+    uint8_t freq;
+
+    if (S2C(session)->cache->evict_policy != WT_EVICT_POLICY_FREQUENCY)
+        return;
+
+    /* Don't write the page once the count saturates, hot pages are shared by many threads. */
+    if ((freq = __wt_atomic_load8(&page->evict_freq)) < WT_EVICT_FREQ_MAX)
+        __wt_atomic_store8(&page->evict_freq, freq + 1);
+}
+
 /*
  * __wt_cache_read_gen_new --
  *     Get the read generation for a new page in memory.
@@ -353,6 +370,27 @@ __wt_eviction_updates_needed(WT_SESSION_IMPL *session, double *pct_fullp)
     return (bytes_updates > (uint64_t)(cache->eviction_updates_trigger * bytes_max) / 100);
 }
 
+/*
+ * __wt_btree_over_cache_quota --
+ *     Return if a btree is using more than its configured cache quota.
+ */
+static WT_INLINE bool
+__wt_btree_over_cache_quota(WT_BTREE *btree)
+{
+    return (btree->cache_max != 0 && __wt_atomic_load64(&btree->bytes_inmem) > btree->cache_max);
+}
+
+/*
+ * __wt_btree_under_cache_reserve --
+ *     Return if a btree is using less than its configured cache reservation.
+ */
+static WT_INLINE bool
+__wt_btree_under_cache_reserve(WT_BTREE *btree)
+{
+    return (
+      btree->cache_reserve != 0 && __wt_atomic_load64(&btree->bytes_inmem) < btree->cache_reserve);
+}
+
 /*
  * __wt_btree_dominating_cache --
  *     Return if a single btree is occupying at least half of any of our target's cache usage.
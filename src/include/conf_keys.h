@@ -16,320 +16,340 @@
  * API configuration keys: BEGIN
  */
 #define WT_CONF_ID_Assert 1ULL
-#define WT_CONF_ID_Block_cache 176ULL
-#define WT_CONF_ID_Checkpoint 191ULL
-#define WT_CONF_ID_Checkpoint_cleanup 194ULL
-#define WT_CONF_ID_Chunk_cache 196ULL
-#define WT_CONF_ID_Compatibility 198ULL
-#define WT_CONF_ID_Debug 122ULL
-#define WT_CONF_ID_Debug_mode 200ULL
-#define WT_CONF_ID_Encryption 19ULL
-#define WT_CONF_ID_Eviction 218ULL
-#define WT_CONF_ID_File_manager 230ULL
-#define WT_CONF_ID_Flush_tier 165ULL
-#define WT_CONF_ID_Hash 290ULL
-#define WT_CONF_ID_History_store 235ULL
-#define WT_CONF_ID_Import 104ULL
-#define WT_CONF_ID_Incremental 127ULL
-#define WT_CONF_ID_Io_capacity 237ULL
-#define WT_CONF_ID_Log 36ULL
-#define WT_CONF_ID_Lsm 68ULL
-#define WT_CONF_ID_Lsm_manager 247ULL
-#define WT_CONF_ID_Merge_custom 78ULL
-#define WT_CONF_ID_Operation_tracking 250ULL
-#define WT_CONF_ID_Prefetch 270ULL
-#define WT_CONF_ID_Roundup_timestamps 159ULL
-#define WT_CONF_ID_Shared_cache 252ULL
-#define WT_CONF_ID_Statistics_log 256ULL
-#define WT_CONF_ID_Tiered_storage 47ULL
-#define WT_CONF_ID_Transaction_sync 308ULL
+#define WT_CONF_ID_Block_cache 181ULL
+#define WT_CONF_ID_Cache_slab 289ULL
+#define WT_CONF_ID_Chain_trim 198ULL
+#define WT_CONF_ID_Checkpoint 201ULL
+#define WT_CONF_ID_Checkpoint_cleanup 204ULL
+#define WT_CONF_ID_Chunk_cache 206ULL
+#define WT_CONF_ID_Compatibility 208ULL
+#define WT_CONF_ID_Debug 126ULL
+#define WT_CONF_ID_Debug_mode 210ULL
+#define WT_CONF_ID_Encryption 21ULL
+#define WT_CONF_ID_Eviction 228ULL
+#define WT_CONF_ID_Eviction_trace 303ULL
+#define WT_CONF_ID_File_manager 244ULL
+#define WT_CONF_ID_Flush_tier 169ULL
+#define WT_CONF_ID_Hash 307ULL
+#define WT_CONF_ID_History_store 249ULL
+#define WT_CONF_ID_Import 108ULL
+#define WT_CONF_ID_Incremental 131ULL
+#define WT_CONF_ID_Io_capacity 251ULL
+#define WT_CONF_ID_Io_uring 313ULL
+#define WT_CONF_ID_Log 38ULL
+#define WT_CONF_ID_Lsm 71ULL
+#define WT_CONF_ID_Lsm_manager 261ULL
+#define WT_CONF_ID_Merge_custom 81ULL
+#define WT_CONF_ID_Operation_tracking 264ULL
+#define WT_CONF_ID_Prefetch 284ULL
+#define WT_CONF_ID_Roundup_timestamps 163ULL
+#define WT_CONF_ID_Shared_cache 266ULL
+#define WT_CONF_ID_Statistics_log 270ULL
+#define WT_CONF_ID_Tiered_storage 49ULL
+#define WT_CONF_ID_Transaction_sync 328ULL
 #define WT_CONF_ID_access_pattern_hint 12ULL
-#define WT_CONF_ID_action 93ULL
+#define WT_CONF_ID_action 96ULL
 #define WT_CONF_ID_allocation_size 13ULL
 #define WT_CONF_ID_app_metadata 0ULL
-#define WT_CONF_ID_append 90ULL
-#define WT_CONF_ID_archive 241ULL
-#define WT_CONF_ID_auth_token 48ULL
-#define WT_CONF_ID_auto_throttle 69ULL
-#define WT_CONF_ID_available 301ULL
-#define WT_CONF_ID_background 97ULL
-#define WT_CONF_ID_background_compact 201ULL
-#define WT_CONF_ID_backup 169ULL
-#define WT_CONF_ID_backup_restore_target 273ULL
-#define WT_CONF_ID_blkcache_eviction_aggression 179ULL
+#define WT_CONF_ID_app_wait_ms 229ULL
+#define WT_CONF_ID_append 93ULL
+#define WT_CONF_ID_archive 255ULL
+#define WT_CONF_ID_auth_token 50ULL
+#define WT_CONF_ID_auto_throttle 72ULL
+#define WT_CONF_ID_available 321ULL
+#define WT_CONF_ID_background 100ULL
+#define WT_CONF_ID_background_compact 211ULL
+#define WT_CONF_ID_backup 173ULL
+#define WT_CONF_ID_backup_restore_target 286ULL
+#define WT_CONF_ID_blkcache_eviction_aggression 184ULL
 #define WT_CONF_ID_block_allocation 14ULL
 #define WT_CONF_ID_block_compressor 15ULL
-#define WT_CONF_ID_bloom 70ULL
-#define WT_CONF_ID_bloom_bit_count 71ULL
-#define WT_CONF_ID_bloom_config 72ULL
-#define WT_CONF_ID_bloom_false_positives 114ULL
-#define WT_CONF_ID_bloom_hash_count 73ULL
-#define WT_CONF_ID_bloom_oldest 74ULL
-#define WT_CONF_ID_bound 94ULL
-#define WT_CONF_ID_bucket 49ULL
-#define WT_CONF_ID_bucket_prefix 50ULL
-#define WT_CONF_ID_buckets 291ULL
-#define WT_CONF_ID_buffer_alignment 274ULL
-#define WT_CONF_ID_builtin_extension_config 275ULL
-#define WT_CONF_ID_bulk 120ULL
-#define WT_CONF_ID_cache 170ULL
-#define WT_CONF_ID_cache_cursors 266ULL
-#define WT_CONF_ID_cache_directory 51ULL
-#define WT_CONF_ID_cache_max_wait_ms 187ULL
-#define WT_CONF_ID_cache_on_checkpoint 177ULL
-#define WT_CONF_ID_cache_on_writes 178ULL
-#define WT_CONF_ID_cache_overhead 188ULL
-#define WT_CONF_ID_cache_resident 16ULL
-#define WT_CONF_ID_cache_size 189ULL
-#define WT_CONF_ID_cache_stuck_timeout_ms 190ULL
-#define WT_CONF_ID_capacity 277ULL
-#define WT_CONF_ID_checkpoint 56ULL
-#define WT_CONF_ID_checkpoint_backup_info 57ULL
-#define WT_CONF_ID_checkpoint_cleanup 163ULL
-#define WT_CONF_ID_checkpoint_fail_before_turtle_update 267ULL
-#define WT_CONF_ID_checkpoint_lsn 58ULL
-#define WT_CONF_ID_checkpoint_read_timestamp 123ULL
-#define WT_CONF_ID_checkpoint_retention 203ULL
-#define WT_CONF_ID_checkpoint_sync 276ULL
-#define WT_CONF_ID_checkpoint_use_history 121ULL
-#define WT_CONF_ID_checkpoint_wait 109ULL
-#define WT_CONF_ID_checksum 17ULL
-#define WT_CONF_ID_chunk 253ULL
-#define WT_CONF_ID_chunk_cache 239ULL
-#define WT_CONF_ID_chunk_cache_evict_trigger 278ULL
-#define WT_CONF_ID_chunk_count_limit 75ULL
-#define WT_CONF_ID_chunk_max 76ULL
-#define WT_CONF_ID_chunk_size 77ULL
-#define WT_CONF_ID_chunks 66ULL
-#define WT_CONF_ID_close_handle_minimum 231ULL
-#define WT_CONF_ID_close_idle_time 232ULL
-#define WT_CONF_ID_close_scan_interval 233ULL
-#define WT_CONF_ID_colgroups 87ULL
+#define WT_CONF_ID_bloom 73ULL
+#define WT_CONF_ID_bloom_bit_count 74ULL
+#define WT_CONF_ID_bloom_config 75ULL
+#define WT_CONF_ID_bloom_false_positives 118ULL
+#define WT_CONF_ID_bloom_hash_count 76ULL
+#define WT_CONF_ID_bloom_oldest 77ULL
+#define WT_CONF_ID_bound 97ULL
+#define WT_CONF_ID_bucket 51ULL
+#define WT_CONF_ID_bucket_prefix 52ULL
+#define WT_CONF_ID_buckets 308ULL
+#define WT_CONF_ID_buffer_alignment 287ULL
+#define WT_CONF_ID_builtin_extension_config 288ULL
+#define WT_CONF_ID_bulk 124ULL
+#define WT_CONF_ID_cache 174ULL
+#define WT_CONF_ID_cache_cursors 280ULL
+#define WT_CONF_ID_cache_directory 53ULL
+#define WT_CONF_ID_cache_max 16ULL
+#define WT_CONF_ID_cache_max_wait_ms 194ULL
+#define WT_CONF_ID_cache_on_checkpoint 182ULL
+#define WT_CONF_ID_cache_on_writes 183ULL
+#define WT_CONF_ID_cache_overhead 195ULL
+#define WT_CONF_ID_cache_reserve 17ULL
+#define WT_CONF_ID_cache_resident 18ULL
+#define WT_CONF_ID_cache_size 196ULL
+#define WT_CONF_ID_cache_stuck_timeout_ms 197ULL
+#define WT_CONF_ID_capacity 292ULL
+#define WT_CONF_ID_checkpoint 59ULL
+#define WT_CONF_ID_checkpoint_backup_info 60ULL
+#define WT_CONF_ID_checkpoint_cleanup 167ULL
+#define WT_CONF_ID_checkpoint_fail_before_turtle_update 281ULL
+#define WT_CONF_ID_checkpoint_lsn 61ULL
+#define WT_CONF_ID_checkpoint_read_timestamp 127ULL
+#define WT_CONF_ID_checkpoint_retention 213ULL
+#define WT_CONF_ID_checkpoint_sync 291ULL
+#define WT_CONF_ID_checkpoint_use_history 125ULL
+#define WT_CONF_ID_checkpoint_wait 113ULL
+#define WT_CONF_ID_checksum 19ULL
+#define WT_CONF_ID_chunk 267ULL
+#define WT_CONF_ID_chunk_cache 253ULL
+#define WT_CONF_ID_chunk_cache_evict_trigger 293ULL
+#define WT_CONF_ID_chunk_count_limit 78ULL
+#define WT_CONF_ID_chunk_max 79ULL
+#define WT_CONF_ID_chunk_size 80ULL
+#define WT_CONF_ID_chunks 69ULL
+#define WT_CONF_ID_close_handle_minimum 245ULL
+#define WT_CONF_ID_close_idle_time 246ULL
+#define WT_CONF_ID_close_scan_interval 247ULL
+#define WT_CONF_ID_colgroups 90ULL
 #define WT_CONF_ID_collator 6ULL
 #define WT_CONF_ID_columns 7ULL
 #define WT_CONF_ID_commit_timestamp 2ULL
-#define WT_CONF_ID_compare 115ULL
-#define WT_CONF_ID_compare_timestamp 105ULL
-#define WT_CONF_ID_compile_configuration_count 283ULL
-#define WT_CONF_ID_compressor 295ULL
-#define WT_CONF_ID_config 262ULL
-#define WT_CONF_ID_config_base 284ULL
-#define WT_CONF_ID_configuration 204ULL
-#define WT_CONF_ID_consolidate 128ULL
-#define WT_CONF_ID_corruption_abort 202ULL
-#define WT_CONF_ID_count 116ULL
-#define WT_CONF_ID_create 285ULL
-#define WT_CONF_ID_cursor_copy 205ULL
-#define WT_CONF_ID_cursor_reposition 206ULL
-#define WT_CONF_ID_cursors 171ULL
-#define WT_CONF_ID_default 302ULL
-#define WT_CONF_ID_dhandle_buckets 292ULL
-#define WT_CONF_ID_dictionary 18ULL
-#define WT_CONF_ID_direct_io 286ULL
-#define WT_CONF_ID_do_not_clear_txn_id 143ULL
-#define WT_CONF_ID_drop 164ULL
-#define WT_CONF_ID_dryrun 98ULL
-#define WT_CONF_ID_dump 126ULL
-#define WT_CONF_ID_dump_address 144ULL
-#define WT_CONF_ID_dump_all_data 145ULL
-#define WT_CONF_ID_dump_blocks 146ULL
-#define WT_CONF_ID_dump_key_data 147ULL
-#define WT_CONF_ID_dump_layout 148ULL
-#define WT_CONF_ID_dump_offsets 149ULL
-#define WT_CONF_ID_dump_pages 150ULL
-#define WT_CONF_ID_dump_version 124ULL
+#define WT_CONF_ID_compare 119ULL
+#define WT_CONF_ID_compare_timestamp 109ULL
+#define WT_CONF_ID_compile_configuration_count 298ULL
+#define WT_CONF_ID_compressor 315ULL
+#define WT_CONF_ID_config 276ULL
+#define WT_CONF_ID_config_base 299ULL
+#define WT_CONF_ID_configuration 214ULL
+#define WT_CONF_ID_consolidate 132ULL
+#define WT_CONF_ID_corruption_abort 212ULL
+#define WT_CONF_ID_count 120ULL
+#define WT_CONF_ID_create 300ULL
+#define WT_CONF_ID_cursor_copy 215ULL
+#define WT_CONF_ID_cursor_reposition 216ULL
+#define WT_CONF_ID_cursors 175ULL
+#define WT_CONF_ID_default 322ULL
+#define WT_CONF_ID_dhandle_buckets 309ULL
+#define WT_CONF_ID_dictionary 20ULL
+#define WT_CONF_ID_direct_io 301ULL
+#define WT_CONF_ID_do_not_clear_txn_id 147ULL
+#define WT_CONF_ID_drop 168ULL
+#define WT_CONF_ID_dryrun 101ULL
+#define WT_CONF_ID_dump 130ULL
+#define WT_CONF_ID_dump_address 148ULL
+#define WT_CONF_ID_dump_all_data 149ULL
+#define WT_CONF_ID_dump_blocks 150ULL
+#define WT_CONF_ID_dump_key_data 151ULL
+#define WT_CONF_ID_dump_layout 152ULL
+#define WT_CONF_ID_dump_offsets 153ULL
+#define WT_CONF_ID_dump_pages 154ULL
+#define WT_CONF_ID_dump_version 128ULL
 #define WT_CONF_ID_durable_timestamp 3ULL
-#define WT_CONF_ID_early_load 263ULL
-#define WT_CONF_ID_enabled 37ULL
-#define WT_CONF_ID_entry 264ULL
-#define WT_CONF_ID_error_prefix 217ULL
-#define WT_CONF_ID_evict_sample_inmem 221ULL
-#define WT_CONF_ID_eviction 207ULL
-#define WT_CONF_ID_eviction_checkpoint_target 222ULL
-#define WT_CONF_ID_eviction_dirty_target 223ULL
-#define WT_CONF_ID_eviction_dirty_trigger 224ULL
-#define WT_CONF_ID_eviction_target 225ULL
-#define WT_CONF_ID_eviction_trigger 226ULL
-#define WT_CONF_ID_eviction_updates_target 227ULL
-#define WT_CONF_ID_eviction_updates_trigger 228ULL
-#define WT_CONF_ID_exclude 99ULL
-#define WT_CONF_ID_exclusive 103ULL
-#define WT_CONF_ID_exclusive_refreshed 96ULL
-#define WT_CONF_ID_extensions 288ULL
-#define WT_CONF_ID_extra_diagnostics 229ULL
-#define WT_CONF_ID_extractor 63ULL
-#define WT_CONF_ID_file 129ULL
-#define WT_CONF_ID_file_extend 289ULL
-#define WT_CONF_ID_file_max 236ULL
-#define WT_CONF_ID_file_metadata 107ULL
-#define WT_CONF_ID_final_flush 167ULL
-#define WT_CONF_ID_flush_time 85ULL
-#define WT_CONF_ID_flush_timestamp 86ULL
-#define WT_CONF_ID_flushed_data_cache_insertion 280ULL
-#define WT_CONF_ID_force 110ULL
-#define WT_CONF_ID_force_stop 130ULL
-#define WT_CONF_ID_force_write_wait 296ULL
-#define WT_CONF_ID_format 22ULL
-#define WT_CONF_ID_free_space_target 100ULL
-#define WT_CONF_ID_full_target 180ULL
-#define WT_CONF_ID_generation_drain_timeout_ms 234ULL
-#define WT_CONF_ID_get 142ULL
-#define WT_CONF_ID_granularity 131ULL
-#define WT_CONF_ID_handles 172ULL
-#define WT_CONF_ID_hashsize 182ULL
-#define WT_CONF_ID_hazard_max 293ULL
-#define WT_CONF_ID_huffman_key 23ULL
-#define WT_CONF_ID_huffman_value 24ULL
-#define WT_CONF_ID_id 59ULL
-#define WT_CONF_ID_ignore_cache_size 269ULL
-#define WT_CONF_ID_ignore_in_memory_cache_size 25ULL
-#define WT_CONF_ID_ignore_prepare 154ULL
-#define WT_CONF_ID_immutable 64ULL
-#define WT_CONF_ID_in_memory 294ULL
-#define WT_CONF_ID_inclusive 95ULL
-#define WT_CONF_ID_index_key_columns 65ULL
-#define WT_CONF_ID_internal_item_max 26ULL
-#define WT_CONF_ID_internal_key_max 27ULL
-#define WT_CONF_ID_internal_key_truncate 28ULL
-#define WT_CONF_ID_internal_page_max 29ULL
-#define WT_CONF_ID_interval 307ULL
-#define WT_CONF_ID_isolation 155ULL
-#define WT_CONF_ID_json 257ULL
-#define WT_CONF_ID_json_output 240ULL
-#define WT_CONF_ID_key_format 30ULL
-#define WT_CONF_ID_key_gap 31ULL
-#define WT_CONF_ID_keyid 21ULL
-#define WT_CONF_ID_last 67ULL
-#define WT_CONF_ID_leaf_item_max 32ULL
-#define WT_CONF_ID_leaf_key_max 33ULL
-#define WT_CONF_ID_leaf_page_max 34ULL
-#define WT_CONF_ID_leaf_value_max 35ULL
-#define WT_CONF_ID_leak_memory 168ULL
-#define WT_CONF_ID_local_retention 52ULL
-#define WT_CONF_ID_lock_wait 111ULL
-#define WT_CONF_ID_log 173ULL
-#define WT_CONF_ID_log_retention 208ULL
-#define WT_CONF_ID_log_size 192ULL
-#define WT_CONF_ID_max_percent_overhead 183ULL
-#define WT_CONF_ID_memory_page_image_max 38ULL
-#define WT_CONF_ID_memory_page_max 39ULL
-#define WT_CONF_ID_merge 249ULL
-#define WT_CONF_ID_merge_max 82ULL
-#define WT_CONF_ID_merge_min 83ULL
-#define WT_CONF_ID_metadata_file 108ULL
-#define WT_CONF_ID_method 195ULL
-#define WT_CONF_ID_mmap 298ULL
-#define WT_CONF_ID_mmap_all 299ULL
-#define WT_CONF_ID_multiprocess 300ULL
-#define WT_CONF_ID_name 20ULL
-#define WT_CONF_ID_next_random 134ULL
-#define WT_CONF_ID_next_random_sample_size 135ULL
-#define WT_CONF_ID_next_random_seed 136ULL
-#define WT_CONF_ID_no_timestamp 156ULL
-#define WT_CONF_ID_nvram_path 184ULL
-#define WT_CONF_ID_object_target_size 53ULL
-#define WT_CONF_ID_old_chunks 84ULL
-#define WT_CONF_ID_oldest 88ULL
-#define WT_CONF_ID_oldest_timestamp 271ULL
-#define WT_CONF_ID_on_close 258ULL
-#define WT_CONF_ID_operation 117ULL
-#define WT_CONF_ID_operation_timeout_ms 157ULL
-#define WT_CONF_ID_os_cache_dirty_max 40ULL
-#define WT_CONF_ID_os_cache_dirty_pct 242ULL
-#define WT_CONF_ID_os_cache_max 41ULL
-#define WT_CONF_ID_overwrite 91ULL
-#define WT_CONF_ID_path 251ULL
-#define WT_CONF_ID_percent_file_in_dram 185ULL
-#define WT_CONF_ID_pinned 197ULL
-#define WT_CONF_ID_prealloc 243ULL
-#define WT_CONF_ID_prealloc_init_count 244ULL
-#define WT_CONF_ID_prefix 79ULL
-#define WT_CONF_ID_prefix_compression 42ULL
-#define WT_CONF_ID_prefix_compression_min 43ULL
-#define WT_CONF_ID_prefix_search 92ULL
-#define WT_CONF_ID_prepare_timestamp 162ULL
-#define WT_CONF_ID_prepared 160ULL
-#define WT_CONF_ID_priority 158ULL
-#define WT_CONF_ID_quota 254ULL
-#define WT_CONF_ID_raw 137ULL
-#define WT_CONF_ID_read 161ULL
-#define WT_CONF_ID_read_corrupt 151ULL
-#define WT_CONF_ID_read_once 138ULL
+#define WT_CONF_ID_early_load 277ULL
+#define WT_CONF_ID_enabled 39ULL
+#define WT_CONF_ID_entry 278ULL
+#define WT_CONF_ID_error_prefix 227ULL
+#define WT_CONF_ID_events 304ULL
+#define WT_CONF_ID_evict_sample_inmem 232ULL
+#define WT_CONF_ID_eviction 217ULL
+#define WT_CONF_ID_eviction_checkpoint_target 236ULL
+#define WT_CONF_ID_eviction_dirty_target 237ULL
+#define WT_CONF_ID_eviction_dirty_trigger 238ULL
+#define WT_CONF_ID_eviction_target 239ULL
+#define WT_CONF_ID_eviction_trace 176ULL
+#define WT_CONF_ID_eviction_trigger 240ULL
+#define WT_CONF_ID_eviction_updates_target 241ULL
+#define WT_CONF_ID_eviction_updates_trigger 242ULL
+#define WT_CONF_ID_exclude 102ULL
+#define WT_CONF_ID_exclusive 107ULL
+#define WT_CONF_ID_exclusive_refreshed 99ULL
+#define WT_CONF_ID_extensions 305ULL
+#define WT_CONF_ID_extra_diagnostics 243ULL
+#define WT_CONF_ID_extractor 66ULL
+#define WT_CONF_ID_file 133ULL
+#define WT_CONF_ID_file_extend 306ULL
+#define WT_CONF_ID_file_max 250ULL
+#define WT_CONF_ID_file_metadata 111ULL
+#define WT_CONF_ID_final_flush 171ULL
+#define WT_CONF_ID_flush_time 88ULL
+#define WT_CONF_ID_flush_timestamp 89ULL
+#define WT_CONF_ID_flushed_data_cache_insertion 295ULL
+#define WT_CONF_ID_force 114ULL
+#define WT_CONF_ID_force_stop 134ULL
+#define WT_CONF_ID_force_write_wait 316ULL
+#define WT_CONF_ID_format 24ULL
+#define WT_CONF_ID_free_space_target 103ULL
+#define WT_CONF_ID_full_target 185ULL
+#define WT_CONF_ID_generation_drain_timeout_ms 248ULL
+#define WT_CONF_ID_get 146ULL
+#define WT_CONF_ID_granularity 135ULL
+#define WT_CONF_ID_handles 177ULL
+#define WT_CONF_ID_hashsize 187ULL
+#define WT_CONF_ID_hazard_max 310ULL
+#define WT_CONF_ID_huffman_key 25ULL
+#define WT_CONF_ID_huffman_value 26ULL
+#define WT_CONF_ID_hugepages 290ULL
+#define WT_CONF_ID_id 62ULL
+#define WT_CONF_ID_ignore_cache_size 283ULL
+#define WT_CONF_ID_ignore_in_memory_cache_size 27ULL
+#define WT_CONF_ID_ignore_prepare 158ULL
+#define WT_CONF_ID_immutable 67ULL
+#define WT_CONF_ID_in_memory 311ULL
+#define WT_CONF_ID_inclusive 98ULL
+#define WT_CONF_ID_index_key_columns 68ULL
+#define WT_CONF_ID_internal_item_max 28ULL
+#define WT_CONF_ID_internal_key_max 29ULL
+#define WT_CONF_ID_internal_key_truncate 30ULL
+#define WT_CONF_ID_internal_page_max 31ULL
+#define WT_CONF_ID_interval 327ULL
+#define WT_CONF_ID_io_buffer_pool_max 312ULL
+#define WT_CONF_ID_isolation 159ULL
+#define WT_CONF_ID_json 271ULL
+#define WT_CONF_ID_json_output 254ULL
+#define WT_CONF_ID_key_format 32ULL
+#define WT_CONF_ID_key_gap 33ULL
+#define WT_CONF_ID_keyid 23ULL
+#define WT_CONF_ID_last 70ULL
+#define WT_CONF_ID_leaf_item_max 34ULL
+#define WT_CONF_ID_leaf_key_max 35ULL
+#define WT_CONF_ID_leaf_page_max 36ULL
+#define WT_CONF_ID_leaf_value_max 37ULL
+#define WT_CONF_ID_leak_memory 172ULL
+#define WT_CONF_ID_local_retention 54ULL
+#define WT_CONF_ID_lock_wait 115ULL
+#define WT_CONF_ID_log 178ULL
+#define WT_CONF_ID_log_retention 218ULL
+#define WT_CONF_ID_log_size 202ULL
+#define WT_CONF_ID_max_percent_overhead 188ULL
+#define WT_CONF_ID_memory_page_image_max 40ULL
+#define WT_CONF_ID_memory_page_max 41ULL
+#define WT_CONF_ID_merge 263ULL
+#define WT_CONF_ID_merge_max 85ULL
+#define WT_CONF_ID_merge_min 86ULL
+#define WT_CONF_ID_metadata_file 112ULL
+#define WT_CONF_ID_method 205ULL
+#define WT_CONF_ID_min_length 199ULL
+#define WT_CONF_ID_mmap 318ULL
+#define WT_CONF_ID_mmap_all 319ULL
+#define WT_CONF_ID_multiprocess 320ULL
+#define WT_CONF_ID_name 22ULL
+#define WT_CONF_ID_next_random 138ULL
+#define WT_CONF_ID_next_random_sample_size 139ULL
+#define WT_CONF_ID_next_random_seed 140ULL
+#define WT_CONF_ID_no_timestamp 160ULL
+#define WT_CONF_ID_nvram_path 189ULL
+#define WT_CONF_ID_object_target_size 55ULL
+#define WT_CONF_ID_old_chunks 87ULL
+#define WT_CONF_ID_oldest 91ULL
+#define WT_CONF_ID_oldest_timestamp 285ULL
+#define WT_CONF_ID_on_close 272ULL
+#define WT_CONF_ID_operation 121ULL
+#define WT_CONF_ID_operation_timeout_ms 161ULL
+#define WT_CONF_ID_os_cache_dirty_max 42ULL
+#define WT_CONF_ID_os_cache_dirty_pct 256ULL
+#define WT_CONF_ID_os_cache_max 43ULL
+#define WT_CONF_ID_overwrite 94ULL
+#define WT_CONF_ID_pacing_horizon_ms 233ULL
+#define WT_CONF_ID_path 265ULL
+#define WT_CONF_ID_percent_file_in_dram 190ULL
+#define WT_CONF_ID_pinned 207ULL
+#define WT_CONF_ID_policy 234ULL
+#define WT_CONF_ID_prealloc 257ULL
+#define WT_CONF_ID_prealloc_init_count 258ULL
+#define WT_CONF_ID_prefix 82ULL
+#define WT_CONF_ID_prefix_compression 44ULL
+#define WT_CONF_ID_prefix_compression_min 45ULL
+#define WT_CONF_ID_prefix_search 95ULL
+#define WT_CONF_ID_prepare_timestamp 166ULL
+#define WT_CONF_ID_prepared 164ULL
+#define WT_CONF_ID_priority 162ULL
+#define WT_CONF_ID_queue_depth 314ULL
+#define WT_CONF_ID_quota 268ULL
+#define WT_CONF_ID_raw 141ULL
+#define WT_CONF_ID_read 165ULL
+#define WT_CONF_ID_read_corrupt 155ULL
+#define WT_CONF_ID_read_once 142ULL
 #define WT_CONF_ID_read_timestamp 4ULL
-#define WT_CONF_ID_readonly 60ULL
-#define WT_CONF_ID_realloc_exact 209ULL
-#define WT_CONF_ID_realloc_malloc 210ULL
-#define WT_CONF_ID_recover 297ULL
-#define WT_CONF_ID_release 199ULL
-#define WT_CONF_ID_release_evict 125ULL
-#define WT_CONF_ID_release_evict_page 268ULL
-#define WT_CONF_ID_remove 245ULL
-#define WT_CONF_ID_remove_files 112ULL
-#define WT_CONF_ID_remove_shared 113ULL
-#define WT_CONF_ID_repair 106ULL
-#define WT_CONF_ID_require_max 281ULL
-#define WT_CONF_ID_require_min 282ULL
-#define WT_CONF_ID_reserve 255ULL
-#define WT_CONF_ID_rollback_error 211ULL
-#define WT_CONF_ID_run_once 101ULL
-#define WT_CONF_ID_salvage 303ULL
-#define WT_CONF_ID_secretkey 287ULL
-#define WT_CONF_ID_session_max 304ULL
-#define WT_CONF_ID_session_scratch_max 305ULL
-#define WT_CONF_ID_session_table_cache 306ULL
-#define WT_CONF_ID_sessions 174ULL
-#define WT_CONF_ID_shared 54ULL
-#define WT_CONF_ID_size 181ULL
-#define WT_CONF_ID_skip_sort_check 139ULL
-#define WT_CONF_ID_slow_checkpoint 212ULL
+#define WT_CONF_ID_readonly 63ULL
+#define WT_CONF_ID_realloc_exact 219ULL
+#define WT_CONF_ID_realloc_malloc 220ULL
+#define WT_CONF_ID_recover 317ULL
+#define WT_CONF_ID_release 209ULL
+#define WT_CONF_ID_release_evict 129ULL
+#define WT_CONF_ID_release_evict_page 282ULL
+#define WT_CONF_ID_remove 259ULL
+#define WT_CONF_ID_remove_files 116ULL
+#define WT_CONF_ID_remove_shared 117ULL
+#define WT_CONF_ID_repair 110ULL
+#define WT_CONF_ID_require_max 296ULL
+#define WT_CONF_ID_require_min 297ULL
+#define WT_CONF_ID_reserve 269ULL
+#define WT_CONF_ID_rollback_error 221ULL
+#define WT_CONF_ID_run_once 104ULL
+#define WT_CONF_ID_salvage 323ULL
+#define WT_CONF_ID_secretkey 302ULL
+#define WT_CONF_ID_session_max 324ULL
+#define WT_CONF_ID_session_scratch_max 325ULL
+#define WT_CONF_ID_session_table_cache 326ULL
+#define WT_CONF_ID_sessions 179ULL
+#define WT_CONF_ID_shared 56ULL
+#define WT_CONF_ID_size 186ULL
+#define WT_CONF_ID_skip_sort_check 143ULL
+#define WT_CONF_ID_slow_checkpoint 222ULL
 #define WT_CONF_ID_source 8ULL
-#define WT_CONF_ID_sources 259ULL
-#define WT_CONF_ID_split_deepen_min_child 44ULL
-#define WT_CONF_ID_split_deepen_per_child 45ULL
-#define WT_CONF_ID_split_pct 46ULL
-#define WT_CONF_ID_src_id 132ULL
-#define WT_CONF_ID_stable_timestamp 152ULL
-#define WT_CONF_ID_start_generation 80ULL
-#define WT_CONF_ID_statistics 140ULL
-#define WT_CONF_ID_storage_path 279ULL
-#define WT_CONF_ID_strategy 118ULL
-#define WT_CONF_ID_stress_skiplist 213ULL
-#define WT_CONF_ID_strict 153ULL
-#define WT_CONF_ID_suffix 81ULL
-#define WT_CONF_ID_sync 119ULL
-#define WT_CONF_ID_system_ram 186ULL
-#define WT_CONF_ID_table_logging 214ULL
-#define WT_CONF_ID_target 141ULL
-#define WT_CONF_ID_terminate 265ULL
-#define WT_CONF_ID_this_id 133ULL
-#define WT_CONF_ID_threads 272ULL
-#define WT_CONF_ID_threads_max 219ULL
-#define WT_CONF_ID_threads_min 220ULL
-#define WT_CONF_ID_tiered_flush_error_continue 215ULL
-#define WT_CONF_ID_tiered_object 61ULL
-#define WT_CONF_ID_tiers 89ULL
-#define WT_CONF_ID_timeout 102ULL
-#define WT_CONF_ID_timestamp 260ULL
-#define WT_CONF_ID_timing_stress_for_test 261ULL
-#define WT_CONF_ID_total 238ULL
-#define WT_CONF_ID_txn 175ULL
+#define WT_CONF_ID_sources 273ULL
+#define WT_CONF_ID_split_deepen_min_child 46ULL
+#define WT_CONF_ID_split_deepen_per_child 47ULL
+#define WT_CONF_ID_split_pct 48ULL
+#define WT_CONF_ID_src_id 136ULL
+#define WT_CONF_ID_stable_timestamp 156ULL
+#define WT_CONF_ID_start_generation 83ULL
+#define WT_CONF_ID_statistics 144ULL
+#define WT_CONF_ID_storage_path 294ULL
+#define WT_CONF_ID_strategy 122ULL
+#define WT_CONF_ID_stress_skiplist 223ULL
+#define WT_CONF_ID_strict 157ULL
+#define WT_CONF_ID_suffix 84ULL
+#define WT_CONF_ID_sync 123ULL
+#define WT_CONF_ID_system_ram 191ULL
+#define WT_CONF_ID_table_logging 224ULL
+#define WT_CONF_ID_target 145ULL
+#define WT_CONF_ID_terminate 279ULL
+#define WT_CONF_ID_this_id 137ULL
+#define WT_CONF_ID_threads 105ULL
+#define WT_CONF_ID_threads_max 230ULL
+#define WT_CONF_ID_threads_min 231ULL
+#define WT_CONF_ID_tiered_flush_error_continue 225ULL
+#define WT_CONF_ID_tiered_object 64ULL
+#define WT_CONF_ID_tiers 92ULL
+#define WT_CONF_ID_timeout 106ULL
+#define WT_CONF_ID_timestamp 274ULL
+#define WT_CONF_ID_timing_stress_for_test 275ULL
+#define WT_CONF_ID_total 252ULL
+#define WT_CONF_ID_tree_selection 235ULL
+#define WT_CONF_ID_txn 180ULL
 #define WT_CONF_ID_type 9ULL
-#define WT_CONF_ID_update_restore_evict 216ULL
-#define WT_CONF_ID_use_environment 309ULL
-#define WT_CONF_ID_use_environment_priv 310ULL
-#define WT_CONF_ID_use_timestamp 166ULL
-#define WT_CONF_ID_value_format 55ULL
+#define WT_CONF_ID_update_restore_evict 226ULL
+#define WT_CONF_ID_use_environment 329ULL
+#define WT_CONF_ID_use_environment_priv 330ULL
+#define WT_CONF_ID_use_timestamp 170ULL
+#define WT_CONF_ID_value_format 57ULL
 #define WT_CONF_ID_verbose 10ULL
-#define WT_CONF_ID_verify_metadata 311ULL
-#define WT_CONF_ID_version 62ULL
-#define WT_CONF_ID_wait 193ULL
-#define WT_CONF_ID_worker_thread_max 248ULL
-#define WT_CONF_ID_write_through 312ULL
+#define WT_CONF_ID_verify_metadata 331ULL
+#define WT_CONF_ID_version 65ULL
+#define WT_CONF_ID_victim_cache 192ULL
+#define WT_CONF_ID_wait 203ULL
+#define WT_CONF_ID_wait_ms 200ULL
+#define WT_CONF_ID_warm_restart 193ULL
+#define WT_CONF_ID_worker_thread_max 262ULL
+#define WT_CONF_ID_write_combine_max 58ULL
+#define WT_CONF_ID_write_through 332ULL
 #define WT_CONF_ID_write_timestamp 5ULL
 #define WT_CONF_ID_write_timestamp_usage 11ULL
-#define WT_CONF_ID_zero_fill 246ULL
+#define WT_CONF_ID_zero_fill 260ULL
 
-#define WT_CONF_ID_COUNT 313
+#define WT_CONF_ID_COUNT 333
 /*
  * API configuration keys: END
  */
@@ -361,7 +381,18 @@ static const struct {
         uint64_t size;
         uint64_t system_ram;
         uint64_t type;
+        uint64_t victim_cache;
+        uint64_t warm_restart;
     } Block_cache;
+    struct {
+        uint64_t enabled;
+        uint64_t hugepages;
+    } Cache_slab;
+    struct {
+        uint64_t enabled;
+        uint64_t min_length;
+        uint64_t wait_ms;
+    } Chain_trim;
     struct {
         uint64_t log_size;
         uint64_t wait;
@@ -378,6 +409,7 @@ static const struct {
         uint64_t flushed_data_cache_insertion;
         uint64_t hashsize;
         uint64_t pinned;
+        uint64_t policy;
         uint64_t storage_path;
         uint64_t type;
     } Chunk_cache;
@@ -414,10 +446,18 @@ static const struct {
         uint64_t secretkey;
     } Encryption;
     struct {
+        uint64_t app_wait_ms;
         uint64_t evict_sample_inmem;
+        uint64_t pacing_horizon_ms;
+        uint64_t policy;
         uint64_t threads_max;
         uint64_t threads_min;
+        uint64_t tree_selection;
     } Eviction;
+    struct {
+        uint64_t enabled;
+        uint64_t events;
+    } Eviction_trace;
     struct {
         uint64_t close_handle_minimum;
         uint64_t close_idle_time;
@@ -456,6 +496,10 @@ static const struct {
         uint64_t chunk_cache;
         uint64_t total;
     } Io_capacity;
+    struct {
+        uint64_t enabled;
+        uint64_t queue_depth;
+    } Io_uring;
     struct {
         uint64_t archive;
         uint64_t compressor;
@@ -555,8 +599,10 @@ static const struct {
     uint64_t cache;
     uint64_t cache_cursors;
     uint64_t cache_directory;
+    uint64_t cache_max;
     uint64_t cache_max_wait_ms;
     uint64_t cache_overhead;
+    uint64_t cache_reserve;
     uint64_t cache_resident;
     uint64_t cache_size;
     uint64_t cache_stuck_timeout_ms;
@@ -600,6 +646,7 @@ static const struct {
     uint64_t eviction_dirty_target;
     uint64_t eviction_dirty_trigger;
     uint64_t eviction_target;
+    uint64_t eviction_trace;
     uint64_t eviction_trigger;
     uint64_t eviction_updates_target;
     uint64_t eviction_updates_trigger;
@@ -634,6 +681,7 @@ static const struct {
     uint64_t internal_key_max;
     uint64_t internal_key_truncate;
     uint64_t internal_page_max;
+    uint64_t io_buffer_pool_max;
     uint64_t isolation;
     uint64_t json_output;
     uint64_t key_format;
@@ -708,6 +756,7 @@ static const struct {
     uint64_t verbose;
     uint64_t verify_metadata;
     uint64_t version;
+    uint64_t write_combine_max;
     uint64_t write_through;
     uint64_t write_timestamp_usage;
 } WT_CONF_ID_STRUCTURE = {
@@ -730,6 +779,17 @@ static const struct {
     WT_CONF_ID_Block_cache | (WT_CONF_ID_size << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_system_ram << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_type << 16),
+    WT_CONF_ID_Block_cache | (WT_CONF_ID_victim_cache << 16),
+    WT_CONF_ID_Block_cache | (WT_CONF_ID_warm_restart << 16),
+  },
+  {
+    WT_CONF_ID_Cache_slab | (WT_CONF_ID_enabled << 16),
+    WT_CONF_ID_Cache_slab | (WT_CONF_ID_hugepages << 16),
+  },
+  {
+    WT_CONF_ID_Chain_trim | (WT_CONF_ID_enabled << 16),
+    WT_CONF_ID_Chain_trim | (WT_CONF_ID_min_length << 16),
+    WT_CONF_ID_Chain_trim | (WT_CONF_ID_wait_ms << 16),
   },
   {
     WT_CONF_ID_Checkpoint | (WT_CONF_ID_log_size << 16),
@@ -747,6 +807,7 @@ static const struct {
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_flushed_data_cache_insertion << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_hashsize << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_pinned << 16),
+    WT_CONF_ID_Chunk_cache | (WT_CONF_ID_policy << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_storage_path << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_type << 16),
   },
@@ -783,9 +844,17 @@ static const struct {
     WT_CONF_ID_Encryption | (WT_CONF_ID_secretkey << 16),
   },
   {
+    WT_CONF_ID_Eviction | (WT_CONF_ID_app_wait_ms << 16),
     WT_CONF_ID_Eviction | (WT_CONF_ID_evict_sample_inmem << 16),
+    WT_CONF_ID_Eviction | (WT_CONF_ID_pacing_horizon_ms << 16),
+    WT_CONF_ID_Eviction | (WT_CONF_ID_policy << 16),
     WT_CONF_ID_Eviction | (WT_CONF_ID_threads_max << 16),
     WT_CONF_ID_Eviction | (WT_CONF_ID_threads_min << 16),
+    WT_CONF_ID_Eviction | (WT_CONF_ID_tree_selection << 16),
+  },
+  {
+    WT_CONF_ID_Eviction_trace | (WT_CONF_ID_enabled << 16),
+    WT_CONF_ID_Eviction_trace | (WT_CONF_ID_events << 16),
   },
   {
     WT_CONF_ID_File_manager | (WT_CONF_ID_close_handle_minimum << 16),
@@ -825,6 +894,10 @@ static const struct {
     WT_CONF_ID_Io_capacity | (WT_CONF_ID_chunk_cache << 16),
     WT_CONF_ID_Io_capacity | (WT_CONF_ID_total << 16),
   },
+  {
+    WT_CONF_ID_Io_uring | (WT_CONF_ID_enabled << 16),
+    WT_CONF_ID_Io_uring | (WT_CONF_ID_queue_depth << 16),
+  },
   {
     WT_CONF_ID_Log | (WT_CONF_ID_archive << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_compressor << 16),
@@ -924,8 +997,10 @@ static const struct {
   WT_CONF_ID_cache,
   WT_CONF_ID_cache_cursors,
   WT_CONF_ID_cache_directory,
+  WT_CONF_ID_cache_max,
   WT_CONF_ID_cache_max_wait_ms,
   WT_CONF_ID_cache_overhead,
+  WT_CONF_ID_cache_reserve,
   WT_CONF_ID_cache_resident,
   WT_CONF_ID_cache_size,
   WT_CONF_ID_cache_stuck_timeout_ms,
@@ -969,6 +1044,7 @@ static const struct {
   WT_CONF_ID_eviction_dirty_target,
   WT_CONF_ID_eviction_dirty_trigger,
   WT_CONF_ID_eviction_target,
+  WT_CONF_ID_eviction_trace,
   WT_CONF_ID_eviction_trigger,
   WT_CONF_ID_eviction_updates_target,
   WT_CONF_ID_eviction_updates_trigger,
@@ -1003,6 +1079,7 @@ static const struct {
   WT_CONF_ID_internal_key_max,
   WT_CONF_ID_internal_key_truncate,
   WT_CONF_ID_internal_page_max,
+  WT_CONF_ID_io_buffer_pool_max,
   WT_CONF_ID_isolation,
   WT_CONF_ID_json_output,
   WT_CONF_ID_key_format,
@@ -1077,6 +1154,7 @@ static const struct {
   WT_CONF_ID_verbose,
   WT_CONF_ID_verify_metadata,
   WT_CONF_ID_version,
+    WT_CONF_ID_write_combine_max,
   WT_CONF_ID_write_through,
   WT_CONF_ID_write_timestamp_usage,
 };
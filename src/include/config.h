@@ -278,6 +278,7 @@ extern const char __WT_CONFIG_CHOICE_recovery[];
 extern const char __WT_CONFIG_CHOICE_recovery_progress[];
 extern const char __WT_CONFIG_CHOICE_rts[];
 extern const char __WT_CONFIG_CHOICE_salvage[];
+extern const char __WT_CONFIG_CHOICE_segregated[];
 extern const char __WT_CONFIG_CHOICE_sequential[];
 extern const char __WT_CONFIG_CHOICE_set[];
 extern const char __WT_CONFIG_CHOICE_shared_cache[];
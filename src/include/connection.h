@@ -81,6 +81,17 @@ struct __wt_background_compact_exclude {
     TAILQ_ENTRY(__wt_background_compact_exclude) hashq; /* internal hash queue */
 };
 
+/*
+ * WT_BACKGROUND_COMPACT_WORK --
+ *	A file queued by the background compaction server for a worker thread.
+ */
+struct __wt_background_compact_work {
+    const char *uri;    /* File URI */
+    const char *config; /* Compact configuration */
+
+    TAILQ_ENTRY(__wt_background_compact_work) q; /* Worker queue */
+};
+
 /*
  * WT_BACKGROUND_COMPACT --
  *	Structure dedicated to the background compaction server
@@ -88,7 +99,7 @@ struct __wt_background_compact_exclude {
 struct __wt_background_compact {
     wt_shared bool running;   /* Compaction supposed to run */
     bool run_once;            /* Background compaction is executed once */
-    bool signalled;           /* Compact signalled */
+    wt_shared bool signalled; /* Compact signalled */
     bool tid_set;             /* Thread set */
     wt_thread_t tid;          /* Thread */
     const char *config;       /* Configuration */
@@ -96,6 +107,16 @@ struct __wt_background_compact {
     WT_SPINLOCK lock;         /* Compact lock */
     WT_SESSION_IMPL *session; /* Thread session */
 
+    /*
+     * When configured with more than one thread, the server queues files for a group of worker
+     * threads that compact them in parallel.
+     */
+    WT_THREAD_GROUP workers;        /* Worker threads */
+    uint32_t workers_max;           /* Configured worker threads */
+    wt_shared uint32_t work_active; /* Files being compacted by workers */
+    uint32_t work_queued;           /* Files waiting in the worker queue */
+    TAILQ_HEAD(__wt_background_compact_workqh, __wt_background_compact_work) workqh;
+
     uint64_t files_skipped;       /* Number of times background server has skipped a file */
     uint64_t files_compacted;     /* Number of times background server has compacted a file */
     uint64_t file_count;          /* Number of files in the tracking list */
@@ -112,6 +133,23 @@ struct __wt_background_compact {
       exclude_list_hash;
 };
 
+/*
+ * WT_BUFPOOL --
+ *	A connection-wide pool of aligned buffers for block I/O. Free buffers are kept in power-of-two
+ * size classes, linked through their first bytes.
+ */
+#define WT_BUFPOOL_CLASS_MIN 12 /* Smallest size class, 4KB */
+#define WT_BUFPOOL_CLASSES 13   /* Size classes, 4KB to 16MB */
+#define WT_BUFPOOL_CLASS_SIZE(i) ((size_t)1 << ((i) + WT_BUFPOOL_CLASS_MIN))
+struct __wt_bufpool {
+    WT_SPINLOCK lock; /* Free list lock */
+
+    size_t max;             /* Maximum bytes cached */
+    wt_shared size_t bytes; /* Bytes cached */
+
+    void *free[WT_BUFPOOL_CLASSES]; /* Free lists by size class */
+};
+
 /*
  * WT_BUCKET_STORAGE --
  *	A list entry for a storage source with a unique name (bucket, prefix).
@@ -264,6 +302,7 @@ struct __wt_name_flag {
         TAILQ_REMOVE(&(conn)->dhhash[bucket], dhandle, hashq);                                   \
         --(conn)->dh_bucket_count[bucket];                                                       \
         --(conn)->dhandle_count;                                                                 \
+        ++(conn)->dhandle_remove_gen;                                                            \
     } while (0)
 
 /*
@@ -425,12 +464,14 @@ struct __wt_connection_impl {
     TAILQ_HEAD(__wt_block_qh, __wt_block) blockqh;
 
     WT_BLKCACHE blkcache;             /* Block cache */
+    WT_BUFPOOL bufpool;               /* Aligned I/O buffer pool */
     WT_CHECKPOINT_CLEANUP cc_cleanup; /* Checkpoint cleanup */
     WT_CHUNKCACHE chunkcache;         /* Chunk cache */
 
     /* Locked: handles in each bucket */
     uint64_t *dh_bucket_count;
     uint64_t dhandle_count;                  /* Locked: handles in the queue */
+    uint64_t dhandle_remove_gen;             /* Locked: handles removed from the queue */
     wt_shared u_int open_btree_count;        /* Locked: open writable btree count */
     uint32_t next_file_id;                   /* Locked: file ID counter */
     wt_shared uint32_t open_file_count;      /* Atomic: open file handle count */
@@ -559,6 +600,13 @@ struct __wt_connection_impl {
     bool capacity_tid_set;             /* Capacity thread set */
     WT_CONDVAR *capacity_cond;         /* Capacity wait mutex */
 
+    WT_SESSION_IMPL *chain_trim_session;      /* Update chain trim thread session */
+    wt_thread_t chain_trim_tid;               /* Update chain trim thread */
+    bool chain_trim_tid_set;                  /* Update chain trim thread set */
+    WT_CONDVAR *chain_trim_cond;              /* Update chain trim wait mutex */
+    uint64_t chain_trim_wait;                 /* Update chain trim interval (usecs) */
+    wt_shared uint32_t chain_trim_min_length; /* Update chain trim threshold, 0 if disabled */
+
     wt_shared WT_LSM_MANAGER lsm_manager; /* LSM worker thread information */
 
 #define WT_CONN_TIERED_STORAGE_ENABLED(conn) ((conn)->bstorage != NULL)
@@ -585,6 +633,12 @@ struct __wt_connection_impl {
     bool prefetch_auto_on;
     bool prefetch_available;
 
+    /*
+     * Batched reads: the maximum number of reads submitted to io_uring at once, zero if batched
+     * reads are not configured (or io_uring isn't available).
+     */
+    wt_shared uint32_t io_uring_depth;
+
 #define WT_STATLOG_FILENAME "WiredTigerStat.%d.%H"
     WT_SESSION_IMPL *stat_session; /* Statistics log session */
     wt_thread_t stat_tid;          /* Statistics log thread */
@@ -826,15 +880,16 @@ struct __wt_connection_impl {
  */
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CONN_SERVER_CAPACITY 0x001u
-#define WT_CONN_SERVER_CHECKPOINT 0x002u
-#define WT_CONN_SERVER_CHECKPOINT_CLEANUP 0x004u
-#define WT_CONN_SERVER_CHUNKCACHE_METADATA 0x008u
-#define WT_CONN_SERVER_COMPACT 0x010u
-#define WT_CONN_SERVER_LOG 0x020u
-#define WT_CONN_SERVER_LSM 0x040u
-#define WT_CONN_SERVER_STATISTICS 0x080u
-#define WT_CONN_SERVER_SWEEP 0x100u
-#define WT_CONN_SERVER_TIERED 0x200u
+#define WT_CONN_SERVER_CHAIN_TRIM 0x002u
+#define WT_CONN_SERVER_CHECKPOINT 0x004u
+#define WT_CONN_SERVER_CHECKPOINT_CLEANUP 0x008u
+#define WT_CONN_SERVER_CHUNKCACHE_METADATA 0x010u
+#define WT_CONN_SERVER_COMPACT 0x020u
+#define WT_CONN_SERVER_LOG 0x040u
+#define WT_CONN_SERVER_LSM 0x080u
+#define WT_CONN_SERVER_STATISTICS 0x100u
+#define WT_CONN_SERVER_SWEEP 0x200u
+#define WT_CONN_SERVER_TIERED 0x400u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t server_flags;
 
@@ -494,6 +494,15 @@ struct __wt_cursor_json {
     WT_CONFIG_ITEM value_names; /* Names of value columns */
 };
 
+struct __wt_cursor_evict_trace {
+    WT_CURSOR iface;
+
+    WT_EVICT_TRACE_EVENT *events; /* Copy of the eviction trace */
+    uint32_t entries;             /* Events in the copy */
+    uint32_t next;                /* Position of the next event */
+    bool loaded;                  /* Events copied */
+};
+
 struct __wt_cursor_log {
     WT_CURSOR iface;
 
@@ -16,6 +16,9 @@
 
 #define WT_USERCONFIG "WiredTiger.config" /* User configuration */
 
+#define WT_BLKCACHE_MANIFEST "WiredTiger.blkcache"         /* Block cache warm restart */
+#define WT_BLKCACHE_MANIFEST_SET "WiredTiger.blkcache.set" /* Block cache manifest temp */
+
 /*
  * Backup related WiredTiger files.
  */
@@ -154,6 +154,39 @@ struct __wt_file_handle_posix {
 };
 #endif
 
+/*
+ * WT_IO_REQ --
+ *	A single read in a batch of file reads.
+ */
+struct __wt_io_req {
+    wt_off_t offset; /* File offset */
+    size_t len;      /* Read length */
+    void *buf;       /* Destination buffer */
+    int error;       /* Read result */
+};
+
+/*
+ * WT_IO_URING --
+ *	A per-session io_uring submission/completion ring pair, used for batched reads.
+ */
+struct __wt_io_uring {
+    int fd;           /* Ring file descriptor */
+    uint32_t entries; /* Submission queue entries */
+
+    void *sq_ring; /* Mapped submission ring */
+    size_t sq_ring_size;
+    void *cq_ring; /* Mapped completion ring */
+    size_t cq_ring_size;
+    void *sqes; /* Mapped submission queue entries */
+    size_t sqes_size;
+    void *cqes; /* Completion queue entries */
+
+    uint32_t *sq_head, *sq_tail, *sq_mask, *sq_array;
+    uint32_t *cq_head, *cq_tail, *cq_mask;
+
+    struct iovec *iov; /* Per-entry read vectors */
+};
+
 struct __wt_file_handle_inmem {
     WT_FILE_HANDLE iface;
 
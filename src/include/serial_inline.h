@@ -238,6 +238,29 @@ __wt_insert_serial(WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD *ins_
     return (0);
 }
 
+/*
+ * __update_chain_trim_track --
+ *     Count an update added to a page with a long update chain that couldn't be trimmed, so the
+ *     background update chain trim thread can find the page.
+ */
+static WT_INLINE void
+__update_chain_trim_track(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+    WT_BTREE *btree;
+    uint32_t len, min_length;
+
+    /* The count is approximate, racing updates can lose increments. */
+    if ((len = __wt_atomic_load32(&page->modify->obsolete_chain_len)) == 0)
+        return;
+    __wt_atomic_store32(&page->modify->obsolete_chain_len, ++len);
+
+    btree = S2BT(session);
+    min_length = __wt_atomic_load32(&S2C(session)->chain_trim_min_length);
+    if (min_length != 0 && len >= min_length &&
+      __wt_atomic_load32(&btree->chain_trim_len) < min_length)
+        __wt_atomic_store32(&btree->chain_trim_len, len);
+}
+
 /*
  * __wt_update_serial --
  *     Update a row or column-store entry.
@@ -318,8 +341,10 @@ __wt_update_serial(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_PAGE *page
             if (ret != 0)
                 WT_RET_PANIC(session, ret, "fail to update oldest after serializing the updates");
 
-            if (!__wt_txn_visible_all(session, txn, obsolete_timestamp))
+            if (!__wt_txn_visible_all(session, txn, obsolete_timestamp)) {
+                __update_chain_trim_track(session, page);
                 return (0);
+            }
         }
 
         page->modify->obsolete_check_txn = WT_TXN_NONE;
@@ -49,6 +49,17 @@ struct __wt_hazard_array {
     uint32_t size;                 /* Allocated size of the array */
 };
 
+/*
+ * WT_PREFETCH_STAGED --
+ *	A block image returned by a batched pre-fetch read, waiting to be read into the cache.
+ */
+struct __wt_prefetch_staged {
+    uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE]; /* Address cookie */
+    uint8_t addr_size;
+    WT_ITEM buf; /* Block image */
+    bool valid;  /* Block image is available */
+};
+
 /*
  * WT_PREFETCH --
  *	Pre-fetch structure containing useful information for pre-fetch.
@@ -57,6 +68,10 @@ struct __wt_prefetch {
     WT_PAGE *prefetch_prev_ref_home;
     uint64_t prefetch_disk_read_count; /* Sequential cache requests that caused a leaf read */
     uint64_t prefetch_skipped_with_parent;
+
+    WT_PREFETCH_STAGED *staged; /* Block images from a batched read */
+    size_t staged_allocated;
+    u_int staged_count;
 };
 
 /* Get the connection implementation for a session */
@@ -200,6 +215,7 @@ struct __wt_session_impl {
         uint64_t reentry_hs_evict_start;
         uint64_t reentry_hs_evict_finish;
         uint64_t evict_finish;
+        uint64_t hs_bytes;
         bool reentry_hs_eviction;
     } evict_timeline;
 
@@ -210,6 +226,8 @@ struct __wt_session_impl {
 
     WT_PREFETCH pf; /* Pre-fetch structure */
 
+    WT_IO_URING *io_uring; /* Batched read ring */
+
     void *block_manager; /* Block-manager support */
     int (*block_manager_cleanup)(WT_SESSION_IMPL *);
 
@@ -287,28 +305,29 @@ struct __wt_session_impl {
  */
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
-#define WT_SESSION_BACKUP_CURSOR 0x000001u
-#define WT_SESSION_BACKUP_DUP 0x000002u
-#define WT_SESSION_CACHE_CURSORS 0x000004u
-#define WT_SESSION_CAN_WAIT 0x000008u
-#define WT_SESSION_DEBUG_CHECKPOINT_FAIL_BEFORE_TURTLE_UPDATE 0x000010u
-#define WT_SESSION_DEBUG_DO_NOT_CLEAR_TXN_ID 0x000020u
-#define WT_SESSION_DEBUG_RELEASE_EVICT 0x000040u
-#define WT_SESSION_EVICTION 0x000080u
-#define WT_SESSION_IGNORE_CACHE_SIZE 0x000100u
-#define WT_SESSION_IMPORT 0x000200u
-#define WT_SESSION_IMPORT_REPAIR 0x000400u
-#define WT_SESSION_INTERNAL 0x000800u
-#define WT_SESSION_LOGGING_INMEM 0x001000u
-#define WT_SESSION_NO_DATA_HANDLES 0x002000u
-#define WT_SESSION_NO_RECONCILE 0x004000u
-#define WT_SESSION_PREFETCH_ENABLED 0x008000u
-#define WT_SESSION_PREFETCH_THREAD 0x010000u
-#define WT_SESSION_QUIET_CORRUPT_FILE 0x020000u
-#define WT_SESSION_READ_WONT_NEED 0x040000u
-#define WT_SESSION_RESOLVING_TXN 0x080000u
-#define WT_SESSION_ROLLBACK_TO_STABLE 0x100000u
-#define WT_SESSION_SCHEMA_TXN 0x200000u
+#define WT_SESSION_BACKGROUND_COMPACT 0x000001u
+#define WT_SESSION_BACKUP_CURSOR 0x000002u
+#define WT_SESSION_BACKUP_DUP 0x000004u
+#define WT_SESSION_CACHE_CURSORS 0x000008u
+#define WT_SESSION_CAN_WAIT 0x000010u
+#define WT_SESSION_DEBUG_CHECKPOINT_FAIL_BEFORE_TURTLE_UPDATE 0x000020u
+#define WT_SESSION_DEBUG_DO_NOT_CLEAR_TXN_ID 0x000040u
+#define WT_SESSION_DEBUG_RELEASE_EVICT 0x000080u
+#define WT_SESSION_EVICTION 0x000100u
+#define WT_SESSION_IGNORE_CACHE_SIZE 0x000200u
+#define WT_SESSION_IMPORT 0x000400u
+#define WT_SESSION_IMPORT_REPAIR 0x000800u
+#define WT_SESSION_INTERNAL 0x001000u
+#define WT_SESSION_LOGGING_INMEM 0x002000u
+#define WT_SESSION_NO_DATA_HANDLES 0x004000u
+#define WT_SESSION_NO_RECONCILE 0x008000u
+#define WT_SESSION_PREFETCH_ENABLED 0x010000u
+#define WT_SESSION_PREFETCH_THREAD 0x020000u
+#define WT_SESSION_QUIET_CORRUPT_FILE 0x040000u
+#define WT_SESSION_READ_WONT_NEED 0x080000u
+#define WT_SESSION_RESOLVING_TXN 0x100000u
+#define WT_SESSION_ROLLBACK_TO_STABLE 0x200000u
+#define WT_SESSION_SCHEMA_TXN 0x400000u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t flags;
 
@@ -434,6 +434,7 @@ struct __wt_connection_stats {
     int64_t background_compact_skipped;
     int64_t background_compact_success;
     int64_t background_compact_timeout;
+    int64_t background_compact_files_active;
     int64_t background_compact_files_tracked;
     int64_t backup_cursor_open;
     int64_t backup_dup_open;
@@ -448,15 +449,21 @@ struct __wt_connection_stats {
     int64_t block_cache_blocks_evicted;
     int64_t block_cache_bypass_filesize;
     int64_t block_cache_lookups;
+    int64_t block_cache_manifest_blocks;
+    int64_t block_cache_prewarm_blocks;
     int64_t block_cache_not_evicted_overhead;
+    int64_t block_cache_victim_retained;
     int64_t block_cache_bypass_writealloc;
     int64_t block_cache_bypass_overhead_put;
     int64_t block_cache_bypass_get;
     int64_t block_cache_bypass_put;
+    int64_t block_cache_victim_not_cached;
     int64_t block_cache_eviction_passes;
     int64_t block_cache_hits;
+    int64_t block_cache_victim_hits;
     int64_t block_cache_misses;
     int64_t block_cache_bypass_chkpt;
+    int64_t block_cache_prewarm_skipped;
     int64_t block_cache_blocks_removed;
     int64_t block_cache_blocks_removed_blocked;
     int64_t block_cache_blocks;
@@ -465,9 +472,18 @@ struct __wt_connection_stats {
     int64_t block_cache_bytes;
     int64_t block_cache_bytes_insert_read;
     int64_t block_cache_bytes_insert_write;
+    int64_t block_buffer_pool_miss;
+    int64_t block_buffer_pool_hit;
+    int64_t block_read_batch;
+    int64_t block_read_coalesce;
+    int64_t block_read_io_uring_submit;
     int64_t block_preload;
     int64_t block_read;
+    int64_t block_read_batch_blocks;
+    int64_t block_read_coalesce_blocks;
     int64_t block_write;
+    int64_t block_write_combine_blocks;
+    int64_t block_buffer_pool_bytes;
     int64_t block_byte_read;
     int64_t block_byte_read_mmap;
     int64_t block_byte_read_syscall;
@@ -476,11 +492,15 @@ struct __wt_connection_stats {
     int64_t block_byte_write_checkpoint;
     int64_t block_byte_write_mmap;
     int64_t block_byte_write_syscall;
+    int64_t block_write_combine;
+    int64_t block_extlist_merge_walk;
     int64_t block_map_read;
     int64_t block_byte_map_read;
     int64_t block_remap_file_resize;
     int64_t block_remap_file_write;
+    int64_t cache_eviction_app_wait_exhausted;
     int64_t cache_eviction_app_time;
+    int64_t cache_eviction_app_wait;
     int64_t cache_read_app_count;
     int64_t cache_read_app_time;
     int64_t cache_write_app_count;
@@ -490,7 +510,10 @@ struct __wt_connection_stats {
     int64_t cache_bytes_hs;
     int64_t cache_bytes_inuse;
     int64_t cache_bytes_dirty_total;
+    int64_t cache_slab_bytes_inuse;
+    int64_t cache_slab_bytes;
     int64_t cache_bytes_other;
+    int64_t cache_slab_bytes_requested;
     int64_t cache_bytes_read;
     int64_t cache_bytes_write;
     int64_t cache_eviction_blocked_checkpoint;
@@ -502,6 +525,7 @@ struct __wt_connection_stats {
     int64_t cache_eviction_get_ref;
     int64_t cache_eviction_get_ref_empty;
     int64_t cache_eviction_get_ref_empty2;
+    int64_t cache_eviction_get_ref_steal;
     int64_t cache_eviction_aggressive_set;
     int64_t cache_eviction_empty_score;
     int64_t cache_eviction_blocked_no_ts_checkpoint_race_1;
@@ -510,10 +534,17 @@ struct __wt_connection_stats {
     int64_t cache_eviction_blocked_no_ts_checkpoint_race_4;
     int64_t cache_eviction_blocked_remove_hs_race_with_checkpoint;
     int64_t cache_eviction_blocked_no_progress;
+    int64_t cache_eviction_pacing_inuse_rate;
+    int64_t cache_eviction_pacing_dirty_rate;
+    int64_t cache_eviction_pacing_inuse_predicted;
+    int64_t cache_eviction_pacing_dirty_predicted;
     int64_t cache_eviction_walk_passes;
+    int64_t cache_eviction_pacing_early;
     int64_t cache_eviction_queue_empty;
     int64_t cache_eviction_queue_not_empty;
+    int64_t cache_eviction_server_rank_trees;
     int64_t cache_eviction_server_skip_dirty_pages_during_checkpoint;
+    int64_t cache_eviction_server_skip_frequent_pages;
     int64_t cache_eviction_server_skip_intl_page_with_active_child;
     int64_t cache_eviction_server_skip_metatdata_with_history;
     int64_t cache_eviction_server_skip_pages_last_running;
@@ -523,9 +554,13 @@ struct __wt_connection_stats {
     int64_t cache_eviction_server_skip_trees_too_many_active_walks;
     int64_t cache_eviction_server_skip_checkpointing_trees;
     int64_t cache_eviction_server_skip_trees_stick_in_cache;
+    int64_t cache_eviction_server_skip_trees_reserved;
+    int64_t cache_eviction_server_skip_trees_under_quota;
     int64_t cache_eviction_server_skip_trees_eviction_disabled;
     int64_t cache_eviction_server_skip_trees_not_useful_before;
     int64_t cache_eviction_server_slept;
+    int64_t cache_eviction_server_rank_trees_skipped;
+    int64_t cache_eviction_server_rank_trees_ranked;
     int64_t cache_eviction_slow;
     int64_t cache_eviction_walk_leaf_notfound;
     int64_t cache_eviction_state;
@@ -643,6 +678,8 @@ struct __wt_connection_stats {
     int64_t cache_eviction_blocked_recently_modified;
     int64_t cache_reverse_splits;
     int64_t cache_reverse_splits_skipped_vlcs;
+    int64_t cache_slab_allocated;
+    int64_t cache_slab_freed;
     int64_t cache_hs_insert_full_update;
     int64_t cache_hs_insert_reverse_modify;
     int64_t cache_reentry_hs_eviction_milliseconds;
@@ -652,6 +689,11 @@ struct __wt_connection_stats {
     int64_t cache_pages_dirty;
     int64_t cache_eviction_blocked_uncommitted_truncate;
     int64_t cache_eviction_clean;
+    int64_t cache_chain_trim_bytes;
+    int64_t cache_chain_trim_updates;
+    int64_t cache_chain_trim_pages;
+    int64_t cache_chain_trim_pages_visited;
+    int64_t cache_chain_trim_passes;
     int64_t fsync_all_fh_total;
     int64_t fsync_all_fh;
     int64_t fsync_all_time;
@@ -720,11 +762,16 @@ struct __wt_connection_stats {
     int64_t checkpoint_obsolete_applied;
     int64_t checkpoint_wait_reduce_dirty;
     int64_t chunkcache_spans_chunks_read;
+    int64_t chunkcache_tinylfu_admitted;
     int64_t chunkcache_chunks_evicted;
+    int64_t chunkcache_tinylfu_rejected;
     int64_t chunkcache_exceeded_bitmap_capacity;
     int64_t chunkcache_exceeded_capacity;
     int64_t chunkcache_lookups;
     int64_t chunkcache_chunks_loaded_from_flushed_tables;
+    int64_t chunkcache_hits_read;
+    int64_t chunkcache_hits_flushed;
+    int64_t chunkcache_hits_metadata;
     int64_t chunkcache_metadata_inserted;
     int64_t chunkcache_metadata_removed;
     int64_t chunkcache_metadata_work_units_dropped;
@@ -915,6 +962,13 @@ struct __wt_connection_stats {
     int64_t log_compress_len;
     int64_t log_slot_coalesced;
     int64_t log_close_yields;
+    int64_t perf_hist_evictapp_latency_lt100;
+    int64_t perf_hist_evictapp_latency_lt250;
+    int64_t perf_hist_evictapp_latency_lt500;
+    int64_t perf_hist_evictapp_latency_lt1000;
+    int64_t perf_hist_evictapp_latency_lt10000;
+    int64_t perf_hist_evictapp_latency_gt10000;
+    int64_t perf_hist_evictapp_latency_total_usecs;
     int64_t perf_hist_fsread_latency_lt10;
     int64_t perf_hist_fsread_latency_lt50;
     int64_t perf_hist_fsread_latency_lt100;
@@ -957,6 +1011,7 @@ struct __wt_connection_stats {
     int64_t prefetch_skipped_special_handle;
     int64_t prefetch_pages_fail;
     int64_t prefetch_pages_queued;
+    int64_t prefetch_pages_read_batch;
     int64_t prefetch_pages_read;
     int64_t prefetch_skipped_error_ok;
     int64_t prefetch_attempts;
@@ -1136,7 +1191,16 @@ struct __wt_dsrc_stats {
     int64_t autocommit_update_retry;
     int64_t backup_blocks_compressed;
     int64_t backup_blocks_uncompressed;
+    int64_t block_alloc_segregated_extend;
     int64_t block_extension;
+    int64_t block_avail_large_bytes;
+    int64_t block_avail_1mb_bytes;
+    int64_t block_avail_32kb_bytes;
+    int64_t block_avail_4kb_bytes;
+    int64_t block_avail_large;
+    int64_t block_avail_1mb;
+    int64_t block_avail_32kb;
+    int64_t block_avail_4kb;
     int64_t block_alloc;
     int64_t block_free;
     int64_t block_checkpoint_size;
@@ -1148,6 +1212,7 @@ struct __wt_dsrc_stats {
     int64_t block_minor;
     int64_t btree_checkpoint_generation;
     int64_t btree_clean_checkpoint_timer;
+    int64_t btree_compact_bytes_rewritten;
     int64_t btree_compact_pages_reviewed;
     int64_t btree_compact_pages_rewritten;
     int64_t btree_compact_pages_skipped;
@@ -1176,6 +1241,8 @@ struct __wt_dsrc_stats {
     int64_t cache_bytes_dirty_total;
     int64_t cache_bytes_read;
     int64_t cache_bytes_write;
+    int64_t cache_bytes_quota;
+    int64_t cache_bytes_reserve;
     int64_t cache_eviction_blocked_checkpoint;
     int64_t cache_eviction_blocked_checkpoint_hs;
     int64_t cache_eviction_fail;
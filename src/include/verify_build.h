@@ -31,6 +31,10 @@ static_assert(sizeof(WT_BLOCK_DESC) == WT_BLOCK_DESC_SIZE,
 static_assert(
   sizeof(WT_REF) == WT_REF_SIZE, "size of WT_REF did not match expected size WT_REF_SIZE");
 
+/* The cache slab header must fit in the granule before the slab's first chunk. */
+static_assert(
+  sizeof(WT_CACHE_SLAB) <= WT_CACHE_SLAB_GRANULE, "WT_CACHE_SLAB does not fit in a slab granule");
+
 /*
  * WT_UPDATE is special: we arrange fields to avoid padding within the structure but it could be
  * padded at the end depending on the timestamp size. Further check that the data field in the
@@ -75,12 +75,16 @@ struct __wt_background_compact_exclude;
 typedef struct __wt_background_compact_exclude WT_BACKGROUND_COMPACT_EXCLUDE;
 struct __wt_background_compact_stat;
 typedef struct __wt_background_compact_stat WT_BACKGROUND_COMPACT_STAT;
+struct __wt_background_compact_work;
+typedef struct __wt_background_compact_work WT_BACKGROUND_COMPACT_WORK;
 struct __wt_backup_target;
 typedef struct __wt_backup_target WT_BACKUP_TARGET;
 struct __wt_blkcache;
 typedef struct __wt_blkcache WT_BLKCACHE;
 struct __wt_blkcache_item;
 typedef struct __wt_blkcache_item WT_BLKCACHE_ITEM;
+struct __wt_blkcache_manifest_entry;
+typedef struct __wt_blkcache_manifest_entry WT_BLKCACHE_MANIFEST_ENTRY;
 struct __wt_blkincr;
 typedef struct __wt_blkincr WT_BLKINCR;
 struct __wt_block;
@@ -93,6 +97,8 @@ struct __wt_block_header;
 typedef struct __wt_block_header WT_BLOCK_HEADER;
 struct __wt_block_mods;
 typedef struct __wt_block_mods WT_BLOCK_MODS;
+struct __wt_block_read_req;
+typedef struct __wt_block_read_req WT_BLOCK_READ_REQ;
 struct __wt_bloom;
 typedef struct __wt_bloom WT_BLOOM;
 struct __wt_bloom_hash;
@@ -103,10 +109,16 @@ struct __wt_btree;
 typedef struct __wt_btree WT_BTREE;
 struct __wt_bucket_storage;
 typedef struct __wt_bucket_storage WT_BUCKET_STORAGE;
+struct __wt_bufpool;
+typedef struct __wt_bufpool WT_BUFPOOL;
 struct __wt_cache;
 typedef struct __wt_cache WT_CACHE;
 struct __wt_cache_pool;
 typedef struct __wt_cache_pool WT_CACHE_POOL;
+struct __wt_cache_slab;
+typedef struct __wt_cache_slab WT_CACHE_SLAB;
+struct __wt_cache_slab_class;
+typedef struct __wt_cache_slab_class WT_CACHE_SLAB_CLASS;
 struct __wt_capacity;
 typedef struct __wt_capacity WT_CAPACITY;
 struct __wt_cell;
@@ -133,6 +145,8 @@ struct __wt_chunkcache_metadata_work_unit;
 typedef struct __wt_chunkcache_metadata_work_unit WT_CHUNKCACHE_METADATA_WORK_UNIT;
 struct __wt_chunkcache_pinned_list;
 typedef struct __wt_chunkcache_pinned_list WT_CHUNKCACHE_PINNED_LIST;
+struct __wt_chunkcache_sketch;
+typedef struct __wt_chunkcache_sketch WT_CHUNKCACHE_SKETCH;
 struct __wt_ckpt;
 typedef struct __wt_ckpt WT_CKPT;
 struct __wt_ckpt_snapshot;
@@ -189,6 +203,8 @@ struct __wt_cursor_data_source;
 typedef struct __wt_cursor_data_source WT_CURSOR_DATA_SOURCE;
 struct __wt_cursor_dump;
 typedef struct __wt_cursor_dump WT_CURSOR_DUMP;
+struct __wt_cursor_evict_trace;
+typedef struct __wt_cursor_evict_trace WT_CURSOR_EVICT_TRACE;
 struct __wt_cursor_hs;
 typedef struct __wt_cursor_hs WT_CURSOR_HS;
 struct __wt_cursor_index;
@@ -229,8 +245,14 @@ struct __wt_evict_entry;
 typedef struct __wt_evict_entry WT_EVICT_ENTRY;
 struct __wt_evict_queue;
 typedef struct __wt_evict_queue WT_EVICT_QUEUE;
+struct __wt_evict_shard;
+typedef struct __wt_evict_shard WT_EVICT_SHARD;
 struct __wt_evict_timeline;
 typedef struct __wt_evict_timeline WT_EVICT_TIMELINE;
+struct __wt_evict_trace_event;
+typedef struct __wt_evict_trace_event WT_EVICT_TRACE_EVENT;
+struct __wt_evict_tree;
+typedef struct __wt_evict_tree WT_EVICT_TREE;
 struct __wt_ext;
 typedef struct __wt_ext WT_EXT;
 struct __wt_extlist;
@@ -267,6 +289,10 @@ struct __wt_insert;
 typedef struct __wt_insert WT_INSERT;
 struct __wt_insert_head;
 typedef struct __wt_insert_head WT_INSERT_HEAD;
+struct __wt_io_req;
+typedef struct __wt_io_req WT_IO_REQ;
+struct __wt_io_uring;
+typedef struct __wt_io_uring WT_IO_URING;
 struct __wt_join_stats;
 typedef struct __wt_join_stats WT_JOIN_STATS;
 struct __wt_join_stats_group;
@@ -343,6 +369,8 @@ struct __wt_prefetch;
 typedef struct __wt_prefetch WT_PREFETCH;
 struct __wt_prefetch_queue_entry;
 typedef struct __wt_prefetch_queue_entry WT_PREFETCH_QUEUE_ENTRY;
+struct __wt_prefetch_staged;
+typedef struct __wt_prefetch_staged WT_PREFETCH_STAGED;
 struct __wt_process;
 typedef struct __wt_process WT_PROCESS;
 struct __wt_rec_chunk;
@@ -553,3 +553,42 @@ err:
     __wt_scr_free(session, &zerobuf);
     return (ret);
 }
+
+/*
+ * __wt_read_batch --
+ *     Read a batch of blocks from a file. Each request's result is returned in the request, the
+ *     function only fails if the batch couldn't be attempted at all.
+ */
+int
+__wt_read_batch(WT_SESSION_IMPL *session, WT_FH *fh, WT_IO_REQ *reqs, u_int nreqs)
+{
+    u_int i;
+
+    for (i = 0; i < nreqs; ++i)
+        reqs[i].error = ENOTSUP;
+
+#ifdef HAVE_LINUX_IO_URING_H
+    /* Try the asynchronous interface first, if it's configured and the handle supports it. */
+    WT_RET_ERROR_OK(__wt_posix_uring_read(session, fh, reqs, nreqs), ENOTSUP);
+#endif
+
+    /* Read anything the asynchronous interface didn't handle. */
+    for (i = 0; i < nreqs; ++i)
+        if (reqs[i].error == ENOTSUP)
+            reqs[i].error = __wt_read(session, fh, reqs[i].offset, reqs[i].len, reqs[i].buf);
+    return (0);
+}
+
+/*
+ * __wt_read_batch_discard --
+ *     Discard any resources a session has allocated for batched reads.
+ */
+void
+__wt_read_batch_discard(WT_SESSION_IMPL *session)
+{
+#ifdef HAVE_LINUX_IO_URING_H
+    __wt_posix_uring_discard(session);
+#else
+    WT_UNUSED(session);
+#endif
+}
@@ -1049,6 +1049,19 @@ __posix_terminate(WT_FILE_SYSTEM *file_system, WT_SESSION *wt_session)
     return (0);
 }
 
+/*
+ * __wti_posix_file_handle_fd --
+ *     Return the file descriptor underlying a POSIX file handle read with system calls.
+ */
+bool
+__wti_posix_file_handle_fd(WT_FILE_HANDLE *file_handle, int *fdp)
+{
+    if (file_handle->close != __posix_file_close || file_handle->fh_read != __posix_file_read)
+        return (false);
+    *fdp = ((WT_FILE_HANDLE_POSIX *)file_handle)->fd;
+    return (true);
+}
+
 /*
  * __wt_os_posix --
  *     Initialize a POSIX configuration.
@@ -0,0 +1,294 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+#if defined(HAVE_LINUX_IO_URING_H)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
+/*
+ * We don't depend on liburing: the ring is set up and driven with the raw system calls, which have
+ * been stable since Linux 5.1. The read-vector opcode is used rather than the simpler read opcode
+ * for the same reason.
+ */
+#if defined(HAVE_LINUX_IO_URING_H) && defined(SYS_io_uring_setup) && defined(SYS_io_uring_enter)
+#define WT_IO_URING_SUPPORTED 1
+
+/*
+ * __uring_enter --
+ *     Submit entries to the ring and/or wait for completions.
+ */
+static int
+__uring_enter(WT_IO_URING *ring, u_int to_submit, u_int min_complete, u_int *submittedp)
+{
+    WT_DECL_RET;
+    long r;
+
+    WT_SYSCALL_RETRY(
+      (r = syscall(SYS_io_uring_enter, ring->fd, to_submit, min_complete,
+         min_complete == 0 ? 0 : IORING_ENTER_GETEVENTS, NULL, 0)) < 0 ?
+        -1 :
+        0,
+      ret);
+    WT_RET(ret);
+
+    if (submittedp != NULL)
+        *submittedp = (u_int)r;
+    return (0);
+}
+
+/*
+ * __uring_destroy --
+ *     Unmap and close a ring.
+ */
+static void
+__uring_destroy(WT_SESSION_IMPL *session, WT_IO_URING *ring)
+{
+    if (ring->sqes != NULL)
+        (void)munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring != NULL && ring->cq_ring != ring->sq_ring)
+        (void)munmap(ring->cq_ring, ring->cq_ring_size);
+    if (ring->sq_ring != NULL)
+        (void)munmap(ring->sq_ring, ring->sq_ring_size);
+    if (ring->fd != -1)
+        (void)close(ring->fd);
+    __wt_free(session, ring->iov);
+    __wt_free(session, ring);
+}
+
+/*
+ * __uring_create --
+ *     Create a ring with the requested number of submission entries.
+ */
+static int
+__uring_create(WT_SESSION_IMPL *session, uint32_t entries, WT_IO_URING **ringp)
+{
+    struct io_uring_params p;
+    WT_DECL_RET;
+    WT_IO_URING *ring;
+    uint8_t *cq, *sq;
+
+    *ringp = NULL;
+
+    WT_RET(__wt_calloc_one(session, &ring));
+    ring->fd = -1;
+
+    memset(&p, 0, sizeof(p));
+    if ((ring->fd = (int)syscall(SYS_io_uring_setup, entries, &p)) < 0) {
+        ring->fd = -1;
+        WT_ERR(__wt_errno());
+    }
+    ring->entries = p.sq_entries;
+
+    ring->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(uint32_t);
+    ring->cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (FLD_ISSET(p.features, IORING_FEAT_SINGLE_MMAP))
+        ring->sq_ring_size = ring->cq_ring_size = WT_MAX(ring->sq_ring_size, ring->cq_ring_size);
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        ring->sq_ring = NULL;
+        WT_ERR(__wt_errno());
+    }
+    if (FLD_ISSET(p.features, IORING_FEAT_SINGLE_MMAP))
+        ring->cq_ring = ring->sq_ring;
+    else {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+          MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED) {
+            ring->cq_ring = NULL;
+            WT_ERR(__wt_errno());
+        }
+    }
+    ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+      ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        WT_ERR(__wt_errno());
+    }
+
+    sq = ring->sq_ring;
+    ring->sq_head = (uint32_t *)(sq + p.sq_off.head);
+    ring->sq_tail = (uint32_t *)(sq + p.sq_off.tail);
+    ring->sq_mask = (uint32_t *)(sq + p.sq_off.ring_mask);
+    ring->sq_array = (uint32_t *)(sq + p.sq_off.array);
+    cq = ring->cq_ring;
+    ring->cq_head = (uint32_t *)(cq + p.cq_off.head);
+    ring->cq_tail = (uint32_t *)(cq + p.cq_off.tail);
+    ring->cq_mask = (uint32_t *)(cq + p.cq_off.ring_mask);
+    ring->cqes = cq + p.cq_off.cqes;
+
+    WT_ERR(__wt_calloc_def(session, ring->entries, &ring->iov));
+
+    *ringp = ring;
+    return (0);
+
+err:
+    __uring_destroy(session, ring);
+    return (ret);
+}
+
+/*
+ * __uring_read_chunk --
+ *     Submit a group of reads no larger than the ring and wait for them to complete.
+ */
+static int
+__uring_read_chunk(
+  WT_SESSION_IMPL *session, WT_IO_URING *ring, int fd, WT_IO_REQ *reqs, u_int nreqs)
+{
+    struct io_uring_cqe *cqe;
+    struct io_uring_sqe *sqe;
+    WT_IO_REQ *req;
+    size_t resid;
+    uint32_t head, idx, tail;
+    u_int done, i, submitted;
+
+    /* Fill the submission queue. */
+    tail = *ring->sq_tail;
+    for (i = 0; i < nreqs; ++i, ++tail) {
+        req = &reqs[i];
+        idx = tail & *ring->sq_mask;
+        ring->iov[idx].iov_base = req->buf;
+        ring->iov[idx].iov_len = req->len;
+
+        sqe = &((struct io_uring_sqe *)ring->sqes)[idx];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = fd;
+        sqe->addr = (uint64_t)(uintptr_t)&ring->iov[idx];
+        sqe->len = 1;
+        sqe->off = (uint64_t)req->offset;
+        sqe->user_data = i;
+        ring->sq_array[idx] = idx;
+    }
+    /* The kernel must see the entries before it sees the new tail. */
+    WT_RELEASE_BARRIER();
+    *ring->sq_tail = tail;
+
+    /* Submit everything, waiting for all of it to complete. */
+    for (done = 0; done < nreqs; done += submitted)
+        WT_RET(__uring_enter(ring, nreqs - done, nreqs - done, &submitted));
+    WT_STAT_CONN_INCR(session, block_read_io_uring_submit);
+
+    /* Reap the completions, waiting again if the kernel returned early. */
+    for (done = 0; done < nreqs;) {
+        head = *ring->cq_head;
+        WT_ACQUIRE_BARRIER();
+        if (head == *ring->cq_tail) {
+            WT_RET(__uring_enter(ring, 0, 1, NULL));
+            continue;
+        }
+        for (; head != *ring->cq_tail; ++head, ++done) {
+            cqe = &((struct io_uring_cqe *)ring->cqes)[head & *ring->cq_mask];
+            req = &reqs[cqe->user_data];
+            if (cqe->res < 0)
+                req->error = -cqe->res;
+            else if ((size_t)cqe->res < req->len) {
+                /* Finish short reads synchronously, it's not worth resubmitting them. */
+                resid = req->len - (size_t)cqe->res;
+                if (pread(fd, (uint8_t *)req->buf + cqe->res, resid, req->offset + cqe->res) ==
+                  (ssize_t)resid)
+                    req->error = 0;
+                else
+                    req->error = WT_ERROR;
+            } else
+                req->error = 0;
+        }
+        WT_RELEASE_BARRIER();
+        *ring->cq_head = head;
+    }
+    return (0);
+}
+#endif
+
+/*
+ * __wt_posix_uring_read --
+ *     Read a batch of blocks from a file using io_uring. Returns ENOTSUP if io_uring isn't
+ *     available for the handle, in which case the caller should fall back to synchronous reads.
+ */
+int
+__wt_posix_uring_read(WT_SESSION_IMPL *session, WT_FH *fh, WT_IO_REQ *reqs, u_int nreqs)
+{
+#ifdef WT_IO_URING_SUPPORTED
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_IO_URING *ring;
+    size_t bytes;
+    u_int chunk, i;
+    int fd;
+
+    conn = S2C(session);
+
+    /* Memory-mapped and non-POSIX file handles don't have a descriptor we can use. */
+    if (conn->io_uring_depth == 0 || !__wti_posix_file_handle_fd(fh->handle, &fd))
+        return (ENOTSUP);
+
+    /*
+     * Create the ring on first use. If the kernel doesn't support io_uring (or it's disabled in
+     * this environment), turn it off for the connection so we don't try again.
+     */
+    if ((ring = session->io_uring) == NULL) {
+        if ((ret = __uring_create(session, conn->io_uring_depth, &ring)) != 0) {
+            __wt_verbose_notice(session, WT_VERB_READ,
+              "io_uring unavailable, falling back to synchronous reads: %s",
+              __wt_strerror(session, ret, NULL, 0));
+            conn->io_uring_depth = 0;
+            return (ENOTSUP);
+        }
+        session->io_uring = ring;
+    }
+
+    WT_STAT_CONN_INCR_ATOMIC(session, thread_read_active);
+    for (bytes = 0, i = 0; i < nreqs; ++i)
+        bytes += reqs[i].len;
+    for (i = 0; i < nreqs; i += chunk) {
+        chunk = WT_MIN(nreqs - i, ring->entries);
+        if ((ret = __uring_read_chunk(session, ring, fd, reqs + i, chunk)) != 0) {
+            /*
+             * The ring is in an unknown state, discard it; the requests that didn't complete are
+             * retried synchronously by our caller.
+             */
+            __wt_err(session, ret, "%s: io_uring batched read failed", fh->name);
+            __uring_destroy(session, ring);
+            session->io_uring = NULL;
+            for (; i < nreqs; ++i)
+                reqs[i].error = ENOTSUP;
+            ret = 0;
+            break;
+        }
+    }
+    WT_STAT_CONN_DECR_ATOMIC(session, thread_read_active);
+    WT_STAT_CONN_INCRV(session, read_io, nreqs);
+    WT_STAT_CONN_INCRV(session, block_byte_read_syscall, bytes);
+    return (ret);
+#else
+    WT_UNUSED(fh);
+    WT_UNUSED(reqs);
+    WT_UNUSED(nreqs);
+
+    return (__wt_set_return(session, ENOTSUP));
+#endif
+}
+
+/*
+ * __wt_posix_uring_discard --
+ *     Discard a session's io_uring.
+ */
+void
+__wt_posix_uring_discard(WT_SESSION_IMPL *session)
+{
+#ifdef WT_IO_URING_SUPPORTED
+    if (session->io_uring != NULL)
+        __uring_destroy(session, session->io_uring);
+#endif
+    session->io_uring = NULL;
+}
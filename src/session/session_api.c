@@ -392,6 +392,10 @@ __wt_session_close_internal(WT_SESSION_IMPL *session)
         __wt_free(session, session->optrack_buf);
     }
 
+    /* Discard any batched read state. */
+    __wt_prefetch_staged_discard(session);
+    __wt_read_batch_discard(session);
+
     /* Release common session resources. */
     WT_TRET(__wt_session_release_resources(session));
 
@@ -658,6 +662,10 @@ __session_open_cursor_int(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *
         if (WT_PREFIX_MATCH(uri, "backup:"))
             WT_RET(__wt_curbackup_open(session, uri, other, cfg, cursorp));
         break;
+    case 'e':
+        if (WT_PREFIX_MATCH(uri, "eviction_trace:"))
+            WT_RET(__wt_curevict_trace_open(session, uri, cfg, cursorp));
+        break;
     case 's':
         if (WT_PREFIX_MATCH(uri, "statistics:"))
             WT_RET(__wt_curstat_open(session, uri, other, cfg, cursorp));
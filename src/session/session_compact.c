@@ -228,7 +228,7 @@ __wt_session_compact_check_interrupted(WT_SESSION_IMPL *session)
     conn = S2C(session);
 
     /* If compaction has been interrupted, we return WT_ERROR to the caller. */
-    if (session == conn->background_compact.session) {
+    if (F_ISSET(session, WT_SESSION_BACKGROUND_COMPACT)) {
         background_compaction = true;
         __wt_spin_lock(session, &conn->background_compact.lock);
         if (!__wt_atomic_loadbool(&conn->background_compact.running))
@@ -291,7 +291,7 @@ __compact_worker(WT_SESSION_IMPL *session)
     u_int i, loop;
     bool another_pass, background_compaction;
 
-    background_compaction = session == S2C(session)->background_compact.session;
+    background_compaction = F_ISSET(session, WT_SESSION_BACKGROUND_COMPACT);
 
     /*
      * Reset the handles' compaction skip flag (we don't bother setting or resetting it when we
@@ -464,6 +464,11 @@ __wti_session_compact(WT_SESSION *wt_session, const char *uri, const char *confi
                 WT_ERR_MSG(session, EINVAL,
                   "timeout configuration cannot be set when disabling the background compaction "
                   "server.");
+            WT_ERR_NOTFOUND_OK(__wt_config_getones(session, config, "threads", &cval), true);
+            if (ret == 0)
+                WT_ERR_MSG(session, EINVAL,
+                  "threads configuration cannot be set when disabling the background compaction "
+                  "server.");
         }
 
         WT_ERR(__wt_background_compact_signal(session, config));
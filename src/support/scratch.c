@@ -389,6 +389,133 @@ __wt_scr_discard(WT_SESSION_IMPL *session)
 #endif
 }
 
+/*
+ * __bufpool_class --
+ *     Return the size class for a buffer of the given size, WT_BUFPOOL_CLASSES if it's too large to
+ *     pool.
+ */
+static WT_INLINE u_int
+__bufpool_class(size_t size)
+{
+    u_int i;
+
+    for (i = 0; i < WT_BUFPOOL_CLASSES; ++i)
+        if (size <= WT_BUFPOOL_CLASS_SIZE(i))
+            break;
+    return (i);
+}
+
+/*
+ * __wt_bufpool_get --
+ *     Return a scratch buffer with aligned memory for I/O of at least the given size, taking the
+ *     memory from the connection's buffer pool if possible.
+ */
+int
+__wt_bufpool_get(WT_SESSION_IMPL *session, size_t size, WT_ITEM **bufp)
+{
+    WT_BUFPOOL *pool;
+    WT_ITEM *buf;
+    u_int i;
+    void *p;
+
+    pool = &S2C(session)->bufpool;
+
+    if (pool->max == 0 || (i = __bufpool_class(size)) == WT_BUFPOOL_CLASSES)
+        return (__wt_scr_alloc(session, size, bufp));
+
+    /*
+     * Take the smallest scratch buffer the session has: if its memory is already large enough it's
+     * used as-is, otherwise the memory is replaced with a buffer from the pool.
+     */
+    WT_RET(__wt_scr_alloc(session, 0, bufp));
+    buf = *bufp;
+    if (buf->memsize >= size)
+        return (0);
+
+    __wt_spin_lock(session, &pool->lock);
+    if ((p = pool->free[i]) != NULL) {
+        pool->free[i] = *(void **)p;
+        __wt_atomic_storesize(&pool->bytes, pool->bytes - WT_BUFPOOL_CLASS_SIZE(i));
+    }
+    __wt_spin_unlock(session, &pool->lock);
+
+    /*
+     * Allocate the full size class on a miss so the memory can be returned to the pool and reused
+     * for any request in the class.
+     */
+    if (p == NULL) {
+        WT_STAT_CONN_INCR(session, block_buffer_pool_miss);
+        return (__wt_buf_init(session, buf, WT_BUFPOOL_CLASS_SIZE(i)));
+    }
+
+    WT_STAT_CONN_INCR(session, block_buffer_pool_hit);
+    __wt_free(session, buf->mem);
+    buf->mem = p;
+    buf->memsize = WT_BUFPOOL_CLASS_SIZE(i);
+    buf->data = buf->mem;
+    buf->size = 0;
+    return (0);
+}
+
+/*
+ * __wt_bufpool_put --
+ *     Release a scratch buffer from __wt_bufpool_get, returning its memory to the connection's
+ *     buffer pool if it matches a size class and there's room.
+ */
+void
+__wt_bufpool_put(WT_SESSION_IMPL *session, WT_ITEM **bufp)
+{
+    WT_BUFPOOL *pool;
+    WT_ITEM *buf;
+    u_int i;
+
+    pool = &S2C(session)->bufpool;
+
+    if ((buf = *bufp) == NULL)
+        return;
+
+    /* Buffers grown to an arbitrary size stay with the session. */
+    if (pool->max != 0 && buf->memsize != 0 &&
+      (i = __bufpool_class(buf->memsize)) < WT_BUFPOOL_CLASSES &&
+      buf->memsize == WT_BUFPOOL_CLASS_SIZE(i)) {
+        WT_ASSERT(session, F_ISSET(buf, WT_ITEM_ALIGNED));
+        __wt_spin_lock(session, &pool->lock);
+        if (pool->bytes + buf->memsize <= pool->max) {
+            *(void **)buf->mem = pool->free[i];
+            pool->free[i] = buf->mem;
+            __wt_atomic_storesize(&pool->bytes, pool->bytes + buf->memsize);
+            buf->mem = NULL;
+            buf->memsize = 0;
+        }
+        __wt_spin_unlock(session, &pool->lock);
+    }
+
+    __wt_scr_free(session, bufp);
+}
+
+/*
+ * __wt_bufpool_destroy --
+ *     Free the memory cached in the connection's buffer pool.
+ */
+void
+__wt_bufpool_destroy(WT_SESSION_IMPL *session)
+{
+    WT_BUFPOOL *pool;
+    u_int i;
+    void *next, *p;
+
+    pool = &S2C(session)->bufpool;
+
+    for (i = 0; i < WT_BUFPOOL_CLASSES; ++i)
+        for (p = pool->free[i]; p != NULL; p = next) {
+            next = *(void **)p;
+            __wt_free(session, p);
+        }
+    memset(pool->free, 0, sizeof(pool->free));
+    pool->bytes = 0;
+    __wt_spin_destroy(session, &pool->lock);
+}
+
 /*
  * __wt_ext_scr_alloc --
  *     Allocate a scratch buffer, and return the memory reference.
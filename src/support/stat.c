@@ -19,7 +19,16 @@ static const char *const __stats_dsrc_desc[] = {
   "autocommit: retries for update operations",
   "backup: total modified incremental blocks with compressed data",
   "backup: total modified incremental blocks without compressed data",
+  "block-manager: allocations extending the file to keep size classes segregated",
   "block-manager: allocations requiring file extension",
+  "block-manager: available bytes in extents larger than 1MB",
+  "block-manager: available bytes in extents larger than 32KB, up to 1MB",
+  "block-manager: available bytes in extents larger than 4KB, up to 32KB",
+  "block-manager: available bytes in extents of 4KB or less",
+  "block-manager: available extents larger than 1MB",
+  "block-manager: available extents larger than 32KB, up to 1MB",
+  "block-manager: available extents larger than 4KB, up to 32KB",
+  "block-manager: available extents of 4KB or less",
   "block-manager: blocks allocated",
   "block-manager: blocks freed",
   "block-manager: checkpoint size",
@@ -31,6 +40,7 @@ static const char *const __stats_dsrc_desc[] = {
   "block-manager: minor version number",
   "btree: btree checkpoint generation",
   "btree: btree clean tree checkpoint expiration time",
+  "btree: btree compact bytes rewritten",
   "btree: btree compact pages reviewed",
   "btree: btree compact pages rewritten",
   "btree: btree compact pages skipped",
@@ -59,6 +69,8 @@ static const char *const __stats_dsrc_desc[] = {
   "cache: bytes dirty in the cache cumulative",
   "cache: bytes read into cache",
   "cache: bytes written from cache",
+  "cache: cache quota configured for the object",
+  "cache: cache reservation configured for the object",
   "cache: checkpoint blocked page eviction",
   "cache: checkpoint of history store file blocked non-history store page eviction",
   "cache: data source pages selected for eviction unable to be evicted",
@@ -381,7 +393,16 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->autocommit_update_retry = 0;
     stats->backup_blocks_compressed = 0;
     stats->backup_blocks_uncompressed = 0;
+    stats->block_alloc_segregated_extend = 0;
     stats->block_extension = 0;
+    stats->block_avail_large_bytes = 0;
+    stats->block_avail_1mb_bytes = 0;
+    stats->block_avail_32kb_bytes = 0;
+    stats->block_avail_4kb_bytes = 0;
+    stats->block_avail_large = 0;
+    stats->block_avail_1mb = 0;
+    stats->block_avail_32kb = 0;
+    stats->block_avail_4kb = 0;
     stats->block_alloc = 0;
     stats->block_free = 0;
     stats->block_checkpoint_size = 0;
@@ -393,6 +414,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->block_minor = 0;
     /* not clearing btree_checkpoint_generation */
     /* not clearing btree_clean_checkpoint_timer */
+    /* not clearing btree_compact_bytes_rewritten */
     /* not clearing btree_compact_pages_reviewed */
     /* not clearing btree_compact_pages_rewritten */
     /* not clearing btree_compact_pages_skipped */
@@ -421,6 +443,8 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     /* not clearing cache_bytes_dirty_total */
     stats->cache_bytes_read = 0;
     stats->cache_bytes_write = 0;
+        /* not clearing cache_bytes_quota */
+        /* not clearing cache_bytes_reserve */
     stats->cache_eviction_blocked_checkpoint = 0;
     stats->cache_eviction_blocked_checkpoint_hs = 0;
     stats->cache_eviction_fail = 0;
@@ -698,7 +722,16 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->autocommit_update_retry += from->autocommit_update_retry;
     to->backup_blocks_compressed += from->backup_blocks_compressed;
     to->backup_blocks_uncompressed += from->backup_blocks_uncompressed;
+    to->block_alloc_segregated_extend += from->block_alloc_segregated_extend;
     to->block_extension += from->block_extension;
+    to->block_avail_large_bytes += from->block_avail_large_bytes;
+    to->block_avail_1mb_bytes += from->block_avail_1mb_bytes;
+    to->block_avail_32kb_bytes += from->block_avail_32kb_bytes;
+    to->block_avail_4kb_bytes += from->block_avail_4kb_bytes;
+    to->block_avail_large += from->block_avail_large;
+    to->block_avail_1mb += from->block_avail_1mb;
+    to->block_avail_32kb += from->block_avail_32kb;
+    to->block_avail_4kb += from->block_avail_4kb;
     to->block_alloc += from->block_alloc;
     to->block_free += from->block_free;
     to->block_checkpoint_size += from->block_checkpoint_size;
@@ -714,6 +747,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
         to->block_minor = from->block_minor;
     to->btree_checkpoint_generation += from->btree_checkpoint_generation;
     to->btree_clean_checkpoint_timer += from->btree_clean_checkpoint_timer;
+    to->btree_compact_bytes_rewritten += from->btree_compact_bytes_rewritten;
     to->btree_compact_pages_reviewed += from->btree_compact_pages_reviewed;
     to->btree_compact_pages_rewritten += from->btree_compact_pages_rewritten;
     to->btree_compact_pages_skipped += from->btree_compact_pages_skipped;
@@ -748,6 +782,8 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cache_bytes_dirty_total += from->cache_bytes_dirty_total;
     to->cache_bytes_read += from->cache_bytes_read;
     to->cache_bytes_write += from->cache_bytes_write;
+    to->cache_bytes_quota += from->cache_bytes_quota;
+    to->cache_bytes_reserve += from->cache_bytes_reserve;
     to->cache_eviction_blocked_checkpoint += from->cache_eviction_blocked_checkpoint;
     to->cache_eviction_blocked_checkpoint_hs += from->cache_eviction_blocked_checkpoint_hs;
     to->cache_eviction_fail += from->cache_eviction_fail;
@@ -1030,7 +1066,16 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->autocommit_update_retry += WT_STAT_DSRC_READ(from, autocommit_update_retry);
     to->backup_blocks_compressed += WT_STAT_DSRC_READ(from, backup_blocks_compressed);
     to->backup_blocks_uncompressed += WT_STAT_DSRC_READ(from, backup_blocks_uncompressed);
+    to->block_alloc_segregated_extend += WT_STAT_DSRC_READ(from, block_alloc_segregated_extend);
     to->block_extension += WT_STAT_DSRC_READ(from, block_extension);
+    to->block_avail_large_bytes += WT_STAT_DSRC_READ(from, block_avail_large_bytes);
+    to->block_avail_1mb_bytes += WT_STAT_DSRC_READ(from, block_avail_1mb_bytes);
+    to->block_avail_32kb_bytes += WT_STAT_DSRC_READ(from, block_avail_32kb_bytes);
+    to->block_avail_4kb_bytes += WT_STAT_DSRC_READ(from, block_avail_4kb_bytes);
+    to->block_avail_large += WT_STAT_DSRC_READ(from, block_avail_large);
+    to->block_avail_1mb += WT_STAT_DSRC_READ(from, block_avail_1mb);
+    to->block_avail_32kb += WT_STAT_DSRC_READ(from, block_avail_32kb);
+    to->block_avail_4kb += WT_STAT_DSRC_READ(from, block_avail_4kb);
     to->block_alloc += WT_STAT_DSRC_READ(from, block_alloc);
     to->block_free += WT_STAT_DSRC_READ(from, block_free);
     to->block_checkpoint_size += WT_STAT_DSRC_READ(from, block_checkpoint_size);
@@ -1046,6 +1091,7 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
         to->block_minor = v;
     to->btree_checkpoint_generation += WT_STAT_DSRC_READ(from, btree_checkpoint_generation);
     to->btree_clean_checkpoint_timer += WT_STAT_DSRC_READ(from, btree_clean_checkpoint_timer);
+    to->btree_compact_bytes_rewritten += WT_STAT_DSRC_READ(from, btree_compact_bytes_rewritten);
     to->btree_compact_pages_reviewed += WT_STAT_DSRC_READ(from, btree_compact_pages_reviewed);
     to->btree_compact_pages_rewritten += WT_STAT_DSRC_READ(from, btree_compact_pages_rewritten);
     to->btree_compact_pages_skipped += WT_STAT_DSRC_READ(from, btree_compact_pages_skipped);
@@ -1083,6 +1129,8 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cache_bytes_dirty_total += WT_STAT_DSRC_READ(from, cache_bytes_dirty_total);
     to->cache_bytes_read += WT_STAT_DSRC_READ(from, cache_bytes_read);
     to->cache_bytes_write += WT_STAT_DSRC_READ(from, cache_bytes_write);
+    to->cache_bytes_quota += WT_STAT_DSRC_READ(from, cache_bytes_quota);
+    to->cache_bytes_reserve += WT_STAT_DSRC_READ(from, cache_bytes_reserve);
     to->cache_eviction_blocked_checkpoint +=
       WT_STAT_DSRC_READ(from, cache_eviction_blocked_checkpoint);
     to->cache_eviction_blocked_checkpoint_hs +=
@@ -1398,6 +1446,7 @@ static const char *const __stats_connection_desc[] = {
   "background-compact: background compact skipped file as not meeting requirements for compaction",
   "background-compact: background compact successful calls",
   "background-compact: background compact timeout",
+  "background-compact: number of files being compacted by background compaction threads",
   "background-compact: number of files tracked by background compaction",
   "backup: backup cursor open",
   "backup: backup duplicate cursor open",
@@ -1412,15 +1461,21 @@ static const char *const __stats_connection_desc[] = {
   "block-cache: evicted blocks",
   "block-cache: file size causing bypass",
   "block-cache: lookups",
+  "block-cache: number of blocks in the warm restart manifest",
+  "block-cache: number of blocks loaded on warm restart",
   "block-cache: number of blocks not evicted due to overhead",
+  "block-cache: number of blocks retained for clean pages evicted from the cache",
   "block-cache: number of bypasses because no-write-allocate setting was on",
   "block-cache: number of bypasses due to overhead on put",
   "block-cache: number of bypasses on get",
   "block-cache: number of bypasses on put because file is too small",
+  "block-cache: number of clean pages evicted from the cache without a cached block",
   "block-cache: number of eviction passes",
   "block-cache: number of hits",
+  "block-cache: number of hits on blocks of pages evicted from the cache",
   "block-cache: number of misses",
   "block-cache: number of put bypasses on checkpoint I/O",
+  "block-cache: number of warm restart blocks not loaded",
   "block-cache: removed blocks",
   "block-cache: time sleeping to remove block (usecs)",
   "block-cache: total blocks",
@@ -1429,9 +1484,18 @@ static const char *const __stats_connection_desc[] = {
   "block-cache: total bytes",
   "block-cache: total bytes inserted on read path",
   "block-cache: total bytes inserted on write path",
+  "block-manager: aligned I/O buffers allocated because the buffer pool was empty",
+  "block-manager: aligned I/O buffers reused from the buffer pool",
+  "block-manager: batched block read requests",
+  "block-manager: batched block reads of adjacent blocks coalesced into a single read",
+  "block-manager: batched block reads submitted via io_uring",
   "block-manager: blocks pre-loaded",
   "block-manager: blocks read",
+  "block-manager: blocks read by batched block read requests",
+  "block-manager: blocks read by coalesced batched block reads",
   "block-manager: blocks written",
+  "block-manager: blocks written by combined checkpoint writes",
+  "block-manager: bytes cached in the aligned I/O buffer pool",
   "block-manager: bytes read",
   "block-manager: bytes read via memory map API",
   "block-manager: bytes read via system call API",
@@ -1440,12 +1504,16 @@ static const char *const __stats_connection_desc[] = {
   "block-manager: bytes written for checkpoint",
   "block-manager: bytes written via memory map API",
   "block-manager: bytes written via system call API",
+  "block-manager: combined checkpoint writes",
+  "block-manager: extent list merges done by walking both lists in offset order",
   "block-manager: mapped blocks read",
   "block-manager: mapped bytes read",
   "block-manager: number of times the file was remapped because it changed size via fallocate or "
   "truncate",
   "block-manager: number of times the region was remapped via write",
+  "cache: application thread eviction wait budget exhausted",
   "cache: application thread time evicting (usecs)",
+  "cache: application thread waits for eviction threads to make progress",
   "cache: application threads page read from disk to cache count",
   "cache: application threads page read from disk to cache time (usecs)",
   "cache: application threads page write from cache to disk count",
@@ -1455,7 +1523,10 @@ static const char *const __stats_connection_desc[] = {
   "cache: bytes belonging to the history store table in the cache",
   "cache: bytes currently in the cache",
   "cache: bytes dirty in the cache cumulative",
+  "cache: bytes in slab chunks holding page images",
+  "cache: bytes in slabs allocated for page images",
   "cache: bytes not belonging to page images in the cache",
+  "cache: bytes of page images held in slab chunks",
   "cache: bytes read into cache",
   "cache: bytes written from cache",
   "cache: checkpoint blocked page eviction",
@@ -1467,6 +1538,7 @@ static const char *const __stats_connection_desc[] = {
   "cache: eviction calls to get a page",
   "cache: eviction calls to get a page found queue empty",
   "cache: eviction calls to get a page found queue empty after locking",
+  "cache: eviction calls to get a page found their queue shard empty and used another shard",
   "cache: eviction currently operating in aggressive mode",
   "cache: eviction empty score",
   "cache: eviction gave up due to detecting a disk value without a timestamp behind the last "
@@ -1480,10 +1552,17 @@ static const char *const __stats_connection_desc[] = {
   "cache: eviction gave up due to needing to remove a record from the history store but checkpoint "
   "is running",
   "cache: eviction gave up due to no progress being made",
+  "cache: eviction pacing bytes in cache growth per second",
+  "cache: eviction pacing dirty bytes growth per second",
+  "cache: eviction pacing predicted bytes in cache at the horizon",
+  "cache: eviction pacing predicted dirty bytes at the horizon",
   "cache: eviction passes of a file",
+  "cache: eviction passes started early by eviction pacing",
   "cache: eviction server candidate queue empty when topping up",
   "cache: eviction server candidate queue not empty when topping up",
+  "cache: eviction server rankings of trees by eviction candidates",
   "cache: eviction server skips dirty pages during a running checkpoint",
+  "cache: eviction server skips frequently accessed pages",
   "cache: eviction server skips internal pages as it has an active child.",
   "cache: eviction server skips metadata pages with history",
   "cache: eviction server skips pages that are written with transactions greater than the last "
@@ -1494,9 +1573,13 @@ static const char *const __stats_connection_desc[] = {
   "cache: eviction server skips trees because there are too many active walks",
   "cache: eviction server skips trees that are being checkpointed",
   "cache: eviction server skips trees that are configured to stick in cache",
+  "cache: eviction server skips trees that are using less than their cache reservation",
+  "cache: eviction server skips trees that are within their cache quota while enforcing quotas",
   "cache: eviction server skips trees that disable eviction",
   "cache: eviction server skips trees that were not useful before",
   "cache: eviction server slept, because we did not make progress with eviction",
+  "cache: eviction server trees left out of rankings with no eviction candidates",
+  "cache: eviction server trees ranked in the most recent ranking",
   "cache: eviction server unable to reach eviction goal",
   "cache: eviction server waiting for a leaf page",
   "cache: eviction state",
@@ -1626,6 +1709,8 @@ static const char *const __stats_connection_desc[] = {
   "cache: recent modification of a page blocked its eviction",
   "cache: reverse splits performed",
   "cache: reverse splits skipped because of VLCS namespace gap restrictions",
+  "cache: slabs allocated for page images",
+  "cache: slabs freed for page images",
   "cache: the number of times full update inserted to history store",
   "cache: the number of times reverse modify inserted to history store",
   "cache: total milliseconds spent inside reentrant history store evictions in a reconciliation",
@@ -1635,6 +1720,11 @@ static const char *const __stats_connection_desc[] = {
   "cache: tracked dirty pages in the cache",
   "cache: uncommitted truncate blocked page eviction",
   "cache: unmodified pages evicted",
+  "cache: update chain trimming bytes of obsolete updates removed",
+  "cache: update chain trimming obsolete updates removed",
+  "cache: update chain trimming pages trimmed",
+  "cache: update chain trimming pages visited",
+  "cache: update chain trimming passes",
   "capacity: background fsync file handles considered",
   "capacity: background fsync file handles synced",
   "capacity: background fsync time (msecs)",
@@ -1703,11 +1793,16 @@ static const char *const __stats_connection_desc[] = {
   "checkpoint: transaction checkpoints due to obsolete pages",
   "checkpoint: wait cycles while cache dirty level is decreasing",
   "chunk-cache: aggregate number of spanned chunks on read",
+  "chunk-cache: chunks admitted to the main region by the TinyLFU policy",
   "chunk-cache: chunks evicted",
+  "chunk-cache: chunks rejected from the main region by the TinyLFU policy",
   "chunk-cache: could not allocate due to exceeding bitmap capacity",
   "chunk-cache: could not allocate due to exceeding capacity",
   "chunk-cache: lookups",
   "chunk-cache: number of chunks loaded from flushed tables in chunk cache",
+  "chunk-cache: number of hits on chunks cached by reads",
+  "chunk-cache: number of hits on chunks cached from flushed tables",
+  "chunk-cache: number of hits on chunks cached from persisted metadata",
   "chunk-cache: number of metadata entries inserted",
   "chunk-cache: number of metadata entries removed",
   "chunk-cache: number of metadata inserts/deletes dropped by the worker thread",
@@ -1900,6 +1995,13 @@ static const char *const __stats_connection_desc[] = {
   "log: total size of compressed records",
   "log: written slots coalesced",
   "log: yields waiting for previous log file close",
+  "perf: application thread eviction latency histogram (bucket 1) - 0-100us",
+  "perf: application thread eviction latency histogram (bucket 2) - 100-249us",
+  "perf: application thread eviction latency histogram (bucket 3) - 250-499us",
+  "perf: application thread eviction latency histogram (bucket 4) - 500-999us",
+  "perf: application thread eviction latency histogram (bucket 5) - 1000-9999us",
+  "perf: application thread eviction latency histogram (bucket 6) - 10000us+",
+  "perf: application thread eviction latency histogram total (usecs)",
   "perf: file system read latency histogram (bucket 1) - 0-10ms",
   "perf: file system read latency histogram (bucket 2) - 10-49ms",
   "perf: file system read latency histogram (bucket 3) - 50-99ms",
@@ -1942,6 +2044,7 @@ static const char *const __stats_connection_desc[] = {
   "prefetch: pre-fetch not triggered due to special btree handle",
   "prefetch: pre-fetch page not on disk when reading",
   "prefetch: pre-fetch pages queued",
+  "prefetch: pre-fetch pages read from a batched block read",
   "prefetch: pre-fetch pages read in background",
   "prefetch: pre-fetch skipped reading in a page due to harmless error",
   "prefetch: pre-fetch triggered by page read",
@@ -2168,6 +2271,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->background_compact_skipped = 0;
     stats->background_compact_success = 0;
     stats->background_compact_timeout = 0;
+    stats->background_compact_files_active = 0;
     stats->background_compact_files_tracked = 0;
     /* not clearing backup_cursor_open */
     /* not clearing backup_dup_open */
@@ -2182,15 +2286,21 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_cache_blocks_evicted = 0;
     stats->block_cache_bypass_filesize = 0;
     stats->block_cache_lookups = 0;
+        /* not clearing block_cache_manifest_blocks */
+    stats->block_cache_prewarm_blocks = 0;
     stats->block_cache_not_evicted_overhead = 0;
+    stats->block_cache_victim_retained = 0;
     stats->block_cache_bypass_writealloc = 0;
     stats->block_cache_bypass_overhead_put = 0;
     stats->block_cache_bypass_get = 0;
     stats->block_cache_bypass_put = 0;
+    stats->block_cache_victim_not_cached = 0;
     stats->block_cache_eviction_passes = 0;
     stats->block_cache_hits = 0;
+    stats->block_cache_victim_hits = 0;
     stats->block_cache_misses = 0;
     stats->block_cache_bypass_chkpt = 0;
+    stats->block_cache_prewarm_skipped = 0;
     stats->block_cache_blocks_removed = 0;
     stats->block_cache_blocks_removed_blocked = 0;
     stats->block_cache_blocks = 0;
@@ -2199,9 +2309,18 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_cache_bytes = 0;
     stats->block_cache_bytes_insert_read = 0;
     stats->block_cache_bytes_insert_write = 0;
+    stats->block_buffer_pool_miss = 0;
+    stats->block_buffer_pool_hit = 0;
+    stats->block_read_batch = 0;
+    stats->block_read_coalesce = 0;
+    stats->block_read_io_uring_submit = 0;
     stats->block_preload = 0;
     stats->block_read = 0;
+    stats->block_read_batch_blocks = 0;
+    stats->block_read_coalesce_blocks = 0;
     stats->block_write = 0;
+    stats->block_write_combine_blocks = 0;
+    /* not clearing block_buffer_pool_bytes */
     stats->block_byte_read = 0;
     stats->block_byte_read_mmap = 0;
     stats->block_byte_read_syscall = 0;
@@ -2210,11 +2329,15 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_byte_write_checkpoint = 0;
     stats->block_byte_write_mmap = 0;
     stats->block_byte_write_syscall = 0;
+    stats->block_write_combine = 0;
+    stats->block_extlist_merge_walk = 0;
     stats->block_map_read = 0;
     stats->block_byte_map_read = 0;
     stats->block_remap_file_resize = 0;
     stats->block_remap_file_write = 0;
+    stats->cache_eviction_app_wait_exhausted = 0;
     stats->cache_eviction_app_time = 0;
+    stats->cache_eviction_app_wait = 0;
     stats->cache_read_app_count = 0;
     stats->cache_read_app_time = 0;
     stats->cache_write_app_count = 0;
@@ -2224,7 +2347,10 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing cache_bytes_hs */
     /* not clearing cache_bytes_inuse */
     /* not clearing cache_bytes_dirty_total */
+        /* not clearing cache_slab_bytes_inuse */
+        /* not clearing cache_slab_bytes */
     /* not clearing cache_bytes_other */
+        /* not clearing cache_slab_bytes_requested */
     stats->cache_bytes_read = 0;
     stats->cache_bytes_write = 0;
     stats->cache_eviction_blocked_checkpoint = 0;
@@ -2236,6 +2362,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_eviction_get_ref = 0;
     stats->cache_eviction_get_ref_empty = 0;
     stats->cache_eviction_get_ref_empty2 = 0;
+    stats->cache_eviction_get_ref_steal = 0;
     /* not clearing cache_eviction_aggressive_set */
     /* not clearing cache_eviction_empty_score */
     stats->cache_eviction_blocked_no_ts_checkpoint_race_1 = 0;
@@ -2244,10 +2371,17 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_eviction_blocked_no_ts_checkpoint_race_4 = 0;
     stats->cache_eviction_blocked_remove_hs_race_with_checkpoint = 0;
     stats->cache_eviction_blocked_no_progress = 0;
+        /* not clearing cache_eviction_pacing_inuse_rate */
+        /* not clearing cache_eviction_pacing_dirty_rate */
+        /* not clearing cache_eviction_pacing_inuse_predicted */
+        /* not clearing cache_eviction_pacing_dirty_predicted */
     stats->cache_eviction_walk_passes = 0;
+    stats->cache_eviction_pacing_early = 0;
     stats->cache_eviction_queue_empty = 0;
     stats->cache_eviction_queue_not_empty = 0;
+    stats->cache_eviction_server_rank_trees = 0;
     stats->cache_eviction_server_skip_dirty_pages_during_checkpoint = 0;
+    stats->cache_eviction_server_skip_frequent_pages = 0;
     stats->cache_eviction_server_skip_intl_page_with_active_child = 0;
     stats->cache_eviction_server_skip_metatdata_with_history = 0;
     stats->cache_eviction_server_skip_pages_last_running = 0;
@@ -2257,9 +2391,13 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_eviction_server_skip_trees_too_many_active_walks = 0;
     stats->cache_eviction_server_skip_checkpointing_trees = 0;
     stats->cache_eviction_server_skip_trees_stick_in_cache = 0;
+    stats->cache_eviction_server_skip_trees_reserved = 0;
+    stats->cache_eviction_server_skip_trees_under_quota = 0;
     stats->cache_eviction_server_skip_trees_eviction_disabled = 0;
     stats->cache_eviction_server_skip_trees_not_useful_before = 0;
     stats->cache_eviction_server_slept = 0;
+    stats->cache_eviction_server_rank_trees_skipped = 0;
+        /* not clearing cache_eviction_server_rank_trees_ranked */
     stats->cache_eviction_slow = 0;
     stats->cache_eviction_walk_leaf_notfound = 0;
     /* not clearing cache_eviction_state */
@@ -2377,6 +2515,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_eviction_blocked_recently_modified = 0;
     stats->cache_reverse_splits = 0;
     stats->cache_reverse_splits_skipped_vlcs = 0;
+    stats->cache_slab_allocated = 0;
+    stats->cache_slab_freed = 0;
     stats->cache_hs_insert_full_update = 0;
     stats->cache_hs_insert_reverse_modify = 0;
     /* not clearing cache_reentry_hs_eviction_milliseconds */
@@ -2386,6 +2526,11 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing cache_pages_dirty */
     stats->cache_eviction_blocked_uncommitted_truncate = 0;
     stats->cache_eviction_clean = 0;
+    stats->cache_chain_trim_bytes = 0;
+    stats->cache_chain_trim_updates = 0;
+    stats->cache_chain_trim_pages = 0;
+    stats->cache_chain_trim_pages_visited = 0;
+    stats->cache_chain_trim_passes = 0;
     stats->fsync_all_fh_total = 0;
     stats->fsync_all_fh = 0;
     /* not clearing fsync_all_time */
@@ -2454,11 +2599,16 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->checkpoint_obsolete_applied = 0;
     stats->checkpoint_wait_reduce_dirty = 0;
     stats->chunkcache_spans_chunks_read = 0;
+    stats->chunkcache_tinylfu_admitted = 0;
     stats->chunkcache_chunks_evicted = 0;
+    stats->chunkcache_tinylfu_rejected = 0;
     stats->chunkcache_exceeded_bitmap_capacity = 0;
     stats->chunkcache_exceeded_capacity = 0;
     stats->chunkcache_lookups = 0;
     stats->chunkcache_chunks_loaded_from_flushed_tables = 0;
+    stats->chunkcache_hits_read = 0;
+    stats->chunkcache_hits_flushed = 0;
+    stats->chunkcache_hits_metadata = 0;
     stats->chunkcache_metadata_inserted = 0;
     stats->chunkcache_metadata_removed = 0;
     stats->chunkcache_metadata_work_units_dropped = 0;
@@ -2649,6 +2799,13 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->log_compress_len = 0;
     stats->log_slot_coalesced = 0;
     stats->log_close_yields = 0;
+    stats->perf_hist_evictapp_latency_lt100 = 0;
+    stats->perf_hist_evictapp_latency_lt250 = 0;
+    stats->perf_hist_evictapp_latency_lt500 = 0;
+    stats->perf_hist_evictapp_latency_lt1000 = 0;
+    stats->perf_hist_evictapp_latency_lt10000 = 0;
+    stats->perf_hist_evictapp_latency_gt10000 = 0;
+    stats->perf_hist_evictapp_latency_total_usecs = 0;
     stats->perf_hist_fsread_latency_lt10 = 0;
     stats->perf_hist_fsread_latency_lt50 = 0;
     stats->perf_hist_fsread_latency_lt100 = 0;
@@ -2691,6 +2848,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->prefetch_skipped_special_handle = 0;
     stats->prefetch_pages_fail = 0;
     stats->prefetch_pages_queued = 0;
+    stats->prefetch_pages_read_batch = 0;
     stats->prefetch_pages_read = 0;
     stats->prefetch_skipped_error_ok = 0;
     stats->prefetch_attempts = 0;
@@ -2887,6 +3045,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->background_compact_skipped += WT_STAT_CONN_READ(from, background_compact_skipped);
     to->background_compact_success += WT_STAT_CONN_READ(from, background_compact_success);
     to->background_compact_timeout += WT_STAT_CONN_READ(from, background_compact_timeout);
+    to->background_compact_files_active +=
+      WT_STAT_CONN_READ(from, background_compact_files_active);
     to->background_compact_files_tracked +=
       WT_STAT_CONN_READ(from, background_compact_files_tracked);
     to->backup_cursor_open += WT_STAT_CONN_READ(from, backup_cursor_open);
@@ -2902,16 +3062,22 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_cache_blocks_evicted += WT_STAT_CONN_READ(from, block_cache_blocks_evicted);
     to->block_cache_bypass_filesize += WT_STAT_CONN_READ(from, block_cache_bypass_filesize);
     to->block_cache_lookups += WT_STAT_CONN_READ(from, block_cache_lookups);
+    to->block_cache_manifest_blocks += WT_STAT_CONN_READ(from, block_cache_manifest_blocks);
+    to->block_cache_prewarm_blocks += WT_STAT_CONN_READ(from, block_cache_prewarm_blocks);
     to->block_cache_not_evicted_overhead +=
       WT_STAT_CONN_READ(from, block_cache_not_evicted_overhead);
+    to->block_cache_victim_retained += WT_STAT_CONN_READ(from, block_cache_victim_retained);
     to->block_cache_bypass_writealloc += WT_STAT_CONN_READ(from, block_cache_bypass_writealloc);
     to->block_cache_bypass_overhead_put += WT_STAT_CONN_READ(from, block_cache_bypass_overhead_put);
     to->block_cache_bypass_get += WT_STAT_CONN_READ(from, block_cache_bypass_get);
     to->block_cache_bypass_put += WT_STAT_CONN_READ(from, block_cache_bypass_put);
+    to->block_cache_victim_not_cached += WT_STAT_CONN_READ(from, block_cache_victim_not_cached);
     to->block_cache_eviction_passes += WT_STAT_CONN_READ(from, block_cache_eviction_passes);
     to->block_cache_hits += WT_STAT_CONN_READ(from, block_cache_hits);
+    to->block_cache_victim_hits += WT_STAT_CONN_READ(from, block_cache_victim_hits);
     to->block_cache_misses += WT_STAT_CONN_READ(from, block_cache_misses);
     to->block_cache_bypass_chkpt += WT_STAT_CONN_READ(from, block_cache_bypass_chkpt);
+    to->block_cache_prewarm_skipped += WT_STAT_CONN_READ(from, block_cache_prewarm_skipped);
     to->block_cache_blocks_removed += WT_STAT_CONN_READ(from, block_cache_blocks_removed);
     to->block_cache_blocks_removed_blocked +=
       WT_STAT_CONN_READ(from, block_cache_blocks_removed_blocked);
@@ -2921,9 +3087,18 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_cache_bytes += WT_STAT_CONN_READ(from, block_cache_bytes);
     to->block_cache_bytes_insert_read += WT_STAT_CONN_READ(from, block_cache_bytes_insert_read);
     to->block_cache_bytes_insert_write += WT_STAT_CONN_READ(from, block_cache_bytes_insert_write);
+    to->block_buffer_pool_miss += WT_STAT_CONN_READ(from, block_buffer_pool_miss);
+    to->block_buffer_pool_hit += WT_STAT_CONN_READ(from, block_buffer_pool_hit);
+    to->block_read_batch += WT_STAT_CONN_READ(from, block_read_batch);
+    to->block_read_coalesce += WT_STAT_CONN_READ(from, block_read_coalesce);
+    to->block_read_io_uring_submit += WT_STAT_CONN_READ(from, block_read_io_uring_submit);
     to->block_preload += WT_STAT_CONN_READ(from, block_preload);
     to->block_read += WT_STAT_CONN_READ(from, block_read);
+    to->block_read_batch_blocks += WT_STAT_CONN_READ(from, block_read_batch_blocks);
+    to->block_read_coalesce_blocks += WT_STAT_CONN_READ(from, block_read_coalesce_blocks);
     to->block_write += WT_STAT_CONN_READ(from, block_write);
+    to->block_write_combine_blocks += WT_STAT_CONN_READ(from, block_write_combine_blocks);
+    to->block_buffer_pool_bytes += WT_STAT_CONN_READ(from, block_buffer_pool_bytes);
     to->block_byte_read += WT_STAT_CONN_READ(from, block_byte_read);
     to->block_byte_read_mmap += WT_STAT_CONN_READ(from, block_byte_read_mmap);
     to->block_byte_read_syscall += WT_STAT_CONN_READ(from, block_byte_read_syscall);
@@ -2932,11 +3107,16 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_byte_write_checkpoint += WT_STAT_CONN_READ(from, block_byte_write_checkpoint);
     to->block_byte_write_mmap += WT_STAT_CONN_READ(from, block_byte_write_mmap);
     to->block_byte_write_syscall += WT_STAT_CONN_READ(from, block_byte_write_syscall);
+    to->block_write_combine += WT_STAT_CONN_READ(from, block_write_combine);
+    to->block_extlist_merge_walk += WT_STAT_CONN_READ(from, block_extlist_merge_walk);
     to->block_map_read += WT_STAT_CONN_READ(from, block_map_read);
     to->block_byte_map_read += WT_STAT_CONN_READ(from, block_byte_map_read);
     to->block_remap_file_resize += WT_STAT_CONN_READ(from, block_remap_file_resize);
     to->block_remap_file_write += WT_STAT_CONN_READ(from, block_remap_file_write);
+    to->cache_eviction_app_wait_exhausted +=
+      WT_STAT_CONN_READ(from, cache_eviction_app_wait_exhausted);
     to->cache_eviction_app_time += WT_STAT_CONN_READ(from, cache_eviction_app_time);
+    to->cache_eviction_app_wait += WT_STAT_CONN_READ(from, cache_eviction_app_wait);
     to->cache_read_app_count += WT_STAT_CONN_READ(from, cache_read_app_count);
     to->cache_read_app_time += WT_STAT_CONN_READ(from, cache_read_app_time);
     to->cache_write_app_count += WT_STAT_CONN_READ(from, cache_write_app_count);
@@ -2946,7 +3126,10 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_bytes_hs += WT_STAT_CONN_READ(from, cache_bytes_hs);
     to->cache_bytes_inuse += WT_STAT_CONN_READ(from, cache_bytes_inuse);
     to->cache_bytes_dirty_total += WT_STAT_CONN_READ(from, cache_bytes_dirty_total);
+    to->cache_slab_bytes_inuse += WT_STAT_CONN_READ(from, cache_slab_bytes_inuse);
+    to->cache_slab_bytes += WT_STAT_CONN_READ(from, cache_slab_bytes);
     to->cache_bytes_other += WT_STAT_CONN_READ(from, cache_bytes_other);
+    to->cache_slab_bytes_requested += WT_STAT_CONN_READ(from, cache_slab_bytes_requested);
     to->cache_bytes_read += WT_STAT_CONN_READ(from, cache_bytes_read);
     to->cache_bytes_write += WT_STAT_CONN_READ(from, cache_bytes_write);
     to->cache_eviction_blocked_checkpoint +=
@@ -2964,6 +3147,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_eviction_get_ref += WT_STAT_CONN_READ(from, cache_eviction_get_ref);
     to->cache_eviction_get_ref_empty += WT_STAT_CONN_READ(from, cache_eviction_get_ref_empty);
     to->cache_eviction_get_ref_empty2 += WT_STAT_CONN_READ(from, cache_eviction_get_ref_empty2);
+    to->cache_eviction_get_ref_steal += WT_STAT_CONN_READ(from, cache_eviction_get_ref_steal);
     to->cache_eviction_aggressive_set += WT_STAT_CONN_READ(from, cache_eviction_aggressive_set);
     to->cache_eviction_empty_score += WT_STAT_CONN_READ(from, cache_eviction_empty_score);
     to->cache_eviction_blocked_no_ts_checkpoint_race_1 +=
@@ -2978,11 +3162,24 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_CONN_READ(from, cache_eviction_blocked_remove_hs_race_with_checkpoint);
     to->cache_eviction_blocked_no_progress +=
       WT_STAT_CONN_READ(from, cache_eviction_blocked_no_progress);
+    to->cache_eviction_pacing_inuse_rate +=
+      WT_STAT_CONN_READ(from, cache_eviction_pacing_inuse_rate);
+    to->cache_eviction_pacing_dirty_rate +=
+      WT_STAT_CONN_READ(from, cache_eviction_pacing_dirty_rate);
+    to->cache_eviction_pacing_inuse_predicted +=
+      WT_STAT_CONN_READ(from, cache_eviction_pacing_inuse_predicted);
+    to->cache_eviction_pacing_dirty_predicted +=
+      WT_STAT_CONN_READ(from, cache_eviction_pacing_dirty_predicted);
     to->cache_eviction_walk_passes += WT_STAT_CONN_READ(from, cache_eviction_walk_passes);
+    to->cache_eviction_pacing_early += WT_STAT_CONN_READ(from, cache_eviction_pacing_early);
     to->cache_eviction_queue_empty += WT_STAT_CONN_READ(from, cache_eviction_queue_empty);
     to->cache_eviction_queue_not_empty += WT_STAT_CONN_READ(from, cache_eviction_queue_not_empty);
+    to->cache_eviction_server_rank_trees +=
+      WT_STAT_CONN_READ(from, cache_eviction_server_rank_trees);
     to->cache_eviction_server_skip_dirty_pages_during_checkpoint +=
       WT_STAT_CONN_READ(from, cache_eviction_server_skip_dirty_pages_during_checkpoint);
+    to->cache_eviction_server_skip_frequent_pages +=
+      WT_STAT_CONN_READ(from, cache_eviction_server_skip_frequent_pages);
     to->cache_eviction_server_skip_intl_page_with_active_child +=
       WT_STAT_CONN_READ(from, cache_eviction_server_skip_intl_page_with_active_child);
     to->cache_eviction_server_skip_metatdata_with_history +=
@@ -3001,11 +3198,19 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_CONN_READ(from, cache_eviction_server_skip_checkpointing_trees);
     to->cache_eviction_server_skip_trees_stick_in_cache +=
       WT_STAT_CONN_READ(from, cache_eviction_server_skip_trees_stick_in_cache);
+    to->cache_eviction_server_skip_trees_reserved +=
+      WT_STAT_CONN_READ(from, cache_eviction_server_skip_trees_reserved);
+    to->cache_eviction_server_skip_trees_under_quota +=
+      WT_STAT_CONN_READ(from, cache_eviction_server_skip_trees_under_quota);
     to->cache_eviction_server_skip_trees_eviction_disabled +=
       WT_STAT_CONN_READ(from, cache_eviction_server_skip_trees_eviction_disabled);
     to->cache_eviction_server_skip_trees_not_useful_before +=
       WT_STAT_CONN_READ(from, cache_eviction_server_skip_trees_not_useful_before);
     to->cache_eviction_server_slept += WT_STAT_CONN_READ(from, cache_eviction_server_slept);
+    to->cache_eviction_server_rank_trees_skipped +=
+      WT_STAT_CONN_READ(from, cache_eviction_server_rank_trees_skipped);
+    to->cache_eviction_server_rank_trees_ranked +=
+      WT_STAT_CONN_READ(from, cache_eviction_server_rank_trees_ranked);
     to->cache_eviction_slow += WT_STAT_CONN_READ(from, cache_eviction_slow);
     to->cache_eviction_walk_leaf_notfound +=
       WT_STAT_CONN_READ(from, cache_eviction_walk_leaf_notfound);
@@ -3163,6 +3368,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_reverse_splits += WT_STAT_CONN_READ(from, cache_reverse_splits);
     to->cache_reverse_splits_skipped_vlcs +=
       WT_STAT_CONN_READ(from, cache_reverse_splits_skipped_vlcs);
+    to->cache_slab_allocated += WT_STAT_CONN_READ(from, cache_slab_allocated);
+    to->cache_slab_freed += WT_STAT_CONN_READ(from, cache_slab_freed);
     to->cache_hs_insert_full_update += WT_STAT_CONN_READ(from, cache_hs_insert_full_update);
     to->cache_hs_insert_reverse_modify += WT_STAT_CONN_READ(from, cache_hs_insert_reverse_modify);
     to->cache_reentry_hs_eviction_milliseconds +=
@@ -3174,6 +3381,11 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_eviction_blocked_uncommitted_truncate +=
       WT_STAT_CONN_READ(from, cache_eviction_blocked_uncommitted_truncate);
     to->cache_eviction_clean += WT_STAT_CONN_READ(from, cache_eviction_clean);
+    to->cache_chain_trim_bytes += WT_STAT_CONN_READ(from, cache_chain_trim_bytes);
+    to->cache_chain_trim_updates += WT_STAT_CONN_READ(from, cache_chain_trim_updates);
+    to->cache_chain_trim_pages += WT_STAT_CONN_READ(from, cache_chain_trim_pages);
+    to->cache_chain_trim_pages_visited += WT_STAT_CONN_READ(from, cache_chain_trim_pages_visited);
+    to->cache_chain_trim_passes += WT_STAT_CONN_READ(from, cache_chain_trim_passes);
     to->fsync_all_fh_total += WT_STAT_CONN_READ(from, fsync_all_fh_total);
     to->fsync_all_fh += WT_STAT_CONN_READ(from, fsync_all_fh);
     to->fsync_all_time += WT_STAT_CONN_READ(from, fsync_all_time);
@@ -3248,13 +3460,18 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->checkpoint_obsolete_applied += WT_STAT_CONN_READ(from, checkpoint_obsolete_applied);
     to->checkpoint_wait_reduce_dirty += WT_STAT_CONN_READ(from, checkpoint_wait_reduce_dirty);
     to->chunkcache_spans_chunks_read += WT_STAT_CONN_READ(from, chunkcache_spans_chunks_read);
+    to->chunkcache_tinylfu_admitted += WT_STAT_CONN_READ(from, chunkcache_tinylfu_admitted);
     to->chunkcache_chunks_evicted += WT_STAT_CONN_READ(from, chunkcache_chunks_evicted);
+    to->chunkcache_tinylfu_rejected += WT_STAT_CONN_READ(from, chunkcache_tinylfu_rejected);
     to->chunkcache_exceeded_bitmap_capacity +=
       WT_STAT_CONN_READ(from, chunkcache_exceeded_bitmap_capacity);
     to->chunkcache_exceeded_capacity += WT_STAT_CONN_READ(from, chunkcache_exceeded_capacity);
     to->chunkcache_lookups += WT_STAT_CONN_READ(from, chunkcache_lookups);
     to->chunkcache_chunks_loaded_from_flushed_tables +=
       WT_STAT_CONN_READ(from, chunkcache_chunks_loaded_from_flushed_tables);
+    to->chunkcache_hits_read += WT_STAT_CONN_READ(from, chunkcache_hits_read);
+    to->chunkcache_hits_flushed += WT_STAT_CONN_READ(from, chunkcache_hits_flushed);
+    to->chunkcache_hits_metadata += WT_STAT_CONN_READ(from, chunkcache_hits_metadata);
     to->chunkcache_metadata_inserted += WT_STAT_CONN_READ(from, chunkcache_metadata_inserted);
     to->chunkcache_metadata_removed += WT_STAT_CONN_READ(from, chunkcache_metadata_removed);
     to->chunkcache_metadata_work_units_dropped +=
@@ -3458,6 +3675,20 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->log_compress_len += WT_STAT_CONN_READ(from, log_compress_len);
     to->log_slot_coalesced += WT_STAT_CONN_READ(from, log_slot_coalesced);
     to->log_close_yields += WT_STAT_CONN_READ(from, log_close_yields);
+    to->perf_hist_evictapp_latency_lt100 +=
+      WT_STAT_CONN_READ(from, perf_hist_evictapp_latency_lt100);
+    to->perf_hist_evictapp_latency_lt250 +=
+      WT_STAT_CONN_READ(from, perf_hist_evictapp_latency_lt250);
+    to->perf_hist_evictapp_latency_lt500 +=
+      WT_STAT_CONN_READ(from, perf_hist_evictapp_latency_lt500);
+    to->perf_hist_evictapp_latency_lt1000 +=
+      WT_STAT_CONN_READ(from, perf_hist_evictapp_latency_lt1000);
+    to->perf_hist_evictapp_latency_lt10000 +=
+      WT_STAT_CONN_READ(from, perf_hist_evictapp_latency_lt10000);
+    to->perf_hist_evictapp_latency_gt10000 +=
+      WT_STAT_CONN_READ(from, perf_hist_evictapp_latency_gt10000);
+    to->perf_hist_evictapp_latency_total_usecs +=
+      WT_STAT_CONN_READ(from, perf_hist_evictapp_latency_total_usecs);
     to->perf_hist_fsread_latency_lt10 += WT_STAT_CONN_READ(from, perf_hist_fsread_latency_lt10);
     to->perf_hist_fsread_latency_lt50 += WT_STAT_CONN_READ(from, perf_hist_fsread_latency_lt50);
     to->perf_hist_fsread_latency_lt100 += WT_STAT_CONN_READ(from, perf_hist_fsread_latency_lt100);
@@ -3514,6 +3745,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->prefetch_skipped_special_handle += WT_STAT_CONN_READ(from, prefetch_skipped_special_handle);
     to->prefetch_pages_fail += WT_STAT_CONN_READ(from, prefetch_pages_fail);
     to->prefetch_pages_queued += WT_STAT_CONN_READ(from, prefetch_pages_queued);
+    to->prefetch_pages_read_batch += WT_STAT_CONN_READ(from, prefetch_pages_read_batch);
     to->prefetch_pages_read += WT_STAT_CONN_READ(from, prefetch_pages_read);
     to->prefetch_skipped_error_ok += WT_STAT_CONN_READ(from, prefetch_skipped_error_ok);
     to->prefetch_attempts += WT_STAT_CONN_READ(from, prefetch_attempts);
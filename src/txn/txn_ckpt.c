@@ -1436,6 +1436,9 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
     if (full) {
         __checkpoint_stats(session);
 
+        /* Save the block cache's content for the next startup. Failing to do so isn't an error. */
+        WT_IGNORE_RET(__wt_blkcache_manifest_write(session));
+
         /*
          * If timestamps defined the checkpoint's content, set the saved last checkpoint timestamp,
          * otherwise clear it. We clear it for a couple of reasons: applications can query it and we
@@ -41,139 +41,144 @@ typedef struct {
 #define V_GLOBAL_BLOCK_CACHE_CACHE_ON_CHECKPOINT 7
 #define V_GLOBAL_BLOCK_CACHE_CACHE_ON_WRITES 8
 #define V_GLOBAL_BLOCK_CACHE_SIZE 9
-#define V_TABLE_BTREE_BITCNT 10
-#define V_TABLE_BTREE_COMPRESSION 11
-#define V_TABLE_BTREE_DICTIONARY 12
-#define V_TABLE_BTREE_INTERNAL_KEY_TRUNCATION 13
-#define V_TABLE_BTREE_INTERNAL_PAGE_MAX 14
-#define V_TABLE_BTREE_KEY_MAX 15
-#define V_TABLE_BTREE_KEY_MIN 16
-#define V_TABLE_BTREE_LEAF_PAGE_MAX 17
-#define V_TABLE_BTREE_MEMORY_PAGE_MAX 18
-#define V_TABLE_BTREE_PREFIX_LEN 19
-#define V_TABLE_BTREE_PREFIX_COMPRESSION 20
-#define V_TABLE_BTREE_PREFIX_COMPRESSION_MIN 21
-#define V_TABLE_BTREE_REPEAT_DATA_PCT 22
-#define V_TABLE_BTREE_REVERSE 23
-#define V_TABLE_BTREE_SPLIT_PCT 24
-#define V_TABLE_BTREE_VALUE_MAX 25
-#define V_TABLE_BTREE_VALUE_MIN 26
-#define V_GLOBAL_BUFFER_ALIGNMENT 27
-#define V_GLOBAL_CACHE 28
-#define V_GLOBAL_CACHE_EVICT_MAX 29
-#define V_GLOBAL_CACHE_EVICTION_DIRTY_TARGET 30
-#define V_GLOBAL_CACHE_EVICTION_DIRTY_TRIGGER 31
-#define V_GLOBAL_CACHE_MINIMUM 32
-#define V_GLOBAL_CHECKPOINT 33
-#define V_GLOBAL_CHECKPOINT_LOG_SIZE 34
-#define V_GLOBAL_CHECKPOINT_WAIT 35
-#define V_GLOBAL_CHUNK_CACHE 36
-#define V_GLOBAL_CHUNK_CACHE_CAPACITY 37
-#define V_GLOBAL_CHUNK_CACHE_CHUNK_SIZE 38
-#define V_GLOBAL_CHUNK_CACHE_STORAGE_PATH 39
-#define V_GLOBAL_CHUNK_CACHE_TYPE 40
-#define V_GLOBAL_COMPACT_FREE_SPACE_TARGET 41
-#define V_GLOBAL_DEBUG_CHECKPOINT_RETENTION 42
-#define V_GLOBAL_DEBUG_CURSOR_REPOSITION 43
-#define V_GLOBAL_DEBUG_EVICTION 44
-#define V_GLOBAL_DEBUG_LOG_RETENTION 45
-#define V_GLOBAL_DEBUG_REALLOC_EXACT 46
-#define V_GLOBAL_DEBUG_REALLOC_MALLOC 47
-#define V_GLOBAL_DEBUG_SLOW_CHECKPOINT 48
-#define V_GLOBAL_DEBUG_TABLE_LOGGING 49
-#define V_GLOBAL_DEBUG_UPDATE_RESTORE_EVICT 50
-#define V_TABLE_DISK_CHECKSUM 51
-#define V_GLOBAL_DISK_DATA_EXTEND 52
-#define V_GLOBAL_DISK_DIRECT_IO 53
-#define V_GLOBAL_DISK_ENCRYPTION 54
-#define V_TABLE_DISK_FIRSTFIT 55
-#define V_GLOBAL_DISK_MMAP 56
-#define V_GLOBAL_DISK_MMAP_ALL 57
-#define V_GLOBAL_FILE_MANAGER_CLOSE_HANDLE_MINIMUM 58
-#define V_GLOBAL_FILE_MANAGER_CLOSE_IDLE_TIME 59
-#define V_GLOBAL_FILE_MANAGER_CLOSE_SCAN_INTERVAL 60
-#define V_GLOBAL_FORMAT_ABORT 61
-#define V_GLOBAL_FORMAT_INDEPENDENT_THREAD_RNG 62
-#define V_GLOBAL_FORMAT_MAJOR_TIMEOUT 63
-#define V_GLOBAL_IMPORT 64
-#define V_GLOBAL_LOGGING 65
-#define V_GLOBAL_LOGGING_COMPRESSION 66
-#define V_GLOBAL_LOGGING_FILE_MAX 67
-#define V_GLOBAL_LOGGING_PREALLOC 68
-#define V_GLOBAL_LOGGING_REMOVE 69
-#define V_TABLE_LSM_AUTO_THROTTLE 70
-#define V_TABLE_LSM_BLOOM 71
-#define V_TABLE_LSM_BLOOM_BIT_COUNT 72
-#define V_TABLE_LSM_BLOOM_HASH_COUNT 73
-#define V_TABLE_LSM_BLOOM_OLDEST 74
-#define V_TABLE_LSM_CHUNK_SIZE 75
-#define V_TABLE_LSM_MERGE_MAX 76
-#define V_GLOBAL_LSM_WORKER_THREADS 77
-#define V_GLOBAL_OPS_ALTER 78
-#define V_GLOBAL_OPS_COMPACTION 79
-#define V_GLOBAL_OPS_HS_CURSOR 80
-#define V_TABLE_OPS_PARETO 81
-#define V_TABLE_OPS_PARETO_SKEW 82
-#define V_TABLE_OPS_PCT_DELETE 83
-#define V_TABLE_OPS_PCT_INSERT 84
-#define V_TABLE_OPS_PCT_MODIFY 85
-#define V_TABLE_OPS_PCT_READ 86
-#define V_TABLE_OPS_PCT_WRITE 87
-#define V_GLOBAL_OPS_BOUND_CURSOR 88
-#define V_GLOBAL_OPS_PREPARE 89
-#define V_GLOBAL_OPS_RANDOM_CURSOR 90
-#define V_GLOBAL_OPS_SALVAGE 91
-#define V_GLOBAL_OPS_THROTTLE 92
-#define V_GLOBAL_OPS_THROTTLE_SLEEP_US 93
-#define V_TABLE_OPS_TRUNCATE 94
-#define V_GLOBAL_OPS_VERIFY 95
-#define V_GLOBAL_PREFETCH 96
-#define V_GLOBAL_QUIET 97
-#define V_GLOBAL_RANDOM_DATA_SEED 98
-#define V_GLOBAL_RANDOM_EXTRA_SEED 99
-#define V_GLOBAL_RUNS_IN_MEMORY 100
-#define V_TABLE_RUNS_MIRROR 101
-#define V_GLOBAL_RUNS_OPS 102
-#define V_GLOBAL_RUNS_PREDICTABLE_REPLAY 103
-#define V_TABLE_RUNS_ROWS 104
-#define V_TABLE_RUNS_SOURCE 105
-#define V_GLOBAL_RUNS_TABLES 106
-#define V_GLOBAL_RUNS_THREADS 107
-#define V_GLOBAL_RUNS_TIMER 108
-#define V_TABLE_RUNS_TYPE 109
-#define V_GLOBAL_RUNS_VERIFY_FAILURE_DUMP 110
-#define V_GLOBAL_STATISTICS_MODE 111
-#define V_GLOBAL_STATISTICS_LOG_SOURCES 112
-#define V_GLOBAL_STRESS_AGGRESSIVE_STASH_FREE 113
-#define V_GLOBAL_STRESS_AGGRESSIVE_SWEEP 114
-#define V_GLOBAL_STRESS_CHECKPOINT 115
-#define V_GLOBAL_STRESS_CHECKPOINT_EVICT_PAGE 116
-#define V_GLOBAL_STRESS_CHECKPOINT_PREPARE 117
-#define V_GLOBAL_STRESS_COMPACT_SLOW 118
-#define V_GLOBAL_STRESS_EVICT_REPOSITION 119
-#define V_GLOBAL_STRESS_FAILPOINT_EVICTION_SPLIT 120
-#define V_GLOBAL_STRESS_FAILPOINT_HS_DELETE_KEY_FROM_TS 121
-#define V_GLOBAL_STRESS_HS_CHECKPOINT_DELAY 122
-#define V_GLOBAL_STRESS_HS_SEARCH 123
-#define V_GLOBAL_STRESS_HS_SWEEP 124
-#define V_GLOBAL_STRESS_PREFETCH_DELAY 125
-#define V_GLOBAL_STRESS_PREPARE_RESOLUTION_1 126
-#define V_GLOBAL_STRESS_SLEEP_BEFORE_READ_OVERFLOW_ONPAGE 127
-#define V_GLOBAL_STRESS_SPLIT_1 128
-#define V_GLOBAL_STRESS_SPLIT_2 129
-#define V_GLOBAL_STRESS_SPLIT_3 130
-#define V_GLOBAL_STRESS_SPLIT_4 131
-#define V_GLOBAL_STRESS_SPLIT_5 132
-#define V_GLOBAL_STRESS_SPLIT_6 133
-#define V_GLOBAL_STRESS_SPLIT_7 134
-#define V_GLOBAL_STRESS_SPLIT_8 135
-#define V_GLOBAL_TIERED_STORAGE_FLUSH_FREQUENCY 136
-#define V_GLOBAL_TIERED_STORAGE_STORAGE_SOURCE 137
-#define V_GLOBAL_TRANSACTION_IMPLICIT 138
-#define V_GLOBAL_TRANSACTION_OPERATION_TIMEOUT_MS 139
-#define V_GLOBAL_TRANSACTION_TIMESTAMPS 140
-#define V_GLOBAL_WIREDTIGER_CONFIG 141
-#define V_GLOBAL_WIREDTIGER_RWLOCK 142
-#define V_GLOBAL_WIREDTIGER_LEAK_MEMORY 143
+#define V_GLOBAL_BLOCK_CACHE_VICTIM_CACHE 10
+#define V_GLOBAL_BLOCK_CACHE_WARM_RESTART 11
+#define V_TABLE_BTREE_BITCNT 12
+#define V_TABLE_BTREE_COMPRESSION 13
+#define V_TABLE_BTREE_DICTIONARY 14
+#define V_TABLE_BTREE_INTERNAL_KEY_TRUNCATION 15
+#define V_TABLE_BTREE_INTERNAL_PAGE_MAX 16
+#define V_TABLE_BTREE_KEY_MAX 17
+#define V_TABLE_BTREE_KEY_MIN 18
+#define V_TABLE_BTREE_LEAF_PAGE_MAX 19
+#define V_TABLE_BTREE_MEMORY_PAGE_MAX 20
+#define V_TABLE_BTREE_PREFIX_LEN 21
+#define V_TABLE_BTREE_PREFIX_COMPRESSION 22
+#define V_TABLE_BTREE_PREFIX_COMPRESSION_MIN 23
+#define V_TABLE_BTREE_REPEAT_DATA_PCT 24
+#define V_TABLE_BTREE_REVERSE 25
+#define V_TABLE_BTREE_SPLIT_PCT 26
+#define V_TABLE_BTREE_VALUE_MAX 27
+#define V_TABLE_BTREE_VALUE_MIN 28
+#define V_GLOBAL_BUFFER_ALIGNMENT 29
+#define V_GLOBAL_CACHE 30
+#define V_GLOBAL_CACHE_CHAIN_TRIM 31
+#define V_GLOBAL_CACHE_EVICT_MAX 32
+#define V_GLOBAL_CACHE_EVICT_RANK_TREES 33
+#define V_GLOBAL_CACHE_EVICTION_DIRTY_TARGET 34
+#define V_GLOBAL_CACHE_EVICTION_DIRTY_TRIGGER 35
+#define V_GLOBAL_CACHE_MINIMUM 36
+#define V_GLOBAL_CACHE_SLAB 37
+#define V_GLOBAL_CHECKPOINT 38
+#define V_GLOBAL_CHECKPOINT_LOG_SIZE 39
+#define V_GLOBAL_CHECKPOINT_WAIT 40
+#define V_GLOBAL_CHUNK_CACHE 41
+#define V_GLOBAL_CHUNK_CACHE_CAPACITY 42
+#define V_GLOBAL_CHUNK_CACHE_CHUNK_SIZE 43
+#define V_GLOBAL_CHUNK_CACHE_STORAGE_PATH 44
+#define V_GLOBAL_CHUNK_CACHE_TYPE 45
+#define V_GLOBAL_COMPACT_FREE_SPACE_TARGET 46
+#define V_GLOBAL_DEBUG_CHECKPOINT_RETENTION 47
+#define V_GLOBAL_DEBUG_CURSOR_REPOSITION 48
+#define V_GLOBAL_DEBUG_EVICTION 49
+#define V_GLOBAL_DEBUG_LOG_RETENTION 50
+#define V_GLOBAL_DEBUG_REALLOC_EXACT 51
+#define V_GLOBAL_DEBUG_REALLOC_MALLOC 52
+#define V_GLOBAL_DEBUG_SLOW_CHECKPOINT 53
+#define V_GLOBAL_DEBUG_TABLE_LOGGING 54
+#define V_GLOBAL_DEBUG_UPDATE_RESTORE_EVICT 55
+#define V_TABLE_DISK_CHECKSUM 56
+#define V_GLOBAL_DISK_DATA_EXTEND 57
+#define V_GLOBAL_DISK_DIRECT_IO 58
+#define V_GLOBAL_DISK_ENCRYPTION 59
+#define V_TABLE_DISK_FIRSTFIT 60
+#define V_GLOBAL_DISK_MMAP 61
+#define V_GLOBAL_DISK_MMAP_ALL 62
+#define V_GLOBAL_FILE_MANAGER_CLOSE_HANDLE_MINIMUM 63
+#define V_GLOBAL_FILE_MANAGER_CLOSE_IDLE_TIME 64
+#define V_GLOBAL_FILE_MANAGER_CLOSE_SCAN_INTERVAL 65
+#define V_GLOBAL_FORMAT_ABORT 66
+#define V_GLOBAL_FORMAT_INDEPENDENT_THREAD_RNG 67
+#define V_GLOBAL_FORMAT_MAJOR_TIMEOUT 68
+#define V_GLOBAL_IMPORT 69
+#define V_GLOBAL_LOGGING 70
+#define V_GLOBAL_LOGGING_COMPRESSION 71
+#define V_GLOBAL_LOGGING_FILE_MAX 72
+#define V_GLOBAL_LOGGING_PREALLOC 73
+#define V_GLOBAL_LOGGING_REMOVE 74
+#define V_TABLE_LSM_AUTO_THROTTLE 75
+#define V_TABLE_LSM_BLOOM 76
+#define V_TABLE_LSM_BLOOM_BIT_COUNT 77
+#define V_TABLE_LSM_BLOOM_HASH_COUNT 78
+#define V_TABLE_LSM_BLOOM_OLDEST 79
+#define V_TABLE_LSM_CHUNK_SIZE 80
+#define V_TABLE_LSM_MERGE_MAX 81
+#define V_GLOBAL_LSM_WORKER_THREADS 82
+#define V_GLOBAL_OPS_ALTER 83
+#define V_GLOBAL_OPS_COMPACTION 84
+#define V_GLOBAL_OPS_HS_CURSOR 85
+#define V_TABLE_OPS_PARETO 86
+#define V_TABLE_OPS_PARETO_SKEW 87
+#define V_TABLE_OPS_PCT_DELETE 88
+#define V_TABLE_OPS_PCT_INSERT 89
+#define V_TABLE_OPS_PCT_MODIFY 90
+#define V_TABLE_OPS_PCT_READ 91
+#define V_TABLE_OPS_PCT_WRITE 92
+#define V_GLOBAL_OPS_BOUND_CURSOR 93
+#define V_GLOBAL_OPS_PREPARE 94
+#define V_GLOBAL_OPS_RANDOM_CURSOR 95
+#define V_GLOBAL_OPS_SALVAGE 96
+#define V_GLOBAL_OPS_THROTTLE 97
+#define V_GLOBAL_OPS_THROTTLE_SLEEP_US 98
+#define V_TABLE_OPS_TRUNCATE 99
+#define V_GLOBAL_OPS_VERIFY 100
+#define V_GLOBAL_PREFETCH 101
+#define V_GLOBAL_QUIET 102
+#define V_GLOBAL_RANDOM_DATA_SEED 103
+#define V_GLOBAL_RANDOM_EXTRA_SEED 104
+#define V_GLOBAL_RUNS_IN_MEMORY 105
+#define V_TABLE_RUNS_MIRROR 106
+#define V_GLOBAL_RUNS_OPS 107
+#define V_GLOBAL_RUNS_PREDICTABLE_REPLAY 108
+#define V_TABLE_RUNS_ROWS 109
+#define V_TABLE_RUNS_SOURCE 110
+#define V_GLOBAL_RUNS_TABLES 111
+#define V_GLOBAL_RUNS_THREADS 112
+#define V_GLOBAL_RUNS_TIMER 113
+#define V_TABLE_RUNS_TYPE 114
+#define V_GLOBAL_RUNS_VERIFY_FAILURE_DUMP 115
+#define V_GLOBAL_STATISTICS_MODE 116
+#define V_GLOBAL_STATISTICS_LOG_SOURCES 117
+#define V_GLOBAL_STRESS_AGGRESSIVE_STASH_FREE 118
+#define V_GLOBAL_STRESS_AGGRESSIVE_SWEEP 119
+#define V_GLOBAL_STRESS_CHECKPOINT 120
+#define V_GLOBAL_STRESS_CHECKPOINT_EVICT_PAGE 121
+#define V_GLOBAL_STRESS_CHECKPOINT_PREPARE 122
+#define V_GLOBAL_STRESS_COMPACT_SLOW 123
+#define V_GLOBAL_STRESS_EVICT_REPOSITION 124
+#define V_GLOBAL_STRESS_FAILPOINT_EVICTION_SPLIT 125
+#define V_GLOBAL_STRESS_FAILPOINT_HS_DELETE_KEY_FROM_TS 126
+#define V_GLOBAL_STRESS_HS_CHECKPOINT_DELAY 127
+#define V_GLOBAL_STRESS_HS_SEARCH 128
+#define V_GLOBAL_STRESS_HS_SWEEP 129
+#define V_GLOBAL_STRESS_PREFETCH_DELAY 130
+#define V_GLOBAL_STRESS_PREPARE_RESOLUTION_1 131
+#define V_GLOBAL_STRESS_SLEEP_BEFORE_READ_OVERFLOW_ONPAGE 132
+#define V_GLOBAL_STRESS_SPLIT_1 133
+#define V_GLOBAL_STRESS_SPLIT_2 134
+#define V_GLOBAL_STRESS_SPLIT_3 135
+#define V_GLOBAL_STRESS_SPLIT_4 136
+#define V_GLOBAL_STRESS_SPLIT_5 137
+#define V_GLOBAL_STRESS_SPLIT_6 138
+#define V_GLOBAL_STRESS_SPLIT_7 139
+#define V_GLOBAL_STRESS_SPLIT_8 140
+#define V_GLOBAL_TIERED_STORAGE_FLUSH_FREQUENCY 141
+#define V_GLOBAL_TIERED_STORAGE_STORAGE_SOURCE 142
+#define V_GLOBAL_TRANSACTION_IMPLICIT 143
+#define V_GLOBAL_TRANSACTION_OPERATION_TIMEOUT_MS 144
+#define V_GLOBAL_TRANSACTION_TIMESTAMPS 145
+#define V_GLOBAL_WIREDTIGER_CONFIG 146
+#define V_GLOBAL_WIREDTIGER_RWLOCK 147
+#define V_GLOBAL_WIREDTIGER_LEAK_MEMORY 148
 
-#define V_ELEMENT_COUNT 144
+#define V_ELEMENT_COUNT 149
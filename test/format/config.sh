@@ -93,6 +93,10 @@ CONFIG configuration_list[] = {
 
 {"block_cache.size", "block cache size (MB)", 0x0, 1, 100, 100 * 1024}
 
+{"block_cache.victim_cache", "block cache: keep the blocks of pages evicted from the cache", C_BOOL, 30, 0, 0}
+
+{"block_cache.warm_restart", "block cache: reload the cache content on restart", C_BOOL, 30, 0, 0}
+
 {"btree.bitcnt", "fixed-length column-store object size (number of bits)", C_TABLE | C_TYPE_FIX, 1, 8, 8}
 
 {"btree.compression", "data compression (off | lz4 | snappy | zlib | zstd)", C_IGNORE | C_STRING | C_TABLE, 0, 0, 0}
@@ -131,14 +135,20 @@ CONFIG configuration_list[] = {
 
 {"cache", "cache size (MB)", 0x0, 1, 100, 100 * 1024}
 
+{"cache.chain_trim", "trim obsolete updates from long update chains in the background", C_BOOL, 20, 0, 0}
+
 {"cache.evict_max", "maximum number of eviction workers", 0x0, 0, 5, 100}
 
+{"cache.evict_rank_trees", "choose trees for eviction walks by their eviction candidates", C_BOOL, 20, 0, 0}
+
 {"cache.eviction_dirty_target", "dirty content target for eviction", C_IGNORE, 0, 0, 100}
 
 {"cache.eviction_dirty_trigger", "dirty content trigger for eviction", C_IGNORE, 0, 0, 100}
 
 {"cache.minimum", "minimum cache size (MB)", C_IGNORE, 0, 0, 100 * 1024}
 
+{"cache.slab", "allocate page images from cache slabs", C_BOOL, 20, 0, 0}
+
 {"checkpoint", "checkpoint type (on | off | wiredtiger)", C_IGNORE | C_STRING, 0, 0, 0}
 
 {"checkpoint.log_size", "MB of log to wait if wiredtiger checkpoints configured", 0x0, 20, 200, 1024}
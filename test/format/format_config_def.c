@@ -29,6 +29,12 @@ CONFIG configuration_list[] = {{"assert.read_timestamp", "assert read_timestamp"
 
   {"block_cache.size", "block cache size (MB)", 0x0, 1, 100, 100 * 1024, V_GLOBAL_BLOCK_CACHE_SIZE},
 
+  {"block_cache.victim_cache", "block cache: keep the blocks of pages evicted from the cache",
+    C_BOOL, 30, 0, 0, V_GLOBAL_BLOCK_CACHE_VICTIM_CACHE},
+
+  {"block_cache.warm_restart", "block cache: reload the cache content on restart", C_BOOL, 30, 0,
+    0, V_GLOBAL_BLOCK_CACHE_WARM_RESTART},
+
   {"btree.bitcnt", "fixed-length column-store object size (number of bits)", C_TABLE | C_TYPE_FIX,
     1, 8, 8, V_TABLE_BTREE_BITCNT},
 
@@ -85,9 +91,15 @@ CONFIG configuration_list[] = {{"assert.read_timestamp", "assert read_timestamp"
 
   {"cache", "cache size (MB)", 0x0, 1, 100, 100 * 1024, V_GLOBAL_CACHE},
 
+  {"cache.chain_trim", "trim obsolete updates from long update chains in the background", C_BOOL,
+    20, 0, 0, V_GLOBAL_CACHE_CHAIN_TRIM},
+
   {"cache.evict_max", "maximum number of eviction workers", 0x0, 0, 5, 100,
     V_GLOBAL_CACHE_EVICT_MAX},
 
+  {"cache.evict_rank_trees", "choose trees for eviction walks by their eviction candidates", C_BOOL,
+    20, 0, 0, V_GLOBAL_CACHE_EVICT_RANK_TREES},
+
   {"cache.eviction_dirty_target", "dirty content target for eviction", C_IGNORE, 0, 0, 100,
     V_GLOBAL_CACHE_EVICTION_DIRTY_TARGET},
 
@@ -96,6 +108,8 @@ CONFIG configuration_list[] = {{"assert.read_timestamp", "assert read_timestamp"
 
   {"cache.minimum", "minimum cache size (MB)", C_IGNORE, 0, 0, 100 * 1024, V_GLOBAL_CACHE_MINIMUM},
 
+  {"cache.slab", "allocate page images from cache slabs", C_BOOL, 20, 0, 0, V_GLOBAL_CACHE_SLAB},
+
   {"checkpoint", "checkpoint type (on | off | wiredtiger)", C_IGNORE | C_STRING, 0, 0, 0,
     V_GLOBAL_CHECKPOINT},
 
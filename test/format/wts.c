@@ -378,6 +378,14 @@ create_database(const char *home, WT_CONNECTION **connp)
     if (GV(CACHE_EVICTION_DIRTY_TRIGGER) != 0)
         CONFIG_APPEND(p, ",eviction_dirty_trigger=%" PRIu32, GV(CACHE_EVICTION_DIRTY_TRIGGER));
 
+    /* Cache slab configuration. */
+    if (GV(CACHE_SLAB))
+        CONFIG_APPEND(p, ",cache_slab=(enabled=true)");
+
+    /* Background update chain trimming configuration. */
+    if (GV(CACHE_CHAIN_TRIM))
+        CONFIG_APPEND(p, ",chain_trim=(enabled=true)");
+
     /* Statistics log configuration. */
     sources = GVS(STATISTICS_LOG_SOURCES);
     if (strcmp(sources, "off") != 0)
@@ -395,17 +403,24 @@ create_database(const char *home, WT_CONNECTION **connp)
           ",block_cache=(enabled=true,type=\"dram\""
           ",cache_on_checkpoint=%s"
           ",cache_on_writes=%s"
-          ",size=%" PRIu32 "MB)",
+          ",size=%" PRIu32 "MB"
+          ",victim_cache=%s"
+          ",warm_restart=%s)",
           GV(BLOCK_CACHE_CACHE_ON_CHECKPOINT) == 0 ? "false" : "true",
-          GV(BLOCK_CACHE_CACHE_ON_WRITES) == 0 ? "false" : "true", GV(BLOCK_CACHE_SIZE));
+          GV(BLOCK_CACHE_CACHE_ON_WRITES) == 0 ? "false" : "true", GV(BLOCK_CACHE_SIZE),
+          GV(BLOCK_CACHE_VICTIM_CACHE) == 0 ? "false" : "true",
+          GV(BLOCK_CACHE_WARM_RESTART) == 0 ? "false" : "true");
 
     /* LSM configuration. */
     if (g.lsm_config)
         CONFIG_APPEND(p, ",lsm_manager=(worker_thread_max=%" PRIu32 "),", GV(LSM_WORKER_THREADS));
 
     /* Eviction configuration. */
+    CONFIG_APPEND(p, ",eviction=(tree_selection=%s",
+      GV(CACHE_EVICT_RANK_TREES) ? "ranked" : "round_robin");
     if (GV(CACHE_EVICT_MAX) != 0)
-        CONFIG_APPEND(p, ",eviction=(threads_max=%" PRIu32 ")", GV(CACHE_EVICT_MAX));
+        CONFIG_APPEND(p, ",threads_max=%" PRIu32, GV(CACHE_EVICT_MAX));
+    CONFIG_APPEND(p, ")");
 
     /* Logging configuration. */
     if (GV(LOGGING)) {
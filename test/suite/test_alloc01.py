@@ -0,0 +1,118 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wttest
+from wtdataset import SimpleDataSet
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_alloc01.py
+#
+# Test block allocation policies: a table mixing small and large values is rewritten across
+# several checkpoints, and with segregated allocation the per-size class statistics must account
+# for the file's available space. The data must survive a restart and pass verification.
+class test_alloc01(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=50MB,statistics=(all)'
+    nrows = 2000
+
+    alloc_values = [
+        ('best', dict(block_allocation='best')),
+        ('first', dict(block_allocation='first')),
+        ('segregated', dict(block_allocation='segregated')),
+    ]
+    scenarios = make_scenarios(alloc_values)
+
+    def value(self, prefix, i):
+        # Every tenth value is large enough to be written as an overflow item.
+        return prefix + str(i) * (2000 if i % 10 == 0 else 1)
+
+    def get_stat(self, uri, stat_key):
+        stat_cursor = self.session.open_cursor('statistics:' + uri, None, 'statistics=(all)')
+        value = stat_cursor[stat_key][2]
+        stat_cursor.close()
+        return value
+
+    def check(self, uri, ds, prefix):
+        cursor = self.session.open_cursor(uri)
+        for i in range(self.nrows):
+            self.assertEqual(cursor[ds.key(i + 1)], self.value(prefix, i))
+        cursor.close()
+
+    def test_alloc(self):
+        uri = 'table:alloc01'
+        ds = SimpleDataSet(self, uri, 0, key_format='S', value_format='S',
+            config='allocation_size=512,leaf_page_max=4KB,leaf_value_max=1KB,' +
+            'block_allocation=' + self.block_allocation)
+        ds.populate()
+
+        # Rewrite the table several times, removing some of the rows in between so extents of
+        # different sizes become available.
+        for prefix in ['aaaa', 'bbbb', 'cccc', 'dddd']:
+            cursor = self.session.open_cursor(uri)
+            for i in range(self.nrows):
+                cursor[ds.key(i + 1)] = self.value(prefix, i)
+            cursor.close()
+            self.session.checkpoint()
+            cursor = self.session.open_cursor(uri)
+            for i in range(0, self.nrows, 7):
+                cursor.set_key(ds.key(i + 1))
+                self.assertEqual(cursor.remove(), 0)
+            cursor.close()
+            self.session.checkpoint()
+            cursor = self.session.open_cursor(uri)
+            for i in range(0, self.nrows, 7):
+                cursor[ds.key(i + 1)] = self.value(prefix, i)
+            cursor.close()
+            self.session.checkpoint()
+
+        # The per-size class statistics cover all of the available space in the file.
+        classes = [
+            (stat.dsrc.block_avail_4kb, stat.dsrc.block_avail_4kb_bytes),
+            (stat.dsrc.block_avail_32kb, stat.dsrc.block_avail_32kb_bytes),
+            (stat.dsrc.block_avail_1mb, stat.dsrc.block_avail_1mb_bytes),
+            (stat.dsrc.block_avail_large, stat.dsrc.block_avail_large_bytes),
+        ]
+        avail_bytes = 0
+        for count_key, bytes_key in classes:
+            count = self.get_stat(uri, count_key)
+            nbytes = self.get_stat(uri, bytes_key)
+            self.assertEqual(count == 0, nbytes == 0)
+            avail_bytes += nbytes
+        self.assertEqual(avail_bytes, self.get_stat(uri, stat.dsrc.block_reuse_bytes))
+
+        if self.block_allocation != 'segregated':
+            self.assertEqual(self.get_stat(uri, stat.dsrc.block_alloc_segregated_extend), 0)
+
+        # Restart and check the data made it to the file.
+        self.reopen_conn()
+        self.check(uri, ds, 'dddd')
+        self.session.verify(uri)
+
+if __name__ == '__main__':
+    wttest.run()
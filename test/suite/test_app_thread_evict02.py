@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wiredtiger import stat
+
+# test_app_thread_evict02.py
+# Test application threads with an eviction wait budget: they should wait for the eviction threads
+# rather than evicting pages themselves until the budget runs out, and the time they spend in
+# eviction should be recorded in the histogram statistics.
+class test_app_thread_evict02(wttest.WiredTigerTestCase):
+    uri = 'table:test_app_thread_evict02'
+    conn_config = 'cache_size=20MB,statistics=(fast),' \
+        'eviction=(threads_min=2,threads_max=2,app_wait_ms=1000)'
+
+    hist_stats = [
+        stat.conn.perf_hist_evictapp_latency_lt100,
+        stat.conn.perf_hist_evictapp_latency_lt250,
+        stat.conn.perf_hist_evictapp_latency_lt500,
+        stat.conn.perf_hist_evictapp_latency_lt1000,
+        stat.conn.perf_hist_evictapp_latency_lt10000,
+        stat.conn.perf_hist_evictapp_latency_gt10000,
+    ]
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def load(self, start, nrows):
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(start, start + nrows):
+            self.session.begin_transaction()
+            cursor[i] = 'a' * 1000
+            self.session.commit_transaction()
+        cursor.close()
+
+    def test_app_thread_evict02(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+
+        # Write several times the cache size, the application thread has to wait on eviction.
+        self.load(1, 100000)
+
+        app_ops = self.get_stat(stat.conn.application_cache_ops)
+        self.assertGreater(app_ops, 0)
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_app_wait), 0)
+        self.assertEqual(sum(self.get_stat(s) for s in self.hist_stats), app_ops)
+
+        # Application threads only evict pages once the wait budget is used up.
+        if self.get_stat(stat.conn.cache_eviction_app_wait_exhausted) == 0:
+            self.assertEqual(self.get_stat(stat.conn.cache_eviction_app_attempt), 0)
+
+        # Without a budget, application threads go back to evicting pages themselves.
+        self.conn.reconfigure('eviction=(app_wait_ms=0)')
+        waits = self.get_stat(stat.conn.cache_eviction_app_wait)
+        self.load(100001, 100000)
+        self.assertEqual(self.get_stat(stat.conn.cache_eviction_app_wait), waits)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,95 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest, time
+from wiredtiger import stat
+
+# test_cache_slab01.py
+'''
+Check page images read into the cache are allocated from cache slabs when configured: reads through
+a cache smaller than the table should return the right values while slabs are reused, and the slab
+statistics should account for the images held.
+'''
+class test_cache_slab01(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=20MB,statistics=(fast),cache_slab=(enabled=true)'
+    uri = 'table:test_cache_slab01'
+    nrows = 20000
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def value(self, i):
+        return str(i) * (1 + i % 300)
+
+    def test_cache_slab(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S,leaf_page_max=32KB')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows + 1):
+            cursor[i] = self.value(i)
+        cursor.close()
+
+        # Write the pages and start with an empty cache, so the pages are read from disk.
+        self.reopen_conn()
+        self.assertEqual(self.get_stat(stat.conn.cache_slab_bytes_inuse), 0)
+
+        # Read the table a few times, the cache is too small to hold it.
+        for _ in range(3):
+            cursor = self.session.open_cursor(self.uri)
+            for i in range(1, self.nrows + 1):
+                self.assertEqual(cursor[i], self.value(i))
+            cursor.close()
+
+        slab_bytes = self.get_stat(stat.conn.cache_slab_bytes)
+        inuse = self.get_stat(stat.conn.cache_slab_bytes_inuse)
+        requested = self.get_stat(stat.conn.cache_slab_bytes_requested)
+        self.assertGreater(self.get_stat(stat.conn.cache_slab_allocated), 0)
+        self.assertGreater(requested, 0)
+        self.assertGreaterEqual(inuse, requested)
+        self.assertGreaterEqual(slab_bytes, inuse)
+
+        # The cache holds more than the page images in slabs.
+        self.assertLessEqual(inuse, self.get_stat(stat.conn.cache_bytes_inuse))
+
+    def test_cache_slab_disabled(self):
+        self.reopen_conn(config='cache_size=20MB,statistics=(fast)')
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, 1001):
+            cursor[i] = self.value(i)
+        cursor.close()
+        self.reopen_conn(config='cache_size=20MB,statistics=(fast)')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, 1001):
+            self.assertEqual(cursor[i], self.value(i))
+        cursor.close()
+        self.assertEqual(self.get_stat(stat.conn.cache_slab_bytes), 0)
+        self.assertEqual(self.get_stat(stat.conn.cache_slab_allocated), 0)
@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import time
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_chain_trim01.py
+'''
+Check background update chain trimming: keys updated many times while a reader pins old versions
+build long update chains that can't be trimmed when they are updated, once the reader is gone and
+the keys are no longer updated the update chain trim thread should remove the obsolete updates
+without evicting the page, and readers should still see the latest values.
+'''
+class test_chain_trim01(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=100MB,statistics=(all),chain_trim=(enabled=true,wait_ms=10)'
+    uri = 'table:test_chain_trim01'
+
+    format_values = [
+        ('column', dict(key_format='r')),
+        ('row', dict(key_format='i')),
+    ]
+    scenarios = make_scenarios(format_values)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_chain_trim(self):
+        self.session.create(self.uri, 'key_format={},value_format=S'.format(self.key_format))
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, 1001):
+            cursor[i] = 'init'
+
+        # Pin the original values with a reader, so updates can't be trimmed as they're made.
+        reader = self.conn.open_session()
+        reader_cursor = reader.open_cursor(self.uri)
+        reader.begin_transaction()
+        self.assertEqual(reader_cursor[1], 'init')
+
+        for j in range(300):
+            for i in range(10, 1001, 10):
+                cursor[i] = 'value-{}-{}'.format(i, j)
+
+        reader.rollback_transaction()
+        reader_cursor.close()
+        reader.close()
+
+        # Wait for the background thread to remove the obsolete updates.
+        for _ in range(600):
+            if self.get_stat(stat.conn.cache_chain_trim_updates) > 0:
+                break
+            time.sleep(0.1)
+        self.assertGreater(self.get_stat(stat.conn.cache_chain_trim_updates), 0)
+        self.assertGreater(self.get_stat(stat.conn.cache_chain_trim_bytes), 0)
+        self.assertEqual(self.get_stat(stat.conn.cache_eviction_force_long_update_list), 0)
+
+        for i in range(1, 1001):
+            if i % 10 == 0:
+                self.assertEqual(cursor[i], 'value-{}-299'.format(i))
+            else:
+                self.assertEqual(cursor[i], 'init')
+        cursor.close()
+
+        # Turning trimming off stops the thread.
+        self.conn.reconfigure('chain_trim=(enabled=false)')
+        passes = self.get_stat(stat.conn.cache_chain_trim_passes)
+        time.sleep(0.2)
+        self.assertEqual(self.get_stat(stat.conn.cache_chain_trim_passes), passes)
+
+if __name__ == '__main__':
+    wttest.run()
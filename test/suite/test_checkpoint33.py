@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wttest
+from wtdataset import SimpleDataSet
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_checkpoint33.py
+#
+# Test combining adjacent checkpoint writes: data written by a checkpoint must be readable through
+# a checkpoint cursor, after a restart, and pass verification.
+class test_checkpoint33(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=50MB,statistics=(all)'
+    nrows = 20000
+
+    format_values = [
+        ('column', dict(key_format='r', value_format='S')),
+        ('row', dict(key_format='S', value_format='S')),
+    ]
+    combine_values = [
+        ('off', dict(write_combine_max=0)),
+        ('small', dict(write_combine_max=16384)),
+        ('large', dict(write_combine_max=1048576)),
+    ]
+    scenarios = make_scenarios(format_values, combine_values)
+
+    def get_stat(self, stat_key):
+        stat_cursor = self.session.open_cursor('statistics:')
+        value = stat_cursor[stat_key][2]
+        stat_cursor.close()
+        return value
+
+    def check(self, uri, ds, value, cursor_config=None):
+        cursor = self.session.open_cursor(uri, None, cursor_config)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, value + str(count))
+            count += 1
+        self.assertEqual(count, self.nrows)
+        cursor.close()
+
+    def test_checkpoint_write_combine(self):
+        uri = 'table:checkpoint33'
+        ds = SimpleDataSet(self, uri, 0, key_format=self.key_format, value_format=self.value_format,
+            config='leaf_page_max=4KB,write_combine_max={}'.format(self.write_combine_max))
+        ds.populate()
+
+        # Write two checkpoints, the second overwrites most of the first.
+        for value in ['aaaa', 'bbbb']:
+            cursor = self.session.open_cursor(uri)
+            for i in range(self.nrows):
+                cursor[ds.key(i + 1)] = value + str(i)
+            cursor.close()
+            self.session.checkpoint()
+        self.check(uri, ds, 'bbbb', 'checkpoint=WiredTigerCheckpoint')
+
+        combined = self.get_stat(stat.conn.block_write_combine)
+        combined_blocks = self.get_stat(stat.conn.block_write_combine_blocks)
+        if self.write_combine_max == 0:
+            self.assertEqual(combined, 0)
+            self.assertEqual(combined_blocks, 0)
+        else:
+            self.assertGreater(combined, 0)
+            self.assertGreater(combined_blocks, combined)
+
+        # Restart and check the data made it to the file.
+        self.reopen_conn()
+        self.check(uri, ds, 'bbbb')
+        self.session.verify(uri)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -33,7 +33,7 @@ import threading
 import time
 import wiredtiger, wttest
 
-from test_chunkcache01 import stat_assert_greater
+from test_chunkcache01 import get_stat, stat_assert_greater
 from wtdataset import SimpleDataSet
 from wtscenario import make_scenarios
 
@@ -64,15 +64,21 @@ class test_chunkcache02(wttest.WiredTigerTestCase):
         # WT's filesystem layer doesn't support mmap on big-endian platforms.
         cache_types.append(('on-disk', dict(chunk_cache_type='FILE')))
 
-    scenarios = make_scenarios(format_values, cache_types, io_capacities)
+    policies = [
+        ('clock', dict(policy='clock')),
+        ('tinylfu', dict(policy='tinylfu')),
+    ]
+
+    scenarios = make_scenarios(format_values, cache_types, io_capacities, policies)
 
     def conn_config(self):
         if not os.path.exists('bucket2'):
             os.mkdir('bucket2')
 
         return 'tiered_storage=(auth_token=Secret,bucket=bucket2,bucket_prefix=pfx_,name=dir_store),' \
-            'chunk_cache=[enabled=true,chunk_size=512KB,capacity=20MB,type={},storage_path=WiredTigerChunkCache],' \
-            'io_capacity=(total=100G,chunk_cache={})'.format(self.chunk_cache_type, self.io_capacity)
+            'chunk_cache=[enabled=true,chunk_size=512KB,capacity=20MB,type={},storage_path=WiredTigerChunkCache,policy={}],' \
+            'io_capacity=(total=100G,chunk_cache={})'.format(
+                self.chunk_cache_type, self.policy, self.io_capacity)
 
     def conn_extensions(self, extlist):
         if os.name == 'nt':
@@ -127,3 +133,10 @@ class test_chunkcache02(wttest.WiredTigerTestCase):
         # Check relevant chunk cache stats.
         stat_assert_greater(self.session, wiredtiger.stat.conn.chunkcache_chunks_inuse, 0)
         stat_assert_greater(self.session, wiredtiger.stat.conn.chunkcache_chunks_evicted, 0)
+        stat_assert_greater(self.session, wiredtiger.stat.conn.chunkcache_hits_read, 0)
+
+        # The TinyLFU policy decides which chunks enter the main region once the cache is full.
+        if self.policy == 'tinylfu':
+            self.assertGreater(
+                get_stat(self.session, wiredtiger.stat.conn.chunkcache_tinylfu_admitted) +
+                get_stat(self.session, wiredtiger.stat.conn.chunkcache_tinylfu_rejected), 0)
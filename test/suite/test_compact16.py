@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time, wiredtiger
+from compact_util import compact_util
+from wiredtiger import stat
+
+# test_compact16.py
+# This test checks that background compaction configured with several threads compacts files in
+# parallel and that the thread configuration is validated.
+class test_compact16(compact_util):
+    create_params = 'key_format=i,value_format=S,allocation_size=4KB,leaf_page_max=32KB,'
+    conn_config = 'cache_size=100MB,statistics=(all)'
+    uri_prefix = 'table:test_compact16'
+
+    table_numkv = 100 * 1000
+    n_tables = 4
+
+    def test_compact16(self):
+        # FIXME-WT-11399
+        if self.runningHook('tiered'):
+            self.skipTest("this test does not yet work with tiered storage")
+
+        # The thread count can only be given when enabling background compaction.
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.compact(None, 'background=false,threads=4'),
+            '/threads configuration cannot be set when disabling the background compaction/')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.compact(None, 'background=true,threads=0'),
+            '/Value too small for key/')
+
+        # Create and populate tables.
+        uris = []
+        for i in range(self.n_tables):
+            uri = f'{self.uri_prefix}_{i}'
+            uris.append(uri)
+            self.session.create(uri, self.create_params)
+            self.populate(uri, 0, self.table_numkv)
+
+        # Delete the first 90% of each table and write to disk.
+        for uri in uris:
+            self.delete_range(uri, 90 * self.table_numkv // 100)
+        self.session.checkpoint()
+
+        sizes_before = [self.get_size(uri) for uri in uris]
+
+        # Enable background compaction with several threads, every table should be compacted.
+        self.turn_on_bg_compact('free_space_target=1MB,threads=4')
+        while self.get_files_compacted(uris) < self.n_tables:
+            time.sleep(0.1)
+        self.turn_off_bg_compact()
+
+        for i, uri in enumerate(uris):
+            self.assertGreater(self.get_stat(stat.dsrc.btree_compact_bytes_rewritten, uri), 0)
+            self.assertLess(self.get_size(uri), sizes_before[i])
+
+        # No file should be left in the hands of a worker thread once background compaction is off.
+        self.assertEqual(self.get_stat(stat.conn.background_compact_files_active), 0)
+        self.assertGreaterEqual(self.get_bg_compaction_success(), self.n_tables)
+
+        # Background compaction may have been interrupted while compacting.
+        self.ignoreStdoutPatternIfExists('background compact interrupted by application')
@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_compress03.py
+#    Test the aligned I/O buffer pool used to read and write compressed and
+#    encrypted blocks.
+#
+
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+class test_compress03(wttest.WiredTigerTestCase):
+    uri = 'table:test_compress03'
+    nrecords = 10000
+    bigvalue = "abcdefghij" * 100
+
+    convert = [
+        ('compress', dict(compress='nop', encrypt=None)),
+        ('encrypt', dict(compress=None, encrypt='rotn')),
+        ('both', dict(compress='nop', encrypt='rotn')),
+    ]
+    pool = [
+        ('pool-off', dict(pool_max=0)),
+        ('pool-on', dict(pool_max=8 * 1024 * 1024)),
+    ]
+    scenarios = make_scenarios(convert, pool)
+
+    # Load the compression and encryption extensions, skip the test if missing.
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        if self.compress is not None:
+            extlist.extension('compressors', self.compress)
+        if self.encrypt is not None:
+            extlist.extension('encryptors', self.encrypt)
+
+    # Configure buffer alignment without direct I/O, the buffer pool only holds aligned buffers.
+    def conn_config(self):
+        config = 'buffer_alignment=4096,cache_size=20MB,statistics=(all),' + \
+            'io_buffer_pool_max={}'.format(self.pool_max)
+        if self.encrypt is not None:
+            config += ',encryption=(name={},keyid=7)'.format(self.encrypt)
+        return config
+
+    def get_stat(self, stat_key):
+        stat_cursor = self.session.open_cursor('statistics:')
+        value = stat_cursor[stat_key][2]
+        stat_cursor.close()
+        return value
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in range(1, self.nrecords):
+            self.assertEqual(cursor[repr(idx)], repr(idx) + self.bigvalue)
+        cursor.close()
+
+    def test_compress_buffer_pool(self):
+        params = 'key_format=S,value_format=S,leaf_page_max=16KB'
+        if self.compress is not None:
+            params += ',block_compressor=' + self.compress
+        if self.encrypt is not None:
+            params += ',encryption=(name={},keyid=7)'.format(self.encrypt)
+        self.session.create(self.uri, params)
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in range(1, self.nrecords):
+            cursor[repr(idx)] = repr(idx) + self.bigvalue
+        cursor.close()
+        self.session.checkpoint()
+
+        # Read the compressed or encrypted pages back from disk.
+        self.reopen_conn()
+        self.check()
+        self.session.verify(self.uri)
+
+        hits = self.get_stat(stat.conn.block_buffer_pool_hit)
+        misses = self.get_stat(stat.conn.block_buffer_pool_miss)
+        cached = self.get_stat(stat.conn.block_buffer_pool_bytes)
+        if self.pool_max == 0:
+            self.assertEqual(hits + misses + cached, 0)
+        else:
+            self.assertGreater(hits + misses, 0)
+            self.assertGreater(cached, 0)
+            self.assertLessEqual(cached, self.pool_max)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wttest
+from wiredtiger import stat
+from wtdataset import SimpleDataSet
+from wtscenario import make_scenarios
+
+# test_eviction02.py
+'''
+Run a hot working set alongside scans of a table larger than the cache with each eviction page
+replacement policy. The frequency policy should skip the hot pages during eviction walks, the
+default policy should never do so. Check the policy can be changed with reconfigure.
+'''
+class test_eviction02(wttest.WiredTigerTestCase):
+    nrows_hot = 1000
+    nrows_scan = 50000
+    value = 'x' * 200
+
+    policies = [
+        ('frequency', dict(policy='frequency')),
+        ('lru', dict(policy='lru')),
+    ]
+    scenarios = make_scenarios(policies)
+
+    def conn_config(self):
+        return 'cache_size=10MB,statistics=(all),eviction=(policy={})'.format(self.policy)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_eviction_policy(self):
+        hot_uri = "table:test_eviction02_hot"
+        scan_uri = "table:test_eviction02_scan"
+        hot = SimpleDataSet(self, hot_uri, self.nrows_hot, key_format='i', value_format='S')
+        hot.populate()
+        scan = SimpleDataSet(self, scan_uri, self.nrows_scan, key_format='i', value_format='S')
+        scan.populate()
+
+        cursor = self.session.open_cursor(scan_uri)
+        for i in range(1, self.nrows_scan + 1):
+            cursor[i] = self.value
+        cursor.close()
+        self.session.checkpoint()
+
+        hot_cursor = self.session.open_cursor(hot_uri)
+        for _ in range(3):
+            scan_cursor = self.session.open_cursor(scan_uri)
+            for i, (k, v) in enumerate(scan_cursor):
+                if i % 100 == 0:
+                    for j in range(1, self.nrows_hot + 1, 10):
+                        hot_cursor.set_key(j)
+                        self.assertEqual(hot_cursor.search(), 0)
+            scan_cursor.close()
+        hot_cursor.close()
+
+        skipped = self.get_stat(stat.conn.cache_eviction_server_skip_frequent_pages)
+        if self.policy == 'frequency':
+            self.assertGreater(skipped, 0)
+        else:
+            self.assertEqual(skipped, 0)
+
+        # The policy can be changed while the connection is open.
+        self.conn.reconfigure('eviction=(policy=lru)')
+        self.conn.reconfigure('eviction=(policy=frequency)')
+
+if __name__ == '__main__':
+    wttest.run()
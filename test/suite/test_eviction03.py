@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest, time
+from wiredtiger import stat
+
+# test_eviction03.py
+'''
+Check per-object cache quotas and reservations: a table loaded well past its quota should be held
+near the quota while the cache as a whole has room, a reserved table should keep its pages while a
+second table is scanned through the cache, and the settings should be visible in statistics.
+'''
+class test_eviction03(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=50MB,statistics=(fast)'
+    value = 'x' * 500
+
+    def get_stat(self, stat, uri=None):
+        stat_cursor = self.session.open_cursor('statistics:' + (uri or ''))
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def load(self, uri, nrows):
+        cursor = self.session.open_cursor(uri)
+        for i in range(1, nrows + 1):
+            self.session.begin_transaction()
+            cursor[i] = self.value
+            self.session.commit_transaction()
+        cursor.close()
+
+    def test_cache_quota(self):
+        uri = 'table:test_eviction03_quota'
+        quota = 2 * 1024 * 1024
+        self.session.create(uri, 'key_format=i,value_format=S,cache_max={}'.format(quota))
+        self.session.checkpoint()
+
+        # Load about 10MB, far less than the cache, checkpointing so the pages are clean.
+        for i in range(4):
+            self.load(uri, 5000 * (i + 1))
+            self.session.checkpoint()
+        cursor = self.session.open_cursor(uri)
+        for _ in cursor:
+            pass
+        cursor.close()
+
+        self.assertEqual(self.get_stat(stat.dsrc.cache_bytes_quota, uri), quota)
+        self.assertEqual(self.get_stat(stat.dsrc.cache_bytes_reserve, uri), 0)
+
+        # Eviction should bring the table back near its quota without any other cache pressure.
+        for _ in range(300):
+            if self.get_stat(stat.dsrc.cache_bytes_inuse, uri) < 2 * quota:
+                break
+            time.sleep(0.1)
+        self.assertLess(self.get_stat(stat.dsrc.cache_bytes_inuse, uri), 2 * quota)
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_server_skip_trees_under_quota), 0)
+
+    def test_cache_reserve(self):
+        small_uri = 'table:test_eviction03_small'
+        large_uri = 'table:test_eviction03_large'
+        self.session.create(small_uri, 'key_format=i,value_format=S,cache_reserve=5MB')
+        self.session.create(large_uri, 'key_format=i,value_format=S')
+
+        self.load(small_uri, 2000)
+        self.load(large_uri, 150000)
+        self.session.checkpoint()
+
+        # Scan the large table through the cache; the small table should stay resident.
+        cursor = self.session.open_cursor(large_uri)
+        for _ in cursor:
+            pass
+        cursor.close()
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_server_skip_trees_reserved), 0)
+        self.assertGreater(self.get_stat(stat.dsrc.cache_bytes_inuse, small_uri), 1024 * 1024)
+
+    def test_cache_quota_config(self):
+        uri = 'table:test_eviction03_config'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(uri,
+                'key_format=i,value_format=S,cache_max=1MB,cache_reserve=2MB'),
+            '/cache_reserve must not be larger than cache_max/')
+        self.session.create(uri, 'key_format=i,value_format=S,cache_max=2MB')
+        self.session.alter(uri, 'cache_max=4MB,cache_reserve=1MB')
+        self.load(uri, 10)
+        self.assertEqual(self.get_stat(stat.dsrc.cache_bytes_quota, uri), 4 * 1024 * 1024)
+        self.assertEqual(self.get_stat(stat.dsrc.cache_bytes_reserve, uri), 1024 * 1024)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,69 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wiredtiger import stat
+
+# test_eviction04.py
+'''
+Check eviction pacing: loading a table quickly should make the eviction server project the cache
+content past the triggers and start evicting early, its estimates should be visible in statistics,
+and reconfiguring pacing off should stop early eviction.
+'''
+class test_eviction04(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=50MB,statistics=(fast),eviction=(pacing_horizon_ms=5000)'
+    uri = 'table:test_eviction04'
+    value = 'x' * 1000
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def load(self, start, nrows):
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(start, start + nrows):
+            cursor[i] = self.value
+        cursor.close()
+
+    def test_eviction_pacing(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        self.load(1, 100000)
+
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_pacing_early), 0)
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_pacing_inuse_predicted), 0)
+
+        # With pacing off, eviction is no longer started early.
+        self.conn.reconfigure('eviction=(pacing_horizon_ms=0)')
+        early = self.get_stat(stat.conn.cache_eviction_pacing_early)
+        self.load(100001, 50000)
+        self.assertEqual(self.get_stat(stat.conn.cache_eviction_pacing_early), early)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wiredtiger import stat
+
+# test_eviction05.py
+'''
+Check the eviction server ranks trees by their eviction candidates: with many small tables and one
+table larger than the cache, the rankings should be visible in statistics, all the data should
+remain readable, and reconfiguring round robin selection should stop ranking trees.
+'''
+class test_eviction05(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=30MB,statistics=(fast),eviction=(tree_selection=ranked)'
+    uri = 'table:test_eviction05'
+    ntables = 100
+    value = 'x' * 1000
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def load(self, uri, start, nrows):
+        cursor = self.session.open_cursor(uri)
+        for i in range(start, start + nrows):
+            cursor[i] = self.value
+        cursor.close()
+
+    def check(self, uri, nrows):
+        cursor = self.session.open_cursor(uri)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.value)
+            count += 1
+        cursor.close()
+        self.assertEqual(count, nrows)
+
+    def test_eviction_rank_trees(self):
+        for i in range(self.ntables):
+            small_uri = self.uri + '_' + str(i)
+            self.session.create(small_uri, 'key_format=i,value_format=S')
+            self.load(small_uri, 1, 10)
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        self.load(self.uri, 1, 60000)
+
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_server_rank_trees), 0)
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_server_rank_trees_ranked), 0)
+
+        self.check(self.uri, 60000)
+        for i in range(self.ntables):
+            self.check(self.uri + '_' + str(i), 10)
+
+        # With round robin selection, trees are no longer ranked.
+        self.conn.reconfigure('eviction=(tree_selection=round_robin)')
+        rankings = self.get_stat(stat.conn.cache_eviction_server_rank_trees)
+        self.load(self.uri, 60001, 30000)
+        self.assertEqual(self.get_stat(stat.conn.cache_eviction_server_rank_trees), rankings)
+        self.check(self.uri, 90000)
+
+if __name__ == '__main__':
+    wttest.run()
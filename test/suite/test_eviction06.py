@@ -0,0 +1,108 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+
+# test_eviction06.py
+'''
+Check the eviction trace: loading more data than fits in the cache should record page evictions
+that can be read back with an eviction trace cursor, most recent events only, in sequence order.
+'''
+class test_eviction06(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=10MB,eviction_trace=(enabled=true,events=64)'
+    uri = 'table:test_eviction06'
+    value = 'x' * 1000
+
+    types = ['evict', 'evict_fail', 'split', 'stall']
+    threads = ['application', 'eviction', 'internal']
+    reasons = ['none', 'forced', 'close', 'clean_trigger', 'dirty_trigger', 'updates_trigger',
+        'clean_target', 'dirty_target', 'updates_target', 'quota']
+
+    def read_trace(self, cursor):
+        events = []
+        while cursor.next() == 0:
+            events.append([cursor.get_key()] + cursor.get_value())
+        return events
+
+    def test_eviction_trace(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, 50000):
+            cursor[i] = self.value
+        cursor.close()
+
+        trace = self.session.open_cursor('eviction_trace:')
+        events = self.read_trace(trace)
+        self.assertGreater(len(events), 0)
+        self.assertLessEqual(len(events), 64)
+
+        evicted = 0
+        prev = 0
+        for seq, time_us, thread, event, reason, uri, page, page_bytes, reconcile_us, \
+          hs_bytes, elapsed_us in events:
+            self.assertGreater(seq, prev)
+            prev = seq
+            self.assertGreater(time_us, 0)
+            self.assertIn(thread, self.threads)
+            self.assertIn(event, self.types)
+            self.assertIn(reason, self.reasons)
+            if event == 'evict' and uri == 'file:test_eviction06.wt':
+                self.assertNotEqual(page, 0)
+                self.assertGreater(page_bytes, 0)
+                evicted += 1
+        self.assertGreater(evicted, 0)
+
+        # Search for an event by its sequence number, searching an unknown one fails.
+        trace.set_key(events[-1][0])
+        self.assertEqual(trace.search(), 0)
+        self.assertEqual(trace.get_value(), events[-1][1:])
+        trace.set_key(events[-1][0] + 1000000)
+        self.assertEqual(trace.search(), wiredtiger.WT_NOTFOUND)
+
+        # After a reset, the cursor walks backward through a new copy of the trace.
+        trace.reset()
+        prev = None
+        while trace.prev() == 0:
+            if prev is not None:
+                self.assertLess(trace.get_key(), prev)
+            prev = trace.get_key()
+        self.assertIsNotNone(prev)
+        trace.close()
+
+        with self.expectedStdoutPattern('eviction trace dump'):
+            self.conn.debug_info('eviction_trace=true')
+
+    def test_eviction_trace_disabled(self):
+        self.reopen_conn(config='cache_size=10MB')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor('eviction_trace:'),
+            '/eviction trace cursors require the eviction trace be enabled/')
+
+if __name__ == '__main__':
+    wttest.run()
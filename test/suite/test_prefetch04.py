@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_prefetch04.py
+#    Verify scans are correct when pre-fetch reads blocks in batches.
+class test_prefetch04(wttest.WiredTigerTestCase):
+    uri = 'table:test_prefetch04'
+    nrows = 100000
+
+    io_uring = [
+        ('io_uring-off', dict(io_uring_cfg='io_uring=(enabled=false)', batched=False)),
+        ('io_uring-on', dict(io_uring_cfg='io_uring=(enabled=true,queue_depth=16)', batched=True)),
+    ]
+
+    scenarios = make_scenarios(io_uring)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_prefetch04(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S,leaf_page_max=4KB')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows + 1):
+            cursor[i] = str(i) * 10
+        cursor.close()
+        self.session.checkpoint()
+
+        # Reopen so the scan reads the table from disk.
+        self.reopen_conn('.', 'statistics=(all),prefetch=(available=true,default=true),' +
+            self.io_uring_cfg)
+        session = self.conn.open_session('prefetch=(enabled=true)')
+        cursor = session.open_cursor(self.uri)
+        i = 0
+        for key, value in cursor:
+            i += 1
+            self.assertEqual(key, i)
+            self.assertEqual(value, str(i) * 10)
+        self.assertEqual(i, self.nrows)
+        cursor.close()
+        session.close()
+
+        # Batched reads only happen if configured, and only ever read blocks pre-fetch asked for.
+        batch_pages = self.get_stat(stat.conn.prefetch_pages_read_batch)
+        self.assertLessEqual(batch_pages, self.get_stat(stat.conn.prefetch_pages_read))
+        if not self.batched:
+            self.assertEqual(self.get_stat(stat.conn.block_read_batch), 0)
+            self.assertEqual(batch_pages, 0)
+
+        # Adjacent blocks are only coalesced within a batch, and a coalesced read covers at least
+        # two blocks.
+        coalesce = self.get_stat(stat.conn.block_read_coalesce)
+        coalesce_blocks = self.get_stat(stat.conn.block_read_coalesce_blocks)
+        self.assertLessEqual(coalesce_blocks, self.get_stat(stat.conn.block_read_batch_blocks))
+        self.assertGreaterEqual(coalesce_blocks, 2 * coalesce)
+
+if __name__ == '__main__':
+    wttest.run()